@@ -82,10 +82,27 @@ struct dmi_sig_values {
   uint8_t dmi_rst_n;
 };
 
+#ifdef DMIDPI_LOCAL_ACCESS
+// A DMI access issued from within the simulation (see dmidpi_local_req())
+struct local_dmi {
+  bool req_pending;
+  bool outstanding;
+  bool rsp_valid;
+  uint32_t req_addr;
+  uint32_t req_op;
+  uint32_t req_data;
+  uint32_t rsp_data;
+  uint32_t rsp_resp;
+};
+#endif
+
 struct dmidpi_ctx {
   struct tcp_server_ctx *sock;
   struct jtag_ctx jtag;
   struct dmi_sig_values sig;
+#ifdef DMIDPI_LOCAL_ACCESS
+  struct local_dmi local;
+#endif
 };
 
 /**
@@ -337,6 +354,15 @@ static void process_dmi_inputs(struct dmidpi_ctx *ctx) {
   }
   // Always ready for a resp
   ctx->sig.dmi_rsp_ready = 1;
+#ifdef DMIDPI_LOCAL_ACCESS
+  if (ctx->sig.dmi_rsp_valid && ctx->local.outstanding) {
+    ctx->local.rsp_data = ctx->sig.dmi_rsp_data;
+    ctx->local.rsp_resp = ctx->sig.dmi_rsp_resp & 0x3;
+    ctx->local.rsp_valid = true;
+    ctx->local.outstanding = false;
+    return;
+  }
+#endif
   if (ctx->sig.dmi_rsp_valid) {
     ctx->jtag.dr_captured = (uint64_t)ctx->sig.dmi_rsp_data << 2;
     ctx->jtag.dr_captured |= (uint64_t)ctx->sig.dmi_rsp_resp & 0x3;
@@ -362,6 +388,25 @@ static void update_dmi_state(struct dmidpi_ctx *ctx) {
     return;
   }
 
+#ifdef DMIDPI_LOCAL_ACCESS
+  if (ctx->local.outstanding) {
+    return;
+  }
+
+  // Local requests take priority over the socket, which is only read between
+  // complete JTAG commands.
+  if (ctx->local.req_pending) {
+    ctx->local.req_pending = false;
+    ctx->local.outstanding = true;
+    ctx->sig.dmi_rst_n = 1;
+    ctx->sig.dmi_req_valid = 1;
+    ctx->sig.dmi_req_addr = ctx->local.req_addr;
+    ctx->sig.dmi_req_op = ctx->local.req_op;
+    ctx->sig.dmi_req_data = ctx->local.req_data;
+    return;
+  }
+#endif
+
   char done = 0;
   while (!done) {
     // read a command byte
@@ -407,6 +452,41 @@ void dmidpi_close(void *ctx_void) {
   free(ctx);
 }
 
+#ifdef DMIDPI_LOCAL_ACCESS
+bool dmidpi_local_req(void *ctx_void, uint32_t addr, uint32_t op,
+                      uint32_t data) {
+  struct dmidpi_ctx *ctx = (struct dmidpi_ctx *)ctx_void;
+  assert(ctx);
+
+  if (ctx->local.req_pending || ctx->local.outstanding) {
+    return false;
+  }
+  ctx->local.req_addr = addr & 0x7F;
+  ctx->local.req_op = op & 0x3;
+  ctx->local.req_data = data;
+  ctx->local.rsp_valid = false;
+  ctx->local.req_pending = true;
+  return true;
+}
+
+bool dmidpi_local_rsp(void *ctx_void, uint32_t *data, uint32_t *resp) {
+  struct dmidpi_ctx *ctx = (struct dmidpi_ctx *)ctx_void;
+  assert(ctx);
+
+  if (!ctx->local.rsp_valid) {
+    return false;
+  }
+  ctx->local.rsp_valid = false;
+  if (data) {
+    *data = ctx->local.rsp_data;
+  }
+  if (resp) {
+    *resp = ctx->local.rsp_resp;
+  }
+  return true;
+}
+#endif  // DMIDPI_LOCAL_ACCESS
+
 void dmidpi_tick(void *ctx_void, svBit *dmi_req_valid,
                  const svBit dmi_req_ready, svBitVecVal *dmi_req_addr,
                  svBitVecVal *dmi_req_op, svBitVecVal *dmi_req_data,
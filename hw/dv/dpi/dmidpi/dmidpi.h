@@ -5,6 +5,8 @@
 #ifndef OPENTITAN_HW_DV_DPI_DMIDPI_DMIDPI_H_
 #define OPENTITAN_HW_DV_DPI_DMIDPI_DMIDPI_H_
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <svdpi.h>
 
 #ifdef __cplusplus
@@ -31,6 +33,37 @@ void *dmidpi_create(const char *display_name, int listen_port);
  */
 void dmidpi_close(void *ctx_void);
 
+#ifdef DMIDPI_LOCAL_ACCESS
+/**
+ * Queue a DMI access from within the simulation
+ *
+ * Only available if DMIDPI_LOCAL_ACCESS is defined. This lets simulation-side
+ * code (such as a SimCtrlExtension) talk to the debug module without going
+ * through OpenOCD. The access is issued on the next clock tick on which no
+ * other DMI access is outstanding. Local accesses are not synchronized with
+ * dmidpi_tick(): call this function only between model evaluations, e.g. from
+ * SimCtrlExtension::OnClock().
+ *
+ * @param ctx_void a struct dmidpi_ctx context object
+ * @param addr DMI register address
+ * @param op DMI operation (1: read, 2: write)
+ * @param data Data to write
+ * @return false if a local access is already pending, true otherwise
+ */
+bool dmidpi_local_req(void *ctx_void, uint32_t addr, uint32_t op,
+                      uint32_t data);
+
+/**
+ * Collect the response to a local DMI access
+ *
+ * @param ctx_void a struct dmidpi_ctx context object
+ * @param data Read data (may be NULL)
+ * @param resp DMI response code, 0 on success (may be NULL)
+ * @return true if a response was available, false otherwise
+ */
+bool dmidpi_local_rsp(void *ctx_void, uint32_t *data, uint32_t *resp);
+#endif  // DMIDPI_LOCAL_ACCESS
+
 /**
  * Drive DMI signals
  *
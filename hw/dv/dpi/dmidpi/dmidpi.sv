@@ -37,6 +37,16 @@ module dmidpi #(
 
   chandle ctx;
 
+`ifdef DMIDPI_LOCAL_ACCESS
+  // Let simulation-side code find the context of this instance, to issue DMI
+  // accesses with dmidpi_local_req().
+  export "DPI-C" function dmidpi_get_ctx;
+
+  function chandle dmidpi_get_ctx();
+    return ctx;
+  endfunction
+`endif
+
   initial begin
     ctx = dmidpi_create(Name, ListenPort);
   end
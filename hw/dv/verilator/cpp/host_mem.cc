@@ -0,0 +1,332 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "host_mem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+// This matches SV_MEM_WIDTH_BITS in mem_area.h and the width of the DPI
+// buffers in prim_util_hostmem.svh.
+static const uint32_t kMaxWidthBit = 312;
+
+namespace {
+struct Registry {
+  std::mutex mutex;
+  std::map<svScope, std::unique_ptr<HostMem>> mems;
+  // Number of entries in mems, which can be checked without taking the lock.
+  // Builds without host-backed memories never register anything, so Find()
+  // stays cheap for them.
+  std::atomic<size_t> count{0};
+};
+
+Registry &GetRegistry() {
+  static Registry registry;
+  return registry;
+}
+}  // namespace
+
+HostMem::HostMem() : width_bit_(0), word_bytes_(0), depth_(0), fill_(0) {}
+
+HostMem &HostMem::ForScope(svScope scope) {
+  assert(scope);
+  Registry &registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  std::unique_ptr<HostMem> &mem = registry.mems[scope];
+  if (!mem) {
+    mem.reset(new HostMem());
+    registry.count = registry.mems.size();
+  }
+  return *mem;
+}
+
+HostMem *HostMem::Find(svScope scope) {
+  Registry &registry = GetRegistry();
+  if (registry.count == 0) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto it = registry.mems.find(scope);
+  return it == registry.mems.end() ? nullptr : it->second.get();
+}
+
+void HostMem::Release(svScope scope) {
+  Registry &registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.mems.erase(scope);
+  registry.count = registry.mems.size();
+}
+
+void HostMem::Configure(uint32_t width_bit, uint32_t depth) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (width_bit_ == width_bit && depth_ == depth) {
+    return;
+  }
+  if (width_bit_ != 0) {
+    std::ostringstream oss;
+    oss << "Cannot reconfigure a " << width_bit_ << "x" << depth_
+        << " host memory as " << width_bit << "x" << depth << ".";
+    throw std::runtime_error(oss.str());
+  }
+  if (width_bit == 0 || width_bit > kMaxWidthBit || depth == 0) {
+    std::ostringstream oss;
+    oss << "Unsupported host memory geometry: " << width_bit << "x" << depth
+        << ".";
+    throw std::runtime_error(oss.str());
+  }
+  width_bit_ = width_bit;
+  word_bytes_ = (width_bit + 7) / 8;
+  depth_ = depth;
+}
+
+bool HostMem::IsConfigured() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return width_bit_ != 0;
+}
+
+uint32_t HostMem::GetWordBytes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return word_bytes_;
+}
+
+uint32_t HostMem::GetDepth() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return depth_;
+}
+
+void HostMem::Fill(uint8_t value) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  fill_ = value;
+  pages_.clear();
+}
+
+bool HostMem::ReadWord(uint32_t index, uint8_t *dst) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (index >= depth_) {
+    return false;
+  }
+  // CopyOut never allocates, so calling it on a const object is fine.
+  const_cast<HostMem *>(this)->CopyOut(size_t(index) * word_bytes_, dst,
+                                       word_bytes_);
+  return true;
+}
+
+bool HostMem::WriteWord(uint32_t index, const uint8_t *src,
+                        const uint8_t *mask) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (index >= depth_) {
+    return false;
+  }
+
+  // Never write the bits above width_bit_ in the top byte, so that reads
+  // return exactly what the RTL would.
+  uint8_t word_mask[kMaxWidthBit / 8];
+  for (uint32_t i = 0; i < word_bytes_; ++i) {
+    word_mask[i] = mask ? mask[i] : 0xff;
+  }
+  if (width_bit_ % 8) {
+    word_mask[word_bytes_ - 1] &= (1u << (width_bit_ % 8)) - 1;
+  }
+
+  CopyIn(size_t(index) * word_bytes_, src, word_mask, word_bytes_);
+  return true;
+}
+
+uint8_t *HostMem::GetPage(size_t page_idx, bool alloc) {
+  auto it = pages_.find(page_idx);
+  if (it != pages_.end()) {
+    return it->second.get();
+  }
+  if (!alloc) {
+    return nullptr;
+  }
+  std::unique_ptr<uint8_t[]> page(new uint8_t[kPageBytes]);
+  memset(page.get(), fill_, kPageBytes);
+  uint8_t *ret = page.get();
+  pages_[page_idx] = std::move(page);
+  return ret;
+}
+
+void HostMem::CopyOut(size_t offset, uint8_t *dst, size_t len) {
+  while (len) {
+    size_t page_off = offset % kPageBytes;
+    size_t chunk = std::min(len, kPageBytes - page_off);
+    const uint8_t *page = GetPage(offset / kPageBytes, false);
+    if (page) {
+      memcpy(dst, page + page_off, chunk);
+    } else {
+      memset(dst, fill_, chunk);
+    }
+    offset += chunk;
+    dst += chunk;
+    len -= chunk;
+  }
+}
+
+void HostMem::CopyIn(size_t offset, const uint8_t *src, const uint8_t *mask,
+                     size_t len) {
+  while (len) {
+    size_t page_off = offset % kPageBytes;
+    size_t chunk = std::min(len, kPageBytes - page_off);
+    uint8_t *page = GetPage(offset / kPageBytes, true);
+    for (size_t i = 0; i < chunk; ++i) {
+      uint8_t &byte = page[page_off + i];
+      byte = (byte & ~mask[i]) | (src[i] & mask[i]);
+    }
+    offset += chunk;
+    src += chunk;
+    mask += chunk;
+    len -= chunk;
+  }
+}
+
+// Parse a hex number from a VMEM file into a little-endian byte vector of
+// num_bytes bytes. As with $readmemh(), X and Z digits read as zero and
+// underscores are ignored.
+static bool ParseVmemHex(const std::string &text, size_t num_bytes,
+                         std::vector<uint8_t> &out) {
+  out.assign(num_bytes, 0);
+  size_t nibble = 0;
+  for (auto it = text.rbegin(); it != text.rend(); ++it) {
+    char c = *it;
+    if (c == '_') {
+      continue;
+    }
+    unsigned value;
+    if (c >= '0' && c <= '9') {
+      value = c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      value = c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+      value = c - 'A' + 10;
+    } else if (c == 'x' || c == 'X' || c == 'z' || c == 'Z') {
+      value = 0;
+    } else {
+      return false;
+    }
+    if (nibble / 2 < num_bytes) {
+      out[nibble / 2] |= value << (4 * (nibble % 2));
+    }
+    ++nibble;
+  }
+  return nibble > 0;
+}
+
+void HostMem::LoadVmem(const std::string &path) {
+  std::ifstream file(path);
+  if (!file) {
+    throw std::runtime_error("Cannot open VMEM file `" + path + "'.");
+  }
+  std::string text((std::istreambuf_iterator<char>(file)),
+                   std::istreambuf_iterator<char>());
+
+  // Strip comments, replacing them with a space so that they still separate
+  // tokens.
+  std::string stripped;
+  stripped.reserve(text.size());
+  for (size_t i = 0; i < text.size(); ++i) {
+    if (text.compare(i, 2, "//") == 0) {
+      i = text.find('\n', i);
+      if (i == std::string::npos) {
+        break;
+      }
+    } else if (text.compare(i, 2, "/*") == 0) {
+      i = text.find("*/", i + 2);
+      if (i == std::string::npos) {
+        throw std::runtime_error("Unterminated comment in VMEM file `" +
+                                 path + "'.");
+      }
+      ++i;
+      stripped.push_back(' ');
+      continue;
+    }
+    stripped.push_back(text[i]);
+  }
+
+  uint32_t word_bytes = GetWordBytes();
+  if (!word_bytes) {
+    throw std::runtime_error("Cannot load `" + path +
+                             "' into an unconfigured host memory.");
+  }
+
+  std::istringstream tokens(stripped);
+  std::string token;
+  std::vector<uint8_t> data;
+  uint32_t index = 0;
+  while (tokens >> token) {
+    if (token[0] == '@') {
+      std::vector<uint8_t> addr;
+      if (!ParseVmemHex(token.substr(1), sizeof(uint32_t), addr)) {
+        throw std::runtime_error("Bad address `" + token +
+                                 "' in VMEM file `" + path + "'.");
+      }
+      index = addr[0] | addr[1] << 8 | addr[2] << 16 | uint32_t(addr[3]) << 24;
+      continue;
+    }
+    if (!ParseVmemHex(token, word_bytes, data)) {
+      throw std::runtime_error("Bad data `" + token + "' in VMEM file `" +
+                               path + "'.");
+    }
+    if (!WriteWord(index, data.data(), nullptr)) {
+      std::ostringstream oss;
+      oss << "Word index 0x" << std::hex << index << " of VMEM file `" << path
+          << "' is out of range.";
+      throw std::runtime_error(oss.str());
+    }
+    ++index;
+  }
+}
+
+// DPI imports, declared in prim_util_hostmem.svh
+extern "C" {
+void *prim_hostmem_create(int width, int depth) {
+  HostMem &mem = HostMem::ForScope(svGetScope());
+  try {
+    mem.Configure(width, depth);
+  } catch (const std::exception &err) {
+    std::cerr << "ERROR: " << svGetNameFromScope(svGetScope()) << ": "
+              << err.what() << std::endl;
+    return nullptr;
+  }
+  return &mem;
+}
+
+void prim_hostmem_release() { HostMem::Release(svGetScope()); }
+
+void prim_hostmem_read(void *handle, int index, svBitVecVal *val) {
+  HostMem *mem = static_cast<HostMem *>(handle);
+  assert(mem);
+  memset(val, 0, kMaxWidthBit / 8);
+  mem->ReadWord(index, reinterpret_cast<uint8_t *>(val));
+}
+
+void prim_hostmem_write(void *handle, int index, const svBitVecVal *val,
+                        const svBitVecVal *mask) {
+  HostMem *mem = static_cast<HostMem *>(handle);
+  assert(mem);
+  mem->WriteWord(index, reinterpret_cast<const uint8_t *>(val),
+                 reinterpret_cast<const uint8_t *>(mask));
+}
+
+int prim_hostmem_load_vmem(void *handle, const char *path) {
+  HostMem *mem = static_cast<HostMem *>(handle);
+  assert(mem);
+  try {
+    mem->LoadVmem(path);
+  } catch (const std::exception &err) {
+    std::cerr << "ERROR: " << err.what() << std::endl;
+    return 0;
+  }
+  return 1;
+}
+}
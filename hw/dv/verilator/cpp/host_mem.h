@@ -0,0 +1,120 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OPENTITAN_HW_DV_VERILATOR_CPP_HOST_MEM_H_
+#define OPENTITAN_HW_DV_VERILATOR_CPP_HOST_MEM_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <svdpi.h>
+#include <unordered_map>
+
+/**
+ * Sparse host-side storage for a simulated memory
+ *
+ * Memory primitives built with PRIM_RAM_HOSTMEM defined (see
+ * prim_util_hostmem.svh) keep their contents in one of these instead of a
+ * Verilated array. Storage is allocated a page at a time on the first write to
+ * that page, and pages that have never been written read as the fill byte. This
+ * makes large, mostly erased memories such as flash cheap to create and to
+ * erase, and lets MemArea read and write the contents without going through
+ * DPI.
+ *
+ * Words are stored back to back, each taking the smallest whole number of
+ * bytes that holds the memory width, in the same little-endian layout as an
+ * svBitVecVal array.
+ *
+ * Each instance belongs to the SystemVerilog scope of a memory primitive. All
+ * methods are thread-safe.
+ */
+class HostMem {
+ public:
+  /**
+   * Get the storage for a scope, creating it if necessary
+   *
+   * A new instance is unconfigured (see Configure()) and filled with zeros.
+   */
+  static HostMem &ForScope(svScope scope);
+
+  /**
+   * Get the storage for a scope, or nullptr if there is none
+   */
+  static HostMem *Find(svScope scope);
+
+  /**
+   * Destroy the storage for a scope, if there is any
+   *
+   * The scope may be reused by a new model afterwards.
+   */
+  static void Release(svScope scope);
+
+  /**
+   * Set the geometry of the memory
+   *
+   * This is called by the memory primitive. Calling it again with a different
+   * geometry throws a std::runtime_error.
+   */
+  void Configure(uint32_t width_bit, uint32_t depth);
+
+  bool IsConfigured() const;
+  uint32_t GetWordBytes() const;
+  uint32_t GetDepth() const;
+
+  /**
+   * Set every byte of the memory to value
+   *
+   * This releases all allocated pages, so it takes constant time.
+   */
+  void Fill(uint8_t value);
+
+  /**
+   * Copy the word at index into dst, which must hold GetWordBytes() bytes
+   *
+   * Returns false if the memory is not configured or index is out of range.
+   */
+  bool ReadWord(uint32_t index, uint8_t *dst) const;
+
+  /**
+   * Write the word at index from src, which must hold GetWordBytes() bytes
+   *
+   * If mask is not null, only the bits set in mask are written. Bits above the
+   * memory width are never written. Returns false if the memory is not
+   * configured or index is out of range.
+   */
+  bool WriteWord(uint32_t index, const uint8_t *src, const uint8_t *mask);
+
+  /**
+   * Load a VMEM file, as $readmemh() would
+   *
+   * Throws a std::runtime_error if the file cannot be read or parsed.
+   */
+  void LoadVmem(const std::string &path);
+
+ private:
+  static constexpr size_t kPageBytes = 4096;
+
+  HostMem();
+
+  // Return the page holding byte page_idx * kPageBytes, allocating and
+  // filling it if alloc is true. Returns nullptr for unallocated pages if
+  // alloc is false. Must be called with mutex_ held.
+  uint8_t *GetPage(size_t page_idx, bool alloc);
+
+  // Copy len bytes at byte offset to or from the page store. Must be called
+  // with mutex_ held.
+  void CopyOut(size_t offset, uint8_t *dst, size_t len);
+  void CopyIn(size_t offset, const uint8_t *src, const uint8_t *mask,
+              size_t len);
+
+  mutable std::mutex mutex_;
+  uint32_t width_bit_;
+  uint32_t word_bytes_;
+  uint32_t depth_;
+  uint8_t fill_;
+  std::unordered_map<size_t, std::unique_ptr<uint8_t[]>> pages_;
+};
+
+#endif  // OPENTITAN_HW_DV_VERILATOR_CPP_HOST_MEM_H_
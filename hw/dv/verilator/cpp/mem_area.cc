@@ -9,9 +9,10 @@
 #include <cstring>
 #include <sstream>
 
+#include "host_mem.h"
 #include "sv_scoped.h"
 
-// DPI exports, defined in prim_util_memload.svh
+// DPI exports, defined in prim_util_memload.svh and prim_util_hostmem.svh
 extern "C" {
 void simutil_memload(const char *file);
 int simutil_set_mem(int index, const svBitVecVal *val);
@@ -82,6 +83,17 @@ void MemArea::LoadVmem(const std::string &path) const {
   simutil_memload(path.c_str());
 }
 
+void MemArea::Fill(uint8_t value) const {
+  {
+    SVScoped scoped(scope_);
+    if (HostMem *host_mem = HostMem::Find(svGetScope())) {
+      host_mem->Fill(value);
+      return;
+    }
+  }
+  Write(/*word_offset=*/0, std::vector<uint8_t>(GetSizeBytes(), value));
+}
+
 void MemArea::WriteBuffer(uint8_t buf[SV_MEM_WIDTH_BYTES],
                           const std::vector<uint8_t> &data, size_t start_idx,
                           uint32_t dst_word) const {
@@ -103,7 +115,14 @@ void MemArea::ReadBuffer(std::vector<uint8_t> &data,
 
 void MemArea::ReadToMinibuf(uint8_t *minibuf, uint32_t phys_addr) const {
   SVScoped scoped(scope_);
-  if (!simutil_get_mem(phys_addr, (svBitVecVal *)minibuf)) {
+  bool ok;
+  if (HostMem *host_mem = HostMem::Find(svGetScope())) {
+    memset(minibuf, 0, SV_MEM_WIDTH_BYTES);
+    ok = host_mem->ReadWord(phys_addr, minibuf);
+  } else {
+    ok = simutil_get_mem(phys_addr, (svBitVecVal *)minibuf);
+  }
+  if (!ok) {
     std::ostringstream oss;
     oss << "Could not read memory word at physical index 0x" << std::hex
         << phys_addr << ".";
@@ -114,7 +133,13 @@ void MemArea::ReadToMinibuf(uint8_t *minibuf, uint32_t phys_addr) const {
 void MemArea::WriteFromMinibuf(uint32_t phys_addr, const uint8_t *minibuf,
                                uint32_t dst_word) const {
   SVScoped scoped(scope_);
-  if (!simutil_set_mem(phys_addr, (const svBitVecVal *)minibuf)) {
+  bool ok;
+  if (HostMem *host_mem = HostMem::Find(svGetScope())) {
+    ok = host_mem->WriteWord(phys_addr, minibuf, nullptr);
+  } else {
+    ok = simutil_set_mem(phys_addr, (const svBitVecVal *)minibuf);
+  }
+  if (!ok) {
     std::ostringstream oss;
     oss << "Could not set memory at byte offset 0x" << std::hex
         << dst_word * width_byte_ << ".";
@@ -74,6 +74,16 @@ class MemArea {
   /** Use \c simutil_memload to load a vmem file into the memory */
   virtual void LoadVmem(const std::string &path) const;
 
+  /** Set every byte of the memory to \p value
+   *
+   * For host-backed memories (see host_mem.h) this fills the physical words,
+   * ECC/metadata bits included, and takes constant time. Otherwise it is
+   * equivalent to writing \p value to every byte with Write(). Since the
+   * host-backed path skips WriteBuffer(), use Write() instead for memories
+   * with scrambling or integrity bits.
+   */
+  void Fill(uint8_t value) const;
+
   const std::string &GetScope() const { return scope_; }
   uint32_t GetSizeWords() const { return num_words_; }
   uint32_t GetSizeBytes() const { return num_words_ * width_byte_; }
@@ -134,14 +144,17 @@ class MemArea {
   /** Read the memory word at phys_addr into minibuf
    *
    * minibuf should be at least SV_MEM_WIDTH_BYTES in size. See the
-   * implementation of MemArea::Write() for the details.
+   * implementation of MemArea::Write() for the details. If the memory is
+   * host-backed, this reads the host copy directly rather than calling into
+   * the simulation.
    */
   void ReadToMinibuf(uint8_t *minibuf, uint32_t phys_addr) const;
 
   /** Write from minibuf to the memory word at phys_addr
    *
    * minibuf should be at least SV_MEM_WIDTH_BYTES in size. See the
-   * implementation of MemArea::Write() for the details.
+   * implementation of MemArea::Write() for the details. Like ReadToMinibuf(),
+   * this bypasses DPI for host-backed memories.
    */
   void WriteFromMinibuf(uint32_t phys_addr, const uint8_t *minibuf,
                         uint32_t dst_word) const;
@@ -0,0 +1,174 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "spike_fast_forward.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "riscv/decode.h"
+#include "riscv/isa_parser.h"
+
+SpikeFastForward::SpikeFastForward(const std::string &isa_string,
+                                   uint32_t start_pc, bool secure_ibex,
+                                   bool icache_en, uint32_t pmp_num_regions,
+                                   uint32_t pmp_granularity,
+                                   uint32_t mhpm_counter_num)
+    : pmp_num_regions_(pmp_num_regions), insn_cnt_(0) {
+  isa_parser_ = std::make_unique<isa_parser_t>(isa_string.c_str(), "MU");
+  processor_ = std::make_unique<processor_t>(
+      isa_parser_.get(), DEFAULT_VARCH, this, 0, false, nullptr, std::cerr);
+
+  processor_->set_pmp_num(pmp_num_regions);
+  processor_->set_mhpm_counter_num(mhpm_counter_num);
+  processor_->set_pmp_granularity(1 << (pmp_granularity + 2));
+  processor_->set_ibex_flags(secure_ibex, icache_en);
+  processor_->set_mmu_capability(IMPL_MMU_SBARE);
+
+  processor_->get_state()->pc = start_pc;
+}
+
+void SpikeFastForward::AddMemory(uint32_t base, size_t size) {
+  auto new_mem = std::make_unique<mem_t>(size);
+  bus_.add_device(base, new_mem.get());
+  mems_.emplace_back(std::move(new_mem));
+}
+
+bool SpikeFastForward::WriteMemory(uint32_t addr, size_t len,
+                                   const uint8_t *data) {
+  return bus_.store(addr, len, data);
+}
+
+bool SpikeFastForward::ReadMemory(uint32_t addr, size_t len, uint8_t *data) {
+  return bus_.load(addr, len, data);
+}
+
+void SpikeFastForward::SetMmioWord(uint32_t addr, uint32_t value) {
+  mmio_words_[addr & ~3u] = value;
+}
+
+bool SpikeFastForward::LoadMmioFile(const std::string &path) {
+  std::ifstream file(path);
+  if (!file) {
+    std::cerr << "ERROR: Cannot read register values `" << path << "'."
+              << std::endl;
+    return false;
+  }
+
+  std::string line;
+  unsigned int line_num = 0;
+  while (std::getline(file, line)) {
+    ++line_num;
+    std::istringstream words(line);
+    std::string addr_str, value_str;
+    if (!(words >> addr_str) || addr_str[0] == '#') {
+      continue;
+    }
+    char *addr_end, *value_end;
+    unsigned long addr = strtoul(addr_str.c_str(), &addr_end, 0);
+    unsigned long value = 0;
+    bool ok = (words >> value_str) && !*addr_end;
+    if (ok) {
+      value = strtoul(value_str.c_str(), &value_end, 0);
+      ok = !*value_end;
+    }
+    if (!ok) {
+      std::cerr << "ERROR: " << path << ":" << line_num
+                << ": Expected an address and a value." << std::endl;
+      return false;
+    }
+    SetMmioWord(addr, value);
+  }
+  return true;
+}
+
+bool SpikeFastForward::Run(uint32_t stop_pc, uint64_t max_insns) {
+  state_t *state = processor_->get_state();
+  while ((state->pc & 0xffffffff) != stop_pc) {
+    if (insn_cnt_ >= max_insns) {
+      return false;
+    }
+    processor_->step(1);
+    ++insn_cnt_;
+  }
+  return true;
+}
+
+IbexArchState SpikeFastForward::GetArchState() const {
+  state_t *state = processor_->get_state();
+  if (state->debug_mode) {
+    throw std::runtime_error("Cannot hand over a hart in debug mode.");
+  }
+  if (state->prv != PRV_M) {
+    throw std::runtime_error("Cannot hand over a hart outside of M mode.");
+  }
+
+  IbexArchState arch_state;
+  arch_state.pc = state->pc & 0xffffffff;
+  for (int i = 0; i < 32; ++i) {
+    arch_state.gprs[i] = state->XPR[i] & 0xffffffff;
+  }
+
+  // Machine-mode trap setup and handling. Interrupts are masked in debug mode,
+  // so it is fine to set mstatus.MIE first.
+  std::vector<int> csrs = {CSR_MSTATUS, CSR_MIE, CSR_MTVEC,
+                           CSR_MSCRATCH, CSR_MEPC, CSR_MCAUSE,
+                           CSR_MTVAL, CSR_MCOUNTINHIBIT, CSR_CPUCTRLSTS};
+  // PMP addresses must be written before the configuration that may lock them,
+  // and mseccfg last since setting MML changes how the configuration is
+  // interpreted.
+  for (uint32_t i = 0; i < pmp_num_regions_; ++i) {
+    csrs.push_back(CSR_PMPADDR0 + i);
+  }
+  for (uint32_t i = 0; i < (pmp_num_regions_ + 3) / 4; ++i) {
+    csrs.push_back(CSR_PMPCFG0 + i);
+  }
+  csrs.push_back(CSR_MSECCFG);
+  // Counters, so that software sees time pass across the handover.
+  csrs.insert(csrs.end(),
+              {CSR_MCYCLE, CSR_MCYCLEH, CSR_MINSTRET, CSR_MINSTRETH});
+
+  for (int csr : csrs) {
+    arch_state.csrs.emplace_back(csr, processor_->get_csr(csr) & 0xffffffff);
+  }
+  return arch_state;
+}
+
+// Always return nullptr so all accesses go through mmio_load/mmio_store and
+// can fall back to the register model.
+char *SpikeFastForward::addr_to_mem(reg_t addr) { return nullptr; }
+
+bool SpikeFastForward::mmio_load(reg_t addr, size_t len, uint8_t *bytes) {
+  if (bus_.load(addr, len, bytes)) {
+    return true;
+  }
+  for (size_t i = 0; i < len; ++i) {
+    uint32_t byte_addr = addr + i;
+    auto it = mmio_words_.find(byte_addr & ~3u);
+    uint32_t word = it == mmio_words_.end() ? 0 : it->second;
+    bytes[i] = word >> (8 * (byte_addr & 3));
+  }
+  return true;
+}
+
+bool SpikeFastForward::mmio_store(reg_t addr, size_t len,
+                                  const uint8_t *bytes) {
+  if (bus_.store(addr, len, bytes)) {
+    return true;
+  }
+  for (size_t i = 0; i < len; ++i) {
+    uint32_t byte_addr = addr + i;
+    uint32_t shift = 8 * (byte_addr & 3);
+    uint32_t &word = mmio_words_[byte_addr & ~3u];
+    word = (word & ~(0xffu << shift)) | (uint32_t(bytes[i]) << shift);
+  }
+  return true;
+}
+
+void SpikeFastForward::proc_reset(unsigned id) {}
+
+const char *SpikeFastForward::get_symbol(uint64_t addr) { return nullptr; }
@@ -0,0 +1,113 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OPENTITAN_HW_DV_VERILATOR_SPIKE_FAST_FORWARD_CPP_SPIKE_FAST_FORWARD_H_
+#define OPENTITAN_HW_DV_VERILATOR_SPIKE_FAST_FORWARD_CPP_SPIKE_FAST_FORWARD_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "riscv/devices.h"
+#include "riscv/processor.h"
+#include "riscv/simif.h"
+
+/**
+ * Architectural state of an Ibex hart, as handed over from Spike to the RTL
+ */
+struct IbexArchState {
+  uint32_t pc;
+  uint32_t gprs[32];
+  // CSRs, in the order in which they must be written to the RTL.
+  std::vector<std::pair<uint16_t, uint32_t>> csrs;
+};
+
+/**
+ * Runs software on Spike up to a given point, as a fast replacement for the
+ * start of a cycle-accurate simulation
+ *
+ * Memories are modelled as flat arrays. All other accesses go to a simple
+ * register model: a store sets the addressed word, a load returns the last
+ * value stored or preset with SetMmioWord(), and zero otherwise. This is
+ * enough for code that mostly configures peripherals, but code that polls
+ * status bits set by hardware needs those bits preset.
+ *
+ * The processor runs in M mode and is configured like the Ibex of the
+ * simulated top. Interrupts are never raised.
+ */
+class SpikeFastForward : public simif_t {
+ public:
+  SpikeFastForward(const std::string &isa_string, uint32_t start_pc,
+                   bool secure_ibex, bool icache_en, uint32_t pmp_num_regions,
+                   uint32_t pmp_granularity, uint32_t mhpm_counter_num);
+
+  /**
+   * Add a memory of size bytes at base
+   */
+  void AddMemory(uint32_t base, size_t size);
+
+  /**
+   * Access memory contents without going through the processor
+   *
+   * @return false if the range is not (entirely) in a memory
+   */
+  bool WriteMemory(uint32_t addr, size_t len, const uint8_t *data);
+  bool ReadMemory(uint32_t addr, size_t len, uint8_t *data);
+
+  /**
+   * Preset a word of the register model
+   */
+  void SetMmioWord(uint32_t addr, uint32_t value);
+
+  /**
+   * Preset words of the register model from a file
+   *
+   * Each non-empty line not starting with '#' holds an address and a value,
+   * both in C syntax (e.g. "0x40000010 0x1").
+   *
+   * @return false if the file cannot be read or parsed
+   */
+  bool LoadMmioFile(const std::string &path);
+
+  /**
+   * Execute instructions until the PC reaches stop_pc or max_insns have been
+   * executed
+   *
+   * @return true if stop_pc was reached
+   */
+  bool Run(uint32_t stop_pc, uint64_t max_insns);
+
+  /**
+   * Get the state that must be restored in the RTL to continue execution at
+   * the current PC
+   *
+   * The mcycle and minstret counters are set from the number of executed
+   * instructions. Throws a std::runtime_error if the hart is in a state that
+   * cannot be handed over (not in M mode or in debug mode).
+   */
+  IbexArchState GetArchState() const;
+
+  uint64_t GetInsnCount() const { return insn_cnt_; }
+
+  // simif_t implementation
+  char *addr_to_mem(reg_t addr) override;
+  bool mmio_load(reg_t addr, size_t len, uint8_t *bytes) override;
+  bool mmio_store(reg_t addr, size_t len, const uint8_t *bytes) override;
+  void proc_reset(unsigned id) override;
+  const char *get_symbol(uint64_t addr) override;
+
+ private:
+  std::unique_ptr<isa_parser_t> isa_parser_;
+  std::unique_ptr<processor_t> processor_;
+  bus_t bus_;
+  std::vector<std::unique_ptr<mem_t>> mems_;
+  std::map<uint32_t, uint32_t> mmio_words_;
+  uint32_t pmp_num_regions_;
+  uint64_t insn_cnt_;
+};
+
+#endif  // OPENTITAN_HW_DV_VERILATOR_SPIKE_FAST_FORWARD_CPP_SPIKE_FAST_FORWARD_H_
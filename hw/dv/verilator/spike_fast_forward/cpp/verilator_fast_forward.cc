@@ -0,0 +1,360 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "verilator_fast_forward.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <getopt.h>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "dmidpi.h"
+#include "sv_scoped.h"
+
+// DPI export, defined in dmidpi.sv
+extern "C" {
+void *dmidpi_get_ctx();
+}
+
+namespace {
+// DMI operations
+const uint32_t kDmiOpRead = 1;
+const uint32_t kDmiOpWrite = 2;
+
+// Debug module registers and fields, see the RISC-V External Debug Support
+// specification, version 0.13.
+const uint32_t kDmData0 = 0x04;
+const uint32_t kDmControl = 0x10;
+const uint32_t kDmStatus = 0x11;
+const uint32_t kDmAbstractcs = 0x16;
+const uint32_t kDmCommand = 0x17;
+const uint32_t kDmProgbuf0 = 0x20;
+
+const uint32_t kDmControlDmactive = 1u << 0;
+const uint32_t kDmControlResumereq = 1u << 30;
+const uint32_t kDmControlHaltreq = 1u << 31;
+const uint32_t kDmStatusAllhalted = 1u << 9;
+const uint32_t kDmStatusAllresumeack = 1u << 17;
+const uint32_t kAbstractcsCmderr = 7u << 8;
+const uint32_t kAbstractcsBusy = 1u << 12;
+const uint32_t kCommandWrite = 1u << 16;
+const uint32_t kCommandTransfer = 1u << 17;
+const uint32_t kCommandPostexec = 1u << 18;
+const uint32_t kCommandAarsize32 = 2u << 20;
+
+const uint16_t kRegnoGpr0 = 0x1000;
+const uint16_t kCsrDpc = 0x7b1;
+
+const uint32_t kInsnFenceI = 0x0000100f;
+const uint32_t kInsnEbreak = 0x00100073;
+
+// The hart can only halt once the hardware has finished its boot checks and
+// enabled instruction fetch, which takes a while.
+const unsigned long kHaltTimeoutCycles = 10000000;
+const unsigned long kStepTimeoutCycles = 10000;
+}  // namespace
+
+static void PrintHelp() {
+  std::cout << "Spike fast-forward:\n\n"
+               "--fast-forward-to=PC\n"
+               "  Run the software on Spike up to PC, then hand over to the\n"
+               "  simulated hart\n\n"
+               "--fast-forward-elf=FILE\n"
+               "  Load ELF file FILE into the memories of Spike (may be given\n"
+               "  several times)\n\n"
+               "--fast-forward-max-insns=N\n"
+               "  Fail if PC is not reached within N instructions\n"
+               "  (default: 100000000)\n\n"
+               "--fast-forward-mmio=FILE\n"
+               "  Preset the register values seen by Spike from FILE, which\n"
+               "  holds an address and a value per line\n\n"
+               "-h|--help\n"
+               "  Show help\n\n";
+}
+
+VerilatorFastForward::VerilatorFastForward(VerilatorSimCtrl &simctrl,
+                                           const HartConfig &hart,
+                                           const std::string &dmi_scope)
+    : simctrl_(simctrl),
+      hart_(hart),
+      dmi_scope_(dmi_scope),
+      enabled_(false),
+      stop_pc_(0),
+      max_insns_(100000000),
+      dmi_ctx_(nullptr),
+      next_step_(0),
+      waiting_(false),
+      step_cycles_(0) {}
+
+void VerilatorFastForward::AddMemory(const std::string &name, uint32_t base,
+                                     const MemArea *mem_area, bool write_back) {
+  images_.RegisterMemoryArea(name, base, mem_area);
+  memories_.push_back({name, base, mem_area, write_back});
+}
+
+bool VerilatorFastForward::ParseCLIArguments(int argc, char **argv,
+                                             bool &exit_app) {
+  const struct option long_options[] = {
+      {"fast-forward-to", required_argument, nullptr, 'T'},
+      {"fast-forward-elf", required_argument, nullptr, 'F'},
+      {"fast-forward-max-insns", required_argument, nullptr, 'N'},
+      {"fast-forward-mmio", required_argument, nullptr, 'M'},
+      {"help", no_argument, nullptr, 'h'},
+      {nullptr, no_argument, nullptr, 0}};
+
+  // Reset the command parsing index in-case other utils have already parsed
+  // some arguments
+  optind = 1;
+  while (1) {
+    int c = getopt_long(argc, argv, "-:h", long_options, nullptr);
+    if (c == -1) {
+      break;
+    }
+
+    // Disable error reporting by getopt
+    opterr = 0;
+
+    switch (c) {
+      case 0:
+      case 1:
+        break;
+      case 'T': {
+        char *end;
+        unsigned long pc = strtoul(optarg, &end, 0);
+        if (*end || pc > UINT32_MAX) {
+          std::cerr << "ERROR: Bad format for fast-forward PC: `" << optarg
+                    << "'." << std::endl;
+          return false;
+        }
+        stop_pc_ = pc;
+        enabled_ = true;
+        break;
+      }
+      case 'F':
+        elf_paths_.push_back(optarg);
+        break;
+      case 'N': {
+        char *end;
+        max_insns_ = strtoull(optarg, &end, 0);
+        if (*end) {
+          std::cerr << "ERROR: Bad format for instruction limit: `" << optarg
+                    << "'." << std::endl;
+          return false;
+        }
+        break;
+      }
+      case 'M':
+        mmio_path_ = optarg;
+        break;
+      case 'h':
+        PrintHelp();
+        return true;
+      case ':':  // missing argument
+        std::cerr << "ERROR: Missing argument." << std::endl << std::endl;
+        return false;
+      case '?':
+      default:;
+        // Ignore unrecognized options since they might be consumed by
+        // other utils
+    }
+  }
+
+  if (enabled_ && elf_paths_.empty()) {
+    std::cerr << "ERROR: --fast-forward-to needs at least one "
+                 "--fast-forward-elf."
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+void VerilatorFastForward::PreExec() {
+  if (!enabled_) {
+    return;
+  }
+  try {
+    FastForward();
+  } catch (const std::exception &err) {
+    Fail(err.what());
+  }
+}
+
+void VerilatorFastForward::FastForward() {
+  SpikeFastForward spike(hart_.isa_string, hart_.boot_pc, hart_.secure_ibex,
+                         hart_.icache_en, hart_.pmp_num_regions,
+                         hart_.pmp_granularity, hart_.mhpm_counter_num);
+  for (const Memory &mem : memories_) {
+    spike.AddMemory(mem.base, mem.mem_area->GetSizeBytes());
+  }
+
+  for (const std::string &path : elf_paths_) {
+    images_.StageElf(false, path);
+    for (const Memory &mem : memories_) {
+      for (const auto &seg_pr : images_.GetMemoryData(mem.name).GetSegs()) {
+        const std::vector<uint8_t> &seg_data = seg_pr.second;
+        if (!spike.WriteMemory(mem.base + seg_pr.first.lo, seg_data.size(),
+                               seg_data.data())) {
+          throw std::runtime_error("Cannot load `" + path + "' into Spike.");
+        }
+      }
+    }
+  }
+
+  if (!mmio_path_.empty() && !spike.LoadMmioFile(mmio_path_)) {
+    throw std::runtime_error("Cannot load register values.");
+  }
+
+  auto time_begin = std::chrono::steady_clock::now();
+  bool reached = spike.Run(stop_pc_, max_insns_);
+  auto time_end = std::chrono::steady_clock::now();
+  if (!reached) {
+    std::ostringstream oss;
+    oss << "PC 0x" << std::hex << stop_pc_ << " not reached within " << std::dec
+        << max_insns_ << " instructions.";
+    throw std::runtime_error(oss.str());
+  }
+  std::cout << "Fast-forwarded " << spike.GetInsnCount()
+            << " instructions on Spike to PC 0x" << std::hex << stop_pc_
+            << std::dec << " in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(
+                   time_end - time_begin)
+                   .count()
+            << " ms." << std::endl;
+
+  IbexArchState state = spike.GetArchState();
+
+  for (const Memory &mem : memories_) {
+    if (!mem.write_back) {
+      continue;
+    }
+    std::vector<uint8_t> data(mem.mem_area->GetSizeBytes());
+    spike.ReadMemory(mem.base, data.size(), data.data());
+    mem.mem_area->Write(0, data);
+  }
+
+  // Halt the hart as soon as it starts fetching, restore the state and resume
+  // at the PC reached by Spike.
+  steps_.clear();
+  steps_.push_back({DmiStep::kWrite, kDmControl, kDmControlDmactive, 0,
+                    kStepTimeoutCycles, "activate the debug module"});
+  steps_.push_back({DmiStep::kWrite, kDmControl,
+                    kDmControlHaltreq | kDmControlDmactive, 0,
+                    kStepTimeoutCycles, "request a halt"});
+  steps_.push_back({DmiStep::kPoll, kDmStatus, kDmStatusAllhalted,
+                    kDmStatusAllhalted, kHaltTimeoutCycles, "halt the hart"});
+  steps_.push_back({DmiStep::kWrite, kDmControl, kDmControlDmactive, 0,
+                    kStepTimeoutCycles, "clear the halt request"});
+
+  for (const auto &csr : state.csrs) {
+    std::ostringstream oss;
+    oss << "write CSR 0x" << std::hex << csr.first;
+    AddAbstractWrite(csr.first, csr.second, oss.str());
+  }
+  AddAbstractWrite(kCsrDpc, state.pc, "write dpc");
+  for (int i = 1; i < 32; ++i) {
+    AddAbstractWrite(kRegnoGpr0 + i, state.gprs[i],
+                     "write x" + std::to_string(i));
+  }
+
+  // Memories were written behind the back of the instruction cache.
+  steps_.push_back({DmiStep::kWrite, kDmProgbuf0, kInsnFenceI, 0,
+                    kStepTimeoutCycles, "write the program buffer"});
+  steps_.push_back({DmiStep::kWrite, kDmProgbuf0 + 1, kInsnEbreak, 0,
+                    kStepTimeoutCycles, "write the program buffer"});
+  steps_.push_back({DmiStep::kWrite, kDmCommand,
+                    kCommandAarsize32 | kCommandPostexec, 0, kStepTimeoutCycles,
+                    "run fence.i"});
+  steps_.push_back({DmiStep::kPoll, kDmAbstractcs, 0, kAbstractcsBusy,
+                    kStepTimeoutCycles, "run fence.i"});
+  steps_.push_back({DmiStep::kCheck, kDmAbstractcs, 0, kAbstractcsCmderr,
+                    kStepTimeoutCycles, "run fence.i"});
+
+  steps_.push_back({DmiStep::kWrite, kDmControl,
+                    kDmControlResumereq | kDmControlDmactive, 0,
+                    kStepTimeoutCycles, "request a resume"});
+  steps_.push_back({DmiStep::kPoll, kDmStatus, kDmStatusAllresumeack,
+                    kDmStatusAllresumeack, kStepTimeoutCycles,
+                    "resume the hart"});
+  steps_.push_back({DmiStep::kWrite, kDmControl, kDmControlDmactive, 0,
+                    kStepTimeoutCycles, "clear the resume request"});
+  next_step_ = 0;
+}
+
+void VerilatorFastForward::AddAbstractWrite(uint16_t regno, uint32_t value,
+                                            const std::string &desc) {
+  steps_.push_back(
+      {DmiStep::kWrite, kDmData0, value, 0, kStepTimeoutCycles, desc});
+  steps_.push_back({DmiStep::kWrite, kDmCommand,
+                    kCommandAarsize32 | kCommandTransfer | kCommandWrite |
+                        regno,
+                    0, kStepTimeoutCycles, desc});
+  steps_.push_back({DmiStep::kPoll, kDmAbstractcs, 0, kAbstractcsBusy,
+                    kStepTimeoutCycles, desc});
+  steps_.push_back({DmiStep::kCheck, kDmAbstractcs, 0, kAbstractcsCmderr,
+                    kStepTimeoutCycles, desc});
+}
+
+void VerilatorFastForward::OnClock(unsigned long sim_time) {
+  if (next_step_ >= steps_.size()) {
+    return;
+  }
+  if (!dmi_ctx_) {
+    dmi_ctx_ = GetDmiCtx();
+    if (!dmi_ctx_) {
+      return;
+    }
+  }
+
+  const DmiStep &step = steps_[next_step_];
+  if (++step_cycles_ > step.timeout) {
+    Fail("Timed out trying to " + step.desc + ".");
+    return;
+  }
+
+  if (!waiting_) {
+    uint32_t op = step.kind == DmiStep::kWrite ? kDmiOpWrite : kDmiOpRead;
+    waiting_ = dmidpi_local_req(dmi_ctx_, step.addr, op, step.data);
+    return;
+  }
+
+  uint32_t data, resp;
+  if (!dmidpi_local_rsp(dmi_ctx_, &data, &resp)) {
+    return;
+  }
+  waiting_ = false;
+
+  if (resp != 0) {
+    Fail("DMI access failed trying to " + step.desc + ".");
+    return;
+  }
+  if (step.kind != DmiStep::kWrite && (data & step.mask) != step.data) {
+    if (step.kind == DmiStep::kCheck) {
+      std::ostringstream oss;
+      oss << "Cannot " << step.desc << " (read 0x" << std::hex << data
+          << " from debug module register 0x" << step.addr << ").";
+      Fail(oss.str());
+    }
+    return;
+  }
+
+  step_cycles_ = 0;
+  if (++next_step_ == steps_.size()) {
+    std::cout << "Fast-forward: Handed over to the simulated hart."
+              << std::endl;
+  }
+}
+
+void *VerilatorFastForward::GetDmiCtx() const {
+  SVScoped scoped(dmi_scope_);
+  return dmidpi_get_ctx();
+}
+
+void VerilatorFastForward::Fail(const std::string &msg) {
+  std::cerr << "ERROR: Fast-forward: " << msg << std::endl;
+  steps_.clear();
+  simctrl_.RequestStop(false);
+}
@@ -0,0 +1,138 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OPENTITAN_HW_DV_VERILATOR_SPIKE_FAST_FORWARD_CPP_VERILATOR_FAST_FORWARD_H_
+#define OPENTITAN_HW_DV_VERILATOR_SPIKE_FAST_FORWARD_CPP_VERILATOR_FAST_FORWARD_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dpi_memutil.h"
+#include "sim_ctrl_extension.h"
+#include "spike_fast_forward.h"
+#include "verilator_sim_ctrl.h"
+
+/**
+ * Skips the start of a simulation by running it on Spike
+ *
+ * When enabled with --fast-forward-to, the software images given with
+ * --fast-forward-elf are run on Spike (see SpikeFastForward) from the boot
+ * address up to the given PC. The simulation then starts as usual, but the
+ * hart is halted through the debug module before it executes its first
+ * instruction, and the state reached by Spike is restored:
+ *
+ * - The contents of memories registered with write_back set are written to the
+ *   RTL memories before the simulation starts.
+ * - GPRs and CSRs (see SpikeFastForward::GetArchState()) are written with
+ *   abstract commands, dpc is set to the PC reached by Spike and the hart
+ *   resumes from there after a fence.i.
+ *
+ * Peripheral state is not transferred: peripherals start out of reset, and
+ * the software run on Spike only sees the register model of SpikeFastForward.
+ * This is meant for tests that skip boot stages whose side effects on
+ * peripherals they do not depend on.
+ *
+ * The debug module must be reachable through a dmidpi instance, and the life
+ * cycle state must enable debug access.
+ */
+class VerilatorFastForward : public SimCtrlExtension {
+ public:
+  /**
+   * Configuration of the simulated hart, see SpikeFastForward
+   */
+  struct HartConfig {
+    std::string isa_string;
+    uint32_t boot_pc;
+    bool secure_ibex;
+    bool icache_en;
+    uint32_t pmp_num_regions;
+    uint32_t pmp_granularity;
+    uint32_t mhpm_counter_num;
+  };
+
+  /**
+   * @param simctrl Simulation controller, used to stop the simulation if the
+   *                handover fails
+   * @param hart Configuration of the simulated hart
+   * @param dmi_scope SystemVerilog scope of the dmidpi instance connected to
+   *                  the debug module
+   */
+  VerilatorFastForward(VerilatorSimCtrl &simctrl, const HartConfig &hart,
+                       const std::string &dmi_scope);
+
+  /**
+   * Model a memory in Spike
+   *
+   * The memory has the size of mem_area, and ELF segments are placed into it
+   * by LMA. If write_back is true, its contents after the fast-forward are
+   * written to mem_area. This function does not take ownership of mem_area,
+   * which must outlive this object.
+   */
+  void AddMemory(const std::string &name, uint32_t base,
+                 const MemArea *mem_area, bool write_back);
+
+  // Declared in SimCtrlExtension
+  bool ParseCLIArguments(int argc, char **argv, bool &exit_app) override;
+  void PreExec() override;
+  void OnClock(unsigned long sim_time) override;
+
+ private:
+  // A step of the handover through the debug module. kWrite steps write data
+  // to addr. kPoll steps read addr until (value & mask) == data, for at most
+  // timeout cycles. kCheck steps read addr once and fail unless it matches.
+  struct DmiStep {
+    enum Kind { kWrite, kPoll, kCheck } kind;
+    uint32_t addr;
+    uint32_t data;
+    uint32_t mask;
+    unsigned long timeout;
+    std::string desc;
+  };
+
+  struct Memory {
+    std::string name;
+    uint32_t base;
+    const MemArea *mem_area;
+    bool write_back;
+  };
+
+  VerilatorSimCtrl &simctrl_;
+  HartConfig hart_;
+  std::string dmi_scope_;
+  std::vector<Memory> memories_;
+  DpiMemUtil images_;
+
+  bool enabled_;
+  uint32_t stop_pc_;
+  uint64_t max_insns_;
+  std::vector<std::string> elf_paths_;
+  std::string mmio_path_;
+
+  void *dmi_ctx_;
+  std::vector<DmiStep> steps_;
+  size_t next_step_;
+  bool waiting_;
+  unsigned long step_cycles_;
+
+  /**
+   * Run Spike up to the stop PC and prepare the handover
+   *
+   * Throws a std::runtime_error on failure.
+   */
+  void FastForward();
+
+  void AddAbstractWrite(uint16_t regno, uint32_t value,
+                        const std::string &desc);
+
+  /**
+   * Get the dmidpi context, or nullptr if its initial block hasn't run yet
+   */
+  void *GetDmiCtx() const;
+
+  void Fail(const std::string &msg);
+};
+
+#endif  // OPENTITAN_HW_DV_VERILATOR_SPIKE_FAST_FORWARD_CPP_VERILATOR_FAST_FORWARD_H_
@@ -2,13 +2,16 @@
 // Licensed under the Apache License, Version 2.0, see LICENSE for details.
 // SPDX-License-Identifier: Apache-2.0
 
+#include <cstdlib>
 #include <fstream>
 #include <getopt.h>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <svdpi.h>
+#include <vector>
 
 #include "Votbn_top_sim__Syms.h"
 #include "log_trace_listener.h"
@@ -99,6 +102,335 @@ class OtbnTraceUtil : public SimCtrlExtension {
 static otbn_top_sim *verilator_top;
 static OtbnMemUtil otbn_memutil("TOP.otbn_top_sim");
 
+// Check the outcome of the program that has just finished: the model and
+// the RTL must agree, and the model must have stopped at the expected end
+// address from the ELF file (if there is one). Prints a message to stderr
+// and returns false on failure.
+static bool CheckRunResult() {
+  {
+    SVScoped top_scope("TOP.otbn_top_sim");
+    if (otbn_err_get()) {
+      return false;
+    }
+  }
+
+  int exp_stop_pc = otbn_memutil.GetExpEndAddr();
+  if (exp_stop_pc >= 0) {
+    SVScoped core_scope("TOP.otbn_top_sim.u_otbn_core_model");
+    int act_stop_pc = otbn_core_get_stop_pc();
+    if (exp_stop_pc != act_stop_pc) {
+      std::cerr << "ERROR: Expected stop PC from ELF file was 0x" << std::hex
+                << exp_stop_pc << ", but simulation actually stopped at 0x"
+                << act_stop_pc << std::dec << ".\n";
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * SimCtrlExtension that adds a '--otbn-batch' command line option. If set, it
+ * runs each ELF file listed in the given manifest in turn, resetting the design
+ * between them. The Verilated model and the ISS process are reused, so a batch
+ * of binaries only pays for starting up the simulation once.
+ *
+ * The result of each run can be written to a summary file with
+ * '--otbn-batch-summary'. This has one JSON object per line, with the path of
+ * the ELF file, a status ("pass", "fail", "timeout" or "error" if the ELF file
+ * could not be loaded) and the number of cycles since reset.
+ */
+class OtbnBatchUtil : public SimCtrlExtension {
+ private:
+  // Number of cycles that reset is asserted for between binaries
+  static constexpr unsigned int kResetCycles = 5;
+
+  struct RunResult {
+    std::string elf_path;
+    std::string status;
+    unsigned long cycles;
+  };
+
+  CData *sig_rst_n_;
+  std::vector<std::string> elf_paths_;
+  std::vector<RunResult> results_;
+  std::string summary_path_;
+  unsigned long timeout_ = 0;
+
+  // Clock cycles since the current binary came out of reset
+  unsigned long cycles_ = 0;
+  // Set once the current binary has finished, until the next one is started
+  bool run_ended_ = false;
+  // Clock cycles of reset left before the next binary starts
+  unsigned int reset_cycles_left_ = 0;
+
+  void PrintHelp() {
+    std::cout << "Batch mode:\n\n"
+                 "--otbn-batch=FILE\n"
+                 "  Run each ELF file listed in FILE (one path per line) in "
+                 "turn\n\n"
+                 "--otbn-batch-summary=FILE\n"
+                 "  Write the result of each run to FILE (JSON lines)\n\n"
+                 "--otbn-batch-timeout=N\n"
+                 "  Fail a binary that is still running after N cycles and "
+                 "move on\n  to the next one\n\n";
+  }
+
+  bool ReadManifest(const std::string &path) {
+    std::ifstream manifest(path);
+    if (!manifest) {
+      std::cerr << "ERROR: Cannot open batch manifest `" << path << "'.\n";
+      return false;
+    }
+
+    std::string line;
+    while (std::getline(manifest, line)) {
+      size_t start = line.find_first_not_of(" \t\r");
+      if (start == std::string::npos || line[start] == '#') {
+        continue;
+      }
+      size_t end = line.find_last_not_of(" \t\r");
+      elf_paths_.push_back(line.substr(start, end + 1 - start));
+    }
+
+    if (elf_paths_.empty()) {
+      std::cerr << "ERROR: Batch manifest `" << path
+                << "' doesn't list any ELF files.\n";
+      return false;
+    }
+    return true;
+  }
+
+  void RecordResult(const std::string &status) {
+    const std::string &elf_path = elf_paths_[results_.size()];
+    std::cout << "Batch: " << status << " after " << cycles_ << " cycles: `"
+              << elf_path << "'" << std::endl;
+    results_.push_back({elf_path, status, cycles_});
+  }
+
+  // Load the next binary that can be loaded into the memories, recording an
+  // error for any that can't. Returns false if there are no binaries left.
+  bool LoadNext() {
+    while (results_.size() < elf_paths_.size()) {
+      const std::string &elf_path = elf_paths_[results_.size()];
+      std::cout << "Batch: Loading `" << elf_path << "' ("
+                << results_.size() + 1 << " of " << elf_paths_.size() << ")"
+                << std::endl;
+      try {
+        // Start from the same (blank) memories as a fresh simulation, so the
+        // result doesn't depend on what ran before. The model reads both
+        // memories back from the design when it starts. Write zeros through
+        // the scrambled memory areas (not MemArea::Fill(), which sets the raw
+        // physical words), so they descramble to zero with valid integrity.
+        for (bool is_imem : {true, false}) {
+          const ScrambledEcc32MemArea &mem_area =
+              otbn_memutil.GetMemArea(is_imem);
+          mem_area.Write(0, std::vector<uint8_t>(mem_area.GetSizeBytes(), 0));
+        }
+        otbn_memutil.LoadElf(elf_path);
+        return true;
+      } catch (const std::exception &err) {
+        std::cerr << "ERROR: " << err.what() << std::endl;
+        cycles_ = 0;
+        RecordResult("error");
+      }
+    }
+    return false;
+  }
+
+  void WriteSummary() const {
+    std::ofstream summary(summary_path_);
+    if (!summary) {
+      std::cerr << "ERROR: Cannot write batch summary to `" << summary_path_
+                << "'.\n";
+      return;
+    }
+    for (const RunResult &result : results_) {
+      summary << "{\"elf\": \"" << JsonEscape(result.elf_path)
+              << "\", \"status\": \"" << result.status
+              << "\", \"cycles\": " << result.cycles << "}\n";
+    }
+  }
+
+  static std::string JsonEscape(const std::string &str) {
+    std::ostringstream oss;
+    for (char c : str) {
+      if (c == '"' || c == '\\') {
+        oss << '\\' << c;
+      } else if ((unsigned char)c < 0x20) {
+        oss << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+            << (int)c;
+      } else {
+        oss << c;
+      }
+    }
+    return oss.str();
+  }
+
+  // Called once the current binary has finished one way or another. Starts
+  // the next binary or, if there are none left, stops the simulation.
+  void EndRun(const std::string &status) {
+    RecordResult(status);
+    run_ended_ = true;
+    if (results_.size() == elf_paths_.size()) {
+      VerilatorSimCtrl::GetInstance().RequestStop(AllPassed());
+    }
+  }
+
+ public:
+  OtbnBatchUtil(CData *sig_rst_n) : sig_rst_n_(sig_rst_n) {}
+
+  bool Enabled() const { return !elf_paths_.empty(); }
+
+  bool AllPassed() const {
+    if (results_.size() != elf_paths_.size()) {
+      return false;
+    }
+    for (const RunResult &result : results_) {
+      if (result.status != "pass") {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Handle the end of the current binary, as signalled by the design. If
+  // failed is true, the design has seen a mismatch between the RTL and the
+  // model. Does nothing if the run has already ended, since the design keeps
+  // signalling until it is reset.
+  void OnRunEnd(bool failed) {
+    if (run_ended_) {
+      return;
+    }
+    EndRun((!failed && CheckRunResult()) ? "pass" : "fail");
+  }
+
+  virtual bool ParseCLIArguments(int argc, char **argv, bool &exit_app) {
+    const struct option long_options[] = {
+        {"otbn-batch", required_argument, nullptr, 'b'},
+        {"otbn-batch-summary", required_argument, nullptr, 's'},
+        {"otbn-batch-timeout", required_argument, nullptr, 't'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, no_argument, nullptr, 0}};
+
+    std::string manifest_path;
+
+    // Reset the command parsing index in-case other utils have already parsed
+    // some arguments
+    optind = 1;
+    while (1) {
+      int c = getopt_long(argc, argv, "-:h", long_options, nullptr);
+      if (c == -1) {
+        break;
+      }
+
+      switch (c) {
+        case 0:
+        case 1:
+          break;
+        case 'b':
+          manifest_path = optarg;
+          break;
+        case 's':
+          summary_path_ = optarg;
+          break;
+        case 't': {
+          char *end;
+          timeout_ = strtoul(optarg, &end, 0);
+          if (!*optarg || *end) {
+            std::cerr << "ERROR: Bad batch timeout: `" << optarg << "'.\n";
+            return false;
+          }
+        } break;
+        case 'h':
+          PrintHelp();
+          break;
+      }
+    }
+
+    if (manifest_path.empty()) {
+      return true;
+    }
+
+    if (!ReadManifest(manifest_path)) {
+      return false;
+    }
+
+    if (!LoadNext()) {
+      std::cerr << "ERROR: None of the binaries in the batch could be "
+                   "loaded.\n";
+      return false;
+    }
+    return true;
+  }
+
+  virtual void OnClock(unsigned long sim_time) {
+    if (!Enabled() || results_.size() == elf_paths_.size()) {
+      return;
+    }
+
+    // Hold reset for the next binary, then let it run.
+    if (reset_cycles_left_ > 0) {
+      if (--reset_cycles_left_ == 0) {
+        *sig_rst_n_ = 1;
+      }
+      return;
+    }
+
+    // The first binary starts with the simulation's own reset.
+    if (!*sig_rst_n_) {
+      cycles_ = 0;
+      return;
+    }
+
+    if (run_ended_) {
+      run_ended_ = false;
+      cycles_ = 0;
+      if (!LoadNext()) {
+        VerilatorSimCtrl::GetInstance().RequestStop(AllPassed());
+        return;
+      }
+      // Resetting the design also resets the model (but doesn't restart the
+      // ISS process).
+      *sig_rst_n_ = 0;
+      reset_cycles_left_ = kResetCycles;
+      return;
+    }
+
+    ++cycles_;
+    if (timeout_ && cycles_ >= timeout_) {
+      std::cerr << "ERROR: Binary still running after " << timeout_
+                << " cycles.\n";
+      EndRun("timeout");
+    }
+  }
+
+  virtual void PostExec() {
+    if (!Enabled()) {
+      return;
+    }
+
+    // Account for any binaries that didn't get to run because the whole
+    // simulation stopped.
+    while (results_.size() < elf_paths_.size()) {
+      results_.push_back({elf_paths_[results_.size()], "not run", 0});
+    }
+
+    unsigned int num_passed = 0;
+    for (const RunResult &result : results_) {
+      num_passed += result.status == "pass";
+    }
+    std::cout << "Batch: " << num_passed << " of " << results_.size()
+              << " binaries passed." << std::endl;
+
+    if (!summary_path_.empty()) {
+      WriteSummary();
+    }
+  }
+};
+
+static OtbnBatchUtil *batchutil_ptr;
+
 int main(int argc, char **argv) {
   VerilatorMemUtil memutil(&otbn_memutil);
   OtbnTraceUtil traceutil;
@@ -110,11 +442,15 @@ int main(int argc, char **argv) {
   // running in atexit hooks.
   verilator_top = &top;
 
+  OtbnBatchUtil batchutil(&top.IO_RST_N);
+  batchutil_ptr = &batchutil;
+
   VerilatorSimCtrl &simctrl = VerilatorSimCtrl::GetInstance();
   simctrl.SetTop(&top, &top.IO_CLK, &top.IO_RST_N,
                  VerilatorSimCtrlFlags::ResetPolarityNegative);
   simctrl.RegisterExtension(&memutil);
   simctrl.RegisterExtension(&traceutil);
+  simctrl.RegisterExtension(&batchutil);
 
   std::cout << "Simulation of OTBN" << std::endl
             << "==================" << std::endl
@@ -128,32 +464,36 @@ int main(int argc, char **argv) {
     return ret_code;
   }
 
-  svSetScope(svGetScopeFromName("TOP.otbn_top_sim"));
-
-  svBit model_err = otbn_err_get();
-  if (model_err) {
-    return 1;
+  if (batchutil.Enabled()) {
+    return batchutil.AllPassed() ? 0 : 1;
   }
 
-  int exp_stop_pc = otbn_memutil.GetExpEndAddr();
-  if (exp_stop_pc >= 0) {
-    SVScoped core_scope("TOP.otbn_top_sim.u_otbn_core_model");
-    int act_stop_pc = otbn_core_get_stop_pc();
-    if (exp_stop_pc != act_stop_pc) {
-      std::cerr << "ERROR: Expected stop PC from ELF file was 0x" << std::hex
-                << exp_stop_pc << ", but simulation actually stopped at 0x"
-                << act_stop_pc << ".\n";
-      return 1;
-    }
-  }
+  return CheckRunResult() ? 0 : 1;
+}
 
+// This is executed over DPI when the current program has finished (failed is
+// zero) or the design has seen a mismatch (failed is nonzero). Returns 1 if
+// the simulation should end as usual, or 0 if it will move on to the next
+// binary in a batch.
+extern "C" svBit OtbnTopEndRun(svBit failed) {
+  if (!batchutil_ptr || !batchutil_ptr->Enabled()) {
+    return 1;
+  }
+  batchutil_ptr->OnRunEnd(failed);
   return 0;
 }
 
+// Iteration counts of the loops that the RTL is currently running, innermost
+// last. This is tracked by OtbnTopApplyLoopWarp.
+static std::vector<uint32_t> loop_count_stack;
+
 // This is executed over DPI on the first posedge of the clock after each
 // reset. It's in charge of telling the model about any loop warp symbols in
 // the ELF file.
 extern "C" int OtbnTopInstallLoopWarps() {
+  // A previous run (in batch mode) might have stopped in the middle of a loop.
+  loop_count_stack.clear();
+
   // Cast to the right base class of otbn_top_sim. Otherwise, you can't access
   // the "otbn_top_sim" member because you get the derived class's constructor
   // by accident.
@@ -231,8 +571,6 @@ auto get_loop_counter(LoopControllerT *loop_controller, uint32_t counter_idx)
 // updating the top of the loop stack if necessary to match loop warp symbols
 // in the ELF file.
 extern "C" void OtbnTopApplyLoopWarp() {
-  static std::vector<uint32_t> loop_count_stack;
-
   // See not in OtbnTopInstallLoopWarps for why this upcast is needed.
   Votbn_top_sim &top = *verilator_top;
 
@@ -332,6 +332,9 @@ module otbn_top_sim (
     .alert_o          (                         )
   );
 
+  // Defined in otbn_top_sim.cc
+  import "DPI-C" context function bit OtbnTopEndRun(bit failed);
+
   // When OTBN is done let a few more cycles run then finish simulation
   logic [1:0] finish_counter;
 
@@ -348,7 +351,9 @@ module otbn_top_sim (
       end
 
       if (finish_counter == 2'd3) begin
-        $finish;
+        // In batch mode, otbn_top_sim.cc resets the design and moves on to the next binary rather
+        // than ending the simulation.
+        if (OtbnTopEndRun(1'b0)) $finish;
       end
     end
   end
@@ -454,7 +459,7 @@ module otbn_top_sim (
         bad_cycles <= bad_cycles + 1;
       end
       if (bad_cycles >= 3) begin
-        $error("Mismatch or model error (see message above)");
+        if (OtbnTopEndRun(1'b1)) $error("Mismatch or model error (see message above)");
       end
     end
   end
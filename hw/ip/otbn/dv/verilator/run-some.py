@@ -13,6 +13,11 @@ which will generate 10 OTBN binaries, each with up to 1500 instructions in
 their respective traces. It will also build a Verilated model of OTBN (using
 otbn_top_sim) and run the model on each binary.
 
+By default, each binary is run in its own simulation. Pass --batch to run all
+the binaries in a single simulation instead (using the --otbn-batch option of
+otbn_top_sim); the result for each binary is then written to summary.jsonl in
+the destination directory.
+
 '''
 
 import argparse
@@ -46,6 +51,8 @@ def main() -> int:
                         help='Number of binaries to generate and run')
     parser.add_argument('--seed', type=int, default=1)
     parser.add_argument('--size', type=int, default=100)
+    parser.add_argument('--batch', action='store_true',
+                        help='Run all binaries in a single simulation')
     parser.add_argument('destdir', help='Destination directory')
 
     args = parser.parse_args()
@@ -68,7 +75,8 @@ def main() -> int:
     # Next, we make our own build.ninja, which says how to compile and run the
     # verilated testbench
     with open(os.path.join(args.destdir, 'build.ninja'), 'w') as ninja_handle:
-        write_ninja(ninja_handle, args.destdir, args.seed, args.count)
+        write_ninja(ninja_handle, args.destdir, args.seed, args.count,
+                    args.batch)
 
     # Finally, use ninja to run everything, continuing on error (so that you
     # can run 100 seeds and see what proportion fails).
@@ -79,7 +87,8 @@ def main() -> int:
 def write_ninja(handle: TextIO,
                 destdir: str,
                 seed: int,
-                count: int) -> None:
+                count: int,
+                batch: bool) -> None:
     handle.write('include build.ninja.gen\n\n')
 
     # Find the project directory, as viewed from destdir
@@ -99,6 +108,23 @@ def write_ninja(handle: TextIO,
     # Collect up all the generated files
     basenames = [str(seed + off) for off in range(count)]
 
+    if batch:
+        # Run all the binaries in one simulation. The manifest lists them
+        # relative to destdir, which is where ninja runs commands.
+        with open(os.path.join(destdir, 'batch.txt'), 'w') as manifest:
+            for name in basenames:
+                manifest.write(f'{name}.elf\n')
+
+        handle.write(f'rule run_batch\n'
+                     f'  command = REPO_TOP={projdir_from_destdir} '
+                     f'$tb --otbn-batch=batch.txt '
+                     f'--otbn-batch-summary=summary.jsonl >batch.out\n\n')
+        elfs = ' '.join([f'{name}.elf' for name in basenames])
+        handle.write(f'build summary.jsonl | batch.out: run_batch '
+                     f'batch.txt | $tb {elfs}\n\n')
+        handle.write('build run: phony summary.jsonl\n\n')
+        return
+
     # Rules to run them
     handle.write(f'rule run\n'
                  f'  command = REPO_TOP={projdir_from_destdir} '
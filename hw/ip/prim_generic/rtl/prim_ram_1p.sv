@@ -48,7 +48,6 @@ module prim_ram_1p import prim_ram_1p_pkg::*; #(
   // to be the full bit mask
   localparam int MaskWidth = Width / DataBitsPerMask;
 
-  logic [Width-1:0]     mem [Depth];
   logic [MaskWidth-1:0] wmask;
 
   for (genvar k = 0; k < MaskWidth; k++) begin : gen_wmask
@@ -60,6 +59,26 @@ module prim_ram_1p import prim_ram_1p_pkg::*; #(
         clk_i, '0)
   end
 
+`ifdef PRIM_RAM_HOSTMEM
+  // Keep the memory contents in host memory (Verilator only). The DPI calls use
+  // the full bit mask; wmask is only needed for the checks above.
+  logic unused_wmask;
+  assign unused_wmask = ^wmask;
+
+  `include "prim_util_hostmem.svh"
+
+  always @(posedge clk_i) begin
+    if (req_i) begin
+      if (write_i) begin
+        hostmem_write(int'(addr_i), wdata_i, wmask_i);
+      end else begin
+        rdata_o <= hostmem_read(int'(addr_i));
+      end
+    end
+  end
+`else
+  logic [Width-1:0]     mem [Depth];
+
   // using always instead of always_ff to avoid 'ICPD  - illegal combination of drivers' error
   // thrown when using $readmemh system task to backdoor load an image
   always @(posedge clk_i) begin
@@ -78,5 +97,6 @@ module prim_ram_1p import prim_ram_1p_pkg::*; #(
   end
 
   `include "prim_util_memload.svh"
+`endif  // PRIM_RAM_HOSTMEM
 `endif
 endmodule
@@ -2,15 +2,17 @@
 // Licensed under the Apache License, Version 2.0, see LICENSE for details.
 // SPDX-License-Identifier: Apache-2.0
 
-#include <algorithm>
 #include <iostream>
 #include <string>
-#include <vector>
 
 #include "verilated_toplevel.h"
 #include "verilator_memutil.h"
 #include "verilator_sim_ctrl.h"
 
+#ifdef SPIKE_FAST_FORWARD
+#include "verilator_fast_forward.h"
+#endif
+
 int main(int argc, char **argv) {
   chip_sim_tb top;
   VerilatorMemUtil memutil;
@@ -36,10 +38,8 @@ int main(int argc, char **argv) {
                      "gen_prim_flash_banks[1].u_prim_flash_bank.u_mem",
                  0x80000 / 8, 8);
   // Start with the flash region erased. Future loads can overwrite.
-  std::vector<uint8_t> all_ones(flash0.GetSizeBytes());
-  std::fill(all_ones.begin(), all_ones.end(), 0xffu);
-  flash0.Write(/*word_offset=*/0, all_ones);
-  flash1.Write(/*word_offset=*/0, all_ones);
+  flash0.Fill(0xffu);
+  flash1.Fill(0xffu);
 
   MemArea otp(top_scope + ".u_otp_macro." + ram1p_adv_scope, 0x4000 / 4, 4);
 
@@ -50,6 +50,25 @@ int main(int argc, char **argv) {
   memutil.RegisterMemoryArea("otp", 0x40000000u /* (bogus LMA) */, &otp);
   simctrl.RegisterExtension(&memutil);
 
+#ifdef SPIKE_FAST_FORWARD
+  // This must match the configuration of rv_core_ibex in top_earlgrey.
+  VerilatorFastForward fast_forward(
+      simctrl,
+      {.isa_string = "rv32imc_Zba_Zbb_Zbc_Zbs_XZbf_XZbp_XZbr_XZbt",
+       .boot_pc = 0x8080,
+       .secure_ibex = true,
+       .icache_en = true,
+       .pmp_num_regions = 16,
+       .pmp_granularity = 0,
+       .mhpm_counter_num = 2},
+      top_scope + ".u_rv_dm.u_dmidpi");
+  fast_forward.AddMemory("rom", 0x8000, &rom0, false);
+  fast_forward.AddMemory("ram", 0x10000000u, &ram, true);
+  fast_forward.AddMemory("flash0", 0x20000000u, &flash0, false);
+  fast_forward.AddMemory("flash1", 0x20080000u, &flash1, false);
+  simctrl.RegisterExtension(&fast_forward);
+#endif
+
   // The initial reset delay must be long enough such that pwr/rst/clkmgr will
   // release clocks to the entire design.  This allows for synchronous resets
   // to appropriately propagate.
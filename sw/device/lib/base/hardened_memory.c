@@ -8,6 +8,47 @@
 #include "sw/device/lib/base/memory.h"
 #include "sw/device/lib/base/random_order.h"
 
+enum {
+  /**
+   * Number of words processed per step of the unrolled loops.
+   *
+   * Each step takes one block of consecutive indices from the random order, so
+   * the traversal order is exactly the same as when advancing one word at a
+   * time; only the per-word bookkeeping is amortized.
+   */
+  kHardenedMemoryBlockWords = 4,
+};
+
+/**
+ * Computes the byte offset of the `offset`-th word of a block.
+ *
+ * @param start First word index of the block, from `random_order_advance_n()`.
+ * @param offset Position of the word within the block.
+ * @param word_len Length of the buffer in words.
+ * @return Byte offset of the word in the buffer.
+ */
+static OT_ALWAYS_INLINE size_t block_byte_idx(size_t start, size_t offset,
+                                              size_t word_len) {
+  // Blocks may straddle the end of the buffer, so wrap around in constant
+  // time, the same way `random_order_advance()` does.
+  size_t idx = start + offset;
+  idx = ct_cmovw(ct_sltuw(idx, word_len), idx, idx - word_len);
+  size_t byte_idx = launderw(idx) * sizeof(uint32_t);
+  // Keep the accesses within a block in traversal order.
+  barrierw(byte_idx);
+  return byte_idx;
+}
+
+static OT_ALWAYS_INLINE void memcpy_word(uintptr_t dest_addr,
+                                         uintptr_t src_addr, size_t byte_idx) {
+  // Calculate pointers.
+  void *src = (void *)launderw(src_addr + byte_idx);
+  void *dest = (void *)launderw(dest_addr + byte_idx);
+
+  // Perform the copy, without performing a typed dereference operation.
+  write_32(read_32(src), dest);
+}
+
 // NOTE: The three hardened_mem* functions have similar contents, but the parts
 // that are shared between them are commented only in `memcpy()`.
 status_t hardened_memcpy(uint32_t *restrict dest, const uint32_t *restrict src,
@@ -23,6 +64,22 @@ status_t hardened_memcpy(uint32_t *restrict dest, const uint32_t *restrict src,
   uintptr_t src_addr = (uintptr_t)src;
   uintptr_t dest_addr = (uintptr_t)dest;
 
+  // Copy whole blocks first. The block loop is unrolled by hand, since the
+  // laundering below would otherwise stop the compiler from doing so.
+  size_t block_len = word_len - word_len % kHardenedMemoryBlockWords;
+  for (; launderw(count) < block_len;
+       count = launderw(count) + kHardenedMemoryBlockWords) {
+    size_t start = launderw(
+        random_order_advance_n(&order, kHardenedMemoryBlockWords));
+    barrierw(start);
+    memcpy_word(dest_addr, src_addr, block_byte_idx(start, 0, word_len));
+    memcpy_word(dest_addr, src_addr, block_byte_idx(start, 1, word_len));
+    memcpy_word(dest_addr, src_addr, block_byte_idx(start, 2, word_len));
+    memcpy_word(dest_addr, src_addr, block_byte_idx(start, 3, word_len));
+  }
+
+  // Copy the remaining words one at a time.
+  //
   // We need to launder `count`, so that the SW.LOOP-COMPLETION check is not
   // deleted by the compiler.
   for (; launderw(count) < word_len; count = launderw(count) + 1) {
@@ -37,12 +94,7 @@ status_t hardened_memcpy(uint32_t *restrict dest, const uint32_t *restrict src,
     // happens-before among indices consistent with `order`.
     barrierw(byte_idx);
 
-    // Calculate pointers.
-    void *src = (void *)launderw(src_addr + byte_idx);
-    void *dest = (void *)launderw(dest_addr + byte_idx);
-
-    // Perform the copy, without performing a typed dereference operation.
-    write_32(read_32(src), dest);
+    memcpy_word(dest_addr, src_addr, byte_idx);
   }
   RANDOM_ORDER_HARDENED_CHECK_DONE(order);
   HARDENED_CHECK_EQ(count, word_len);
@@ -75,6 +127,28 @@ status_t hardened_memshred(uint32_t *dest, size_t word_len) {
   return OTCRYPTO_OK;
 }
 
+static OT_ALWAYS_INLINE void memeq_word(uintptr_t lhs_addr, uintptr_t rhs_addr,
+                                        size_t byte_idx, uint32_t *zeros,
+                                        uint32_t *ones) {
+  // Calculate pointers.
+  void *av = (void *)launderw(lhs_addr + byte_idx);
+  void *bv = (void *)launderw(rhs_addr + byte_idx);
+
+  uint32_t a = read_32(av);
+  uint32_t b = read_32(bv);
+
+  // Launder one of the operands, so that the compiler cannot cache the result
+  // of the xor for use in the next operation.
+  //
+  // We launder `zeroes` so that compiler cannot learn that `zeroes` has
+  // strictly more bits set at the end of the loop.
+  *zeros = launder32(*zeros) | (launder32(a) ^ b);
+
+  // Same as above. The compiler can cache the value of `a[offset]`, but it
+  // has no chance to strength-reduce this operation.
+  *ones = launder32(*ones) & (launder32(a) ^ ~b);
+}
+
 hardened_bool_t hardened_memeq(const uint32_t *lhs, const uint32_t *rhs,
                                size_t word_len) {
   random_order_t order;
@@ -88,29 +162,27 @@ hardened_bool_t hardened_memeq(const uint32_t *lhs, const uint32_t *rhs,
   uint32_t zeros = 0;
   uint32_t ones = UINT32_MAX;
 
-  // The loop is almost token-for-token the one above, but the copy is
+  // The loops are almost token-for-token the ones above, but the copy is
   // replaced with something else.
+  size_t block_len = word_len - word_len % kHardenedMemoryBlockWords;
+  for (; launderw(count) < block_len;
+       count = launderw(count) + kHardenedMemoryBlockWords) {
+    size_t start = launderw(
+        random_order_advance_n(&order, kHardenedMemoryBlockWords));
+    barrierw(start);
+    memeq_word(lhs_addr, rhs_addr, block_byte_idx(start, 0, word_len), &zeros,
+               &ones);
+    memeq_word(lhs_addr, rhs_addr, block_byte_idx(start, 1, word_len), &zeros,
+               &ones);
+    memeq_word(lhs_addr, rhs_addr, block_byte_idx(start, 2, word_len), &zeros,
+               &ones);
+    memeq_word(lhs_addr, rhs_addr, block_byte_idx(start, 3, word_len), &zeros,
+               &ones);
+  }
   for (; count < word_len; count = launderw(count) + 1) {
     size_t byte_idx = launderw(random_order_advance(&order)) * sizeof(uint32_t);
     barrierw(byte_idx);
-
-    // Calculate pointers.
-    void *av = (void *)launderw(lhs_addr + byte_idx);
-    void *bv = (void *)launderw(rhs_addr + byte_idx);
-
-    uint32_t a = read_32(av);
-    uint32_t b = read_32(bv);
-
-    // Launder one of the operands, so that the compiler cannot cache the result
-    // of the xor for use in the next operation.
-    //
-    // We launder `zeroes` so that compiler cannot learn that `zeroes` has
-    // strictly more bits set at the end of the loop.
-    zeros = launder32(zeros) | (launder32(a) ^ b);
-
-    // Same as above. The compiler can cache the value of `a[offset]`, but it
-    // has no chance to strength-reduce this operation.
-    ones = launder32(ones) & (launder32(a) ^ ~b);
+    memeq_word(lhs_addr, rhs_addr, byte_idx, &zeros, &ones);
   }
   RANDOM_ORDER_HARDENED_CHECK_DONE(order);
 
@@ -159,6 +231,27 @@ hardened_bool_t consttime_memeq_byte(const void *lhs, const void *rhs,
   return kHardenedBoolFalse;
 }
 
+static OT_ALWAYS_INLINE void xor_word(uintptr_t x_addr, uintptr_t y_addr,
+                                      uintptr_t dest_addr, uintptr_t rand_addr,
+                                      size_t byte_idx) {
+  // Calculate pointers.
+  uintptr_t xp = x_addr + byte_idx;
+  uintptr_t yp = y_addr + byte_idx;
+  uintptr_t destp = dest_addr + byte_idx;
+  uintptr_t randp = rand_addr + byte_idx;
+
+  // Set the pointers.
+  void *xv = (void *)launderw(xp);
+  void *yv = (void *)launderw(yp);
+  void *destv = (void *)launderw(destp);
+  void *randv = (void *)launderw(randp);
+
+  // Perform the XORs: dest = ((x ^ rand) ^ y) ^ rand
+  write_32(read_32(xv) ^ read_32(randv), destv);
+  write_32(read_32(destv) ^ read_32(yv), destv);
+  write_32(read_32(destv) ^ read_32(randv), destv);
+}
+
 status_t hardened_xor(const uint32_t *restrict x, const uint32_t *restrict y,
                       size_t word_len, uint32_t *restrict dest) {
   // Randomize the content of the output buffer before writing to it.
@@ -179,30 +272,30 @@ status_t hardened_xor(const uint32_t *restrict x, const uint32_t *restrict y,
   random_order_init(&order, word_len);
   size_t count = 0;
 
-  // XOR the mask with the first share. This loop is modelled off the one in
-  // `hardened_memcpy`; see the comments there for more details.
+  // XOR the mask with the first share. These loops are modelled off the ones
+  // in `hardened_memcpy`; see the comments there for more details.
+  size_t block_len = word_len - word_len % kHardenedMemoryBlockWords;
+  for (; launderw(count) < block_len;
+       count = launderw(count) + kHardenedMemoryBlockWords) {
+    size_t start = launderw(
+        random_order_advance_n(&order, kHardenedMemoryBlockWords));
+    barrierw(start);
+    xor_word(x_addr, y_addr, dest_addr, rand_addr,
+             block_byte_idx(start, 0, word_len));
+    xor_word(x_addr, y_addr, dest_addr, rand_addr,
+             block_byte_idx(start, 1, word_len));
+    xor_word(x_addr, y_addr, dest_addr, rand_addr,
+             block_byte_idx(start, 2, word_len));
+    xor_word(x_addr, y_addr, dest_addr, rand_addr,
+             block_byte_idx(start, 3, word_len));
+  }
   for (; launderw(count) < word_len; count = launderw(count) + 1) {
     size_t byte_idx = launderw(random_order_advance(&order)) * sizeof(uint32_t);
 
     // Prevent the compiler from re-ordering the loop.
     barrierw(byte_idx);
 
-    // Calculate pointers.
-    uintptr_t xp = x_addr + byte_idx;
-    uintptr_t yp = y_addr + byte_idx;
-    uintptr_t destp = dest_addr + byte_idx;
-    uintptr_t randp = rand_addr + byte_idx;
-
-    // Set the pointers.
-    void *xv = (void *)launderw(xp);
-    void *yv = (void *)launderw(yp);
-    void *destv = (void *)launderw(destp);
-    void *randv = (void *)launderw(randp);
-
-    // Perform the XORs: dest = ((x ^ rand) ^ y) ^ rand
-    write_32(read_32(xv) ^ read_32(randv), destv);
-    write_32(read_32(destv) ^ read_32(yv), destv);
-    write_32(read_32(destv) ^ read_32(randv), destv);
+    xor_word(x_addr, y_addr, dest_addr, rand_addr, byte_idx);
   }
   RANDOM_ORDER_HARDENED_CHECK_DONE(order);
   HARDENED_CHECK_EQ(count, word_len);
@@ -210,6 +303,17 @@ status_t hardened_xor(const uint32_t *restrict x, const uint32_t *restrict y,
   return OTCRYPTO_OK;
 }
 
+static OT_ALWAYS_INLINE void xor_in_place_word(uintptr_t x_addr,
+                                               uintptr_t y_addr,
+                                               size_t byte_idx) {
+  // Calculate pointers.
+  void *xv = (void *)launderw(x_addr + byte_idx);
+  void *yv = (void *)launderw(y_addr + byte_idx);
+
+  // Perform an XOR in the array.
+  write_32(read_32(xv) ^ read_32(yv), xv);
+}
+
 status_t hardened_xor_in_place(uint32_t *restrict x, const uint32_t *restrict y,
                                size_t word_len) {
   // Generate a random ordering.
@@ -221,20 +325,26 @@ status_t hardened_xor_in_place(uint32_t *restrict x, const uint32_t *restrict y,
   uintptr_t x_addr = (uintptr_t)x;
   uintptr_t y_addr = (uintptr_t)y;
 
-  // XOR the mask with the first share. This loop is modelled off the one in
-  // `hardened_memcpy`; see the comments there for more details.
+  // XOR the mask with the first share. These loops are modelled off the ones
+  // in `hardened_memcpy`; see the comments there for more details.
+  size_t block_len = word_len - word_len % kHardenedMemoryBlockWords;
+  for (; launderw(count) < block_len;
+       count = launderw(count) + kHardenedMemoryBlockWords) {
+    size_t start = launderw(
+        random_order_advance_n(&order, kHardenedMemoryBlockWords));
+    barrierw(start);
+    xor_in_place_word(x_addr, y_addr, block_byte_idx(start, 0, word_len));
+    xor_in_place_word(x_addr, y_addr, block_byte_idx(start, 1, word_len));
+    xor_in_place_word(x_addr, y_addr, block_byte_idx(start, 2, word_len));
+    xor_in_place_word(x_addr, y_addr, block_byte_idx(start, 3, word_len));
+  }
   for (; launderw(count) < word_len; count = launderw(count) + 1) {
     size_t byte_idx = launderw(random_order_advance(&order)) * sizeof(uint32_t);
 
     // Prevent the compiler from re-ordering the loop.
     barrierw(byte_idx);
 
-    // Calculate pointers.
-    void *xv = (void *)launderw(x_addr + byte_idx);
-    void *yv = (void *)launderw(y_addr + byte_idx);
-
-    // Perform an XOR in the array.
-    write_32(read_32(xv) ^ read_32(yv), xv);
+    xor_in_place_word(x_addr, y_addr, byte_idx);
   }
   RANDOM_ORDER_HARDENED_CHECK_DONE(order);
   HARDENED_CHECK_EQ(count, word_len);
@@ -0,0 +1,214 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sw/device/lib/base/hardened.h"
+#include "sw/device/lib/base/hardened_memory.h"
+#include "sw/device/lib/base/macros.h"
+#include "sw/device/lib/base/memory.h"
+#include "sw/device/lib/base/random_order.h"
+#include "sw/device/lib/runtime/ibex.h"
+#include "sw/device/lib/runtime/log.h"
+#include "sw/device/lib/testing/test_framework/check.h"
+#include "sw/device/lib/testing/test_framework/ottf_main.h"
+
+// Compares the block-unrolled hardened memory functions against the original
+// one-word-per-step loops, which are reproduced below as references.
+//
+// Run with:
+//
+//   $ ./bazelisk.sh test --copt -O2 --test_output=all \
+//       //sw/device/lib/base:hardened_memory_perftest_fpga_cw310_test_rom
+
+enum {
+  /**
+   * Largest buffer length in words (4 KiB).
+   */
+  kMaxWords = 1024,
+  kNumRuns = 10,
+};
+
+static uint32_t buf1[kMaxWords];
+static uint32_t buf2[kMaxWords];
+
+// The traversal order does not affect the cycle count, so a cheap
+// deterministic generator is enough and keeps the entropy complex out of the
+// measurement.
+static uint32_t rng_state = 0x9e3779b9;
+
+uint32_t random_order_random_word(void) {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return rng_state;
+}
+
+uint32_t hardened_memshred_random_word(void) {
+  return random_order_random_word();
+}
+
+OT_NOINLINE static void reference_memcpy(uint32_t *dest, const uint32_t *src,
+                                         size_t word_len) {
+  random_order_t order;
+  random_order_init(&order, word_len);
+  size_t count = 0;
+  uintptr_t src_addr = (uintptr_t)src;
+  uintptr_t dest_addr = (uintptr_t)dest;
+  for (; launderw(count) < word_len; count = launderw(count) + 1) {
+    size_t byte_idx = launderw(random_order_advance(&order)) * sizeof(uint32_t);
+    barrierw(byte_idx);
+    void *s = (void *)launderw(src_addr + byte_idx);
+    void *d = (void *)launderw(dest_addr + byte_idx);
+    write_32(read_32(s), d);
+  }
+  RANDOM_ORDER_HARDENED_CHECK_DONE(order);
+  HARDENED_CHECK_EQ(count, word_len);
+}
+
+OT_NOINLINE static hardened_bool_t reference_memeq(const uint32_t *lhs,
+                                                   const uint32_t *rhs,
+                                                   size_t word_len) {
+  random_order_t order;
+  random_order_init(&order, word_len);
+  size_t count = 0;
+  uintptr_t lhs_addr = (uintptr_t)lhs;
+  uintptr_t rhs_addr = (uintptr_t)rhs;
+  uint32_t zeros = 0;
+  uint32_t ones = UINT32_MAX;
+  for (; count < word_len; count = launderw(count) + 1) {
+    size_t byte_idx = launderw(random_order_advance(&order)) * sizeof(uint32_t);
+    barrierw(byte_idx);
+    uint32_t a = read_32((void *)launderw(lhs_addr + byte_idx));
+    uint32_t b = read_32((void *)launderw(rhs_addr + byte_idx));
+    zeros = launder32(zeros) | (launder32(a) ^ b);
+    ones = launder32(ones) & (launder32(a) ^ ~b);
+  }
+  RANDOM_ORDER_HARDENED_CHECK_DONE(order);
+  HARDENED_CHECK_EQ(count, word_len);
+  if (launder32(zeros) == 0) {
+    HARDENED_CHECK_EQ(ones, UINT32_MAX);
+    return kHardenedBoolTrue;
+  }
+  HARDENED_CHECK_NE(ones, UINT32_MAX);
+  return kHardenedBoolFalse;
+}
+
+OT_NOINLINE static void reference_xor_in_place(uint32_t *x, const uint32_t *y,
+                                               size_t word_len) {
+  random_order_t order;
+  random_order_init(&order, word_len);
+  size_t count = 0;
+  uintptr_t x_addr = (uintptr_t)x;
+  uintptr_t y_addr = (uintptr_t)y;
+  for (; launderw(count) < word_len; count = launderw(count) + 1) {
+    size_t byte_idx = launderw(random_order_advance(&order)) * sizeof(uint32_t);
+    barrierw(byte_idx);
+    void *xv = (void *)launderw(x_addr + byte_idx);
+    void *yv = (void *)launderw(y_addr + byte_idx);
+    write_32(read_32(xv) ^ read_32(yv), xv);
+  }
+  RANDOM_ORDER_HARDENED_CHECK_DONE(order);
+  HARDENED_CHECK_EQ(count, word_len);
+}
+
+OT_NOINLINE static void run_reference_memcpy(size_t len) {
+  reference_memcpy(buf1, buf2, len);
+}
+
+OT_NOINLINE static void run_hardened_memcpy(size_t len) {
+  CHECK_STATUS_OK(hardened_memcpy(buf1, buf2, len));
+}
+
+OT_NOINLINE static void run_reference_memeq(size_t len) {
+  CHECK(reference_memeq(buf1, buf2, len) == kHardenedBoolTrue);
+}
+
+OT_NOINLINE static void run_hardened_memeq(size_t len) {
+  CHECK(hardened_memeq(buf1, buf2, len) == kHardenedBoolTrue);
+}
+
+OT_NOINLINE static void run_reference_xor(size_t len) {
+  reference_xor_in_place(buf1, buf2, len);
+}
+
+OT_NOINLINE static void run_hardened_xor(size_t len) {
+  CHECK_STATUS_OK(hardened_xor_in_place(buf1, buf2, len));
+}
+
+typedef struct perf_test {
+  const char *label;
+  void (*reference)(size_t len);
+  void (*hardened)(size_t len);
+} perf_test_t;
+
+static const perf_test_t kPerfTests[] = {
+    {
+        .label = "hardened_memcpy",
+        .reference = &run_reference_memcpy,
+        .hardened = &run_hardened_memcpy,
+    },
+    {
+        .label = "hardened_memeq",
+        .reference = &run_reference_memeq,
+        .hardened = &run_hardened_memeq,
+    },
+    {
+        .label = "hardened_xor_in_place",
+        .reference = &run_reference_xor,
+        .hardened = &run_hardened_xor,
+    },
+};
+
+// Buffer lengths in words: a 3072-bit RSA operand, a 3072-bit operand plus one
+// word (so the unrolled loop has a tail), and 4 KiB.
+static const size_t kWordLens[] = {96, 97, kMaxWords};
+
+static uint32_t measure(void (*func)(size_t), size_t len) {
+  uint64_t total = 0;
+  for (size_t i = 0; i < kNumRuns; ++i) {
+    // Equal buffers, so that the memeq checks above hold.
+    memset(buf1, 0, sizeof(buf1));
+    memset(buf2, 0, sizeof(buf2));
+    uint64_t start = ibex_mcycle_read();
+    func(len);
+    total += ibex_mcycle_read() - start;
+  }
+  CHECK(total < UINT32_MAX);
+  return (uint32_t)total;
+}
+
+OTTF_DEFINE_TEST_CONFIG();
+
+bool test_main(void) {
+  for (size_t i = 0; i < ARRAYSIZE(kPerfTests); ++i) {
+    const perf_test_t *test = &kPerfTests[i];
+    for (size_t j = 0; j < ARRAYSIZE(kWordLens); ++j) {
+      size_t len = kWordLens[j];
+      uint32_t reference = measure(test->reference, len);
+      uint32_t hardened = measure(test->hardened, len);
+      uint32_t words = kNumRuns * len;
+      // Report cycles per word in hundredths.
+      LOG_INFO("%s(%d words): %d.%02d cycles/word (reference: %d.%02d)",
+               test->label, len, hardened / words,
+               (hardened * 100 / words) % 100, reference / words,
+               (reference * 100 / words) % 100);
+    }
+  }
+
+  // Check that the unrolled loops still visit every word.
+  for (size_t i = 0; i < kMaxWords; ++i) {
+    buf2[i] = 0x01000193 * i;
+  }
+  memset(buf1, 0, sizeof(buf1));
+  CHECK_STATUS_OK(hardened_memcpy(buf1, buf2, kMaxWords - 1));
+  CHECK_ARRAYS_EQ(buf1, buf2, kMaxWords - 1);
+  CHECK(buf1[kMaxWords - 1] == 0);
+  CHECK(hardened_memeq(buf1, buf2, kMaxWords - 1) == kHardenedBoolTrue);
+  buf1[kMaxWords / 2] ^= 1;
+  CHECK(hardened_memeq(buf1, buf2, kMaxWords - 1) == kHardenedBoolFalse);
+  return true;
+}
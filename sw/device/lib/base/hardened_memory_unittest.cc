@@ -56,5 +56,35 @@ TEST(HardenedMemory, MemEq) {
             kHardenedBoolFalse);
 }
 
+TEST(HardenedMemory, BlockLengths) {
+  // Exercise lengths around the unrolled block size, so that blocks wrap
+  // around the end of the buffer at different positions.
+  for (size_t len = 1; len <= 21; ++len) {
+    std::vector<uint32_t> xs(len), ys(len), zs(len), expected(len);
+    for (size_t i = 0; i < len; ++i) {
+      xs[i] = 0x01010101 * i;
+      ys[i] = 0x10000001 * (i + 3);
+      expected[i] = xs[i] ^ ys[i];
+    }
+
+    std::vector<uint32_t> copy(len);
+    EXPECT_EQ(hardened_memcpy(copy.data(), xs.data(), len).value,
+              kHardenedBoolTrue);
+    EXPECT_EQ(copy, xs);
+    EXPECT_EQ(hardened_memeq(copy.data(), xs.data(), len), kHardenedBoolTrue);
+
+    copy[len - 1] ^= 1;
+    EXPECT_EQ(hardened_memeq(copy.data(), xs.data(), len), kHardenedBoolFalse);
+
+    EXPECT_EQ(hardened_xor(xs.data(), ys.data(), len, zs.data()).value,
+              kHardenedBoolTrue);
+    EXPECT_EQ(zs, expected);
+
+    EXPECT_EQ(hardened_xor_in_place(xs.data(), ys.data(), len).value,
+              kHardenedBoolTrue);
+    EXPECT_EQ(xs, expected);
+  }
+}
+
 }  // namespace
 }  // namespace hardened_memory_unittest
@@ -34,3 +34,18 @@ size_t random_order_advance(random_order_t *ctx) {
   HARDENED_CHECK_LE(ctx->state, ctx->max);
   return out;
 }
+
+size_t random_order_advance_n(random_order_t *ctx, size_t n) {
+  HARDENED_CHECK_LE(n, ctx->max);
+  size_t out = ctx->state;
+  // Since `n <= max`, a single subtraction is enough to wrap around.
+  size_t next = ctx->state + n;
+  size_t next_overflow = next - ctx->max;
+
+  ct_bool32_t which = ct_sltu32(next, ctx->max);
+  ctx->state = ct_cmov32(which, next, next_overflow);
+
+  ctx->ctr = launder32(ctx->ctr) + n;
+  HARDENED_CHECK_LE(ctx->state, ctx->max);
+  return out;
+}
@@ -98,6 +98,23 @@ size_t random_order_len(const random_order_t *ctx);
  */
 size_t random_order_advance(random_order_t *ctx);
 
+/**
+ * Advances the sequence represented by `ctx` by `n` elements at once.
+ *
+ * The returned value is the first element of the block; the remaining elements
+ * are the `n - 1` values that would follow it, i.e. `(start + i) % len` for
+ * `i` in `[1, n)`. Calling this function is equivalent to calling
+ * `random_order_advance()` `n` times, so it counts towards
+ * `RANDOM_ORDER_HARDENED_CHECK_DONE()` in the same way.
+ *
+ * `n` must not exceed `random_order_len()`.
+ *
+ * @param ctx The context to advance.
+ * @param n The number of elements to advance by.
+ * @return The first value of the block.
+ */
+size_t random_order_advance_n(random_order_t *ctx, size_t n);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -88,5 +88,27 @@ TEST(RandomOrder, SpecTest) {
   EXPECT_THAT(hit, Each(true));
 }
 
+TEST(RandomOrder, AdvanceNTest) {
+  // Advancing in blocks must visit the same sequence as advancing one element
+  // at a time.
+  size_t len = 103;
+  random_order_t ctx, ref;
+  random_order_init(&ctx, len);
+  random_order_init(&ref, len);
+
+  size_t blocks = len / 4;
+  for (size_t i = 0; i < blocks; i++) {
+    size_t start = random_order_advance_n(&ctx, 4);
+    for (size_t j = 0; j < 4; j++) {
+      EXPECT_EQ((start + j) % len, random_order_advance(&ref));
+    }
+  }
+  for (size_t i = blocks * 4; i < len; i++) {
+    EXPECT_EQ(random_order_advance_n(&ctx, 1), random_order_advance(&ref));
+  }
+  RANDOM_ORDER_HARDENED_CHECK_DONE(ctx);
+  EXPECT_EQ(ctx.state, ref.state);
+}
+
 }  // namespace
 }  // namespace random_order_unittest
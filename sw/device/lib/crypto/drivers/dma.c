@@ -0,0 +1,170 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/lib/crypto/drivers/dma.h"
+
+#include "hw/top/dt/dt_dma.h"
+#include "sw/device/lib/base/abs_mmio.h"
+#include "sw/device/lib/base/bitfield.h"
+#include "sw/device/lib/base/hardened.h"
+#include "sw/device/lib/base/memory.h"
+#include "sw/device/lib/crypto/impl/status.h"
+
+#include "hw/top/dma_regs.h"  // Generated.
+
+// Module ID for status codes.
+#define MODULE_ID MAKE_MODULE_ID('d', 'd', 'm')
+
+static const dt_dma_t kDmaDt = kDtDma;
+
+static inline uint32_t dma_base(void) {
+  return dt_dma_primary_reg_block(kDmaDt);
+}
+
+/**
+ * Mask of the STATUS bits that mark the end of a transfer.
+ */
+static const uint32_t kDmaStatusEndMask = (1u << DMA_STATUS_DONE_BIT) |
+                                          (1u << DMA_STATUS_ABORTED_BIT) |
+                                          (1u << DMA_STATUS_ERROR_BIT);
+
+enum {
+  /**
+   * Number of STATUS polls allowed per transferred byte before timing out.
+   *
+   * A poll takes at least 3 cycles, and the HMAC and KMAC FIFOs drain in well
+   * under a cycle per byte unless the entropy complex stalls. Leave a large
+   * margin.
+   */
+  kDmaWaitItersPerByte = 32,
+  /**
+   * Fixed number of STATUS polls allowed on top of the per-byte allowance.
+   */
+  kDmaWaitItersBase = 1024,
+};
+
+hardened_bool_t dma_memory_range_check(const uint8_t *src, size_t len) {
+  const uint32_t kBase = dma_base();
+  uint32_t range_valid = abs_mmio_read32(kBase + DMA_RANGE_VALID_REG_OFFSET);
+  if (!bitfield_bit32_read(range_valid, DMA_RANGE_VALID_RANGE_VALID_BIT)) {
+    return kHardenedBoolFalse;
+  }
+
+  // The limit address is inclusive.
+  uint32_t range_base =
+      abs_mmio_read32(kBase + DMA_ENABLED_MEMORY_RANGE_BASE_REG_OFFSET);
+  uint32_t range_limit =
+      abs_mmio_read32(kBase + DMA_ENABLED_MEMORY_RANGE_LIMIT_REG_OFFSET);
+  uint32_t addr = (uint32_t)src;
+  if (len == 0 || addr < range_base || addr > range_limit ||
+      len - 1 > range_limit - addr) {
+    return kHardenedBoolFalse;
+  }
+  return kHardenedBoolTrue;
+}
+
+status_t dma_fifo_write_start(uint32_t fifo_addr, const uint8_t *src,
+                              size_t len) {
+  if (len == 0 || len % sizeof(uint32_t) != 0 ||
+      misalignment32_of((uintptr_t)src) != 0) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  if (dma_memory_range_check(src, len) != kHardenedBoolTrue) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  const uint32_t kBase = dma_base();
+  uint32_t status = abs_mmio_read32(kBase + DMA_STATUS_REG_OFFSET);
+  if (bitfield_bit32_read(status, DMA_STATUS_BUSY_BIT)) {
+    return OTCRYPTO_RECOV_ERR;
+  }
+  // Clear any leftover status from a previous transfer.
+  abs_mmio_write32(kBase + DMA_STATUS_REG_OFFSET, status & kDmaStatusEndMask);
+
+  abs_mmio_write32(kBase + DMA_SRC_ADDR_LO_REG_OFFSET, (uint32_t)src);
+  abs_mmio_write32(kBase + DMA_SRC_ADDR_HI_REG_OFFSET, 0);
+  abs_mmio_write32(kBase + DMA_DST_ADDR_LO_REG_OFFSET, fifo_addr);
+  abs_mmio_write32(kBase + DMA_DST_ADDR_HI_REG_OFFSET, 0);
+
+  // Linear source, fixed destination.
+  uint32_t src_cfg = 0;
+  src_cfg = bitfield_bit32_write(src_cfg, DMA_SRC_CONFIG_INCREMENT_BIT, true);
+  src_cfg = bitfield_bit32_write(src_cfg, DMA_SRC_CONFIG_WRAP_BIT, false);
+  abs_mmio_write32(kBase + DMA_SRC_CONFIG_REG_OFFSET, src_cfg);
+  uint32_t dst_cfg = 0;
+  dst_cfg = bitfield_bit32_write(dst_cfg, DMA_DST_CONFIG_INCREMENT_BIT, false);
+  dst_cfg = bitfield_bit32_write(dst_cfg, DMA_DST_CONFIG_WRAP_BIT, true);
+  abs_mmio_write32(kBase + DMA_DST_CONFIG_REG_OFFSET, dst_cfg);
+
+  uint32_t asid = 0;
+  asid = bitfield_field32_write(asid, DMA_ADDR_SPACE_ID_SRC_ASID_FIELD,
+                                DMA_ADDR_SPACE_ID_SRC_ASID_VALUE_OT_ADDR);
+  asid = bitfield_field32_write(asid, DMA_ADDR_SPACE_ID_DST_ASID_FIELD,
+                                DMA_ADDR_SPACE_ID_DST_ASID_VALUE_OT_ADDR);
+  abs_mmio_write32(kBase + DMA_ADDR_SPACE_ID_REG_OFFSET, asid);
+
+  abs_mmio_write32(kBase + DMA_CHUNK_DATA_SIZE_REG_OFFSET, len);
+  abs_mmio_write32(kBase + DMA_TOTAL_DATA_SIZE_REG_OFFSET, len);
+  abs_mmio_write32(kBase + DMA_TRANSFER_WIDTH_REG_OFFSET,
+                   DMA_TRANSFER_WIDTH_TRANSACTION_WIDTH_VALUE_FOUR_BYTE);
+
+  uint32_t ctrl = 0;
+  ctrl = bitfield_field32_write(ctrl, DMA_CONTROL_OPCODE_FIELD,
+                                DMA_CONTROL_OPCODE_VALUE_COPY);
+  ctrl = bitfield_bit32_write(ctrl, DMA_CONTROL_INITIAL_TRANSFER_BIT, true);
+  ctrl = bitfield_bit32_write(ctrl, DMA_CONTROL_GO_BIT, true);
+  abs_mmio_write32(kBase + DMA_CONTROL_REG_OFFSET, ctrl);
+
+  return OTCRYPTO_OK;
+}
+
+status_t dma_transfer_check(void) {
+  const uint32_t kBase = dma_base();
+  uint32_t status = abs_mmio_read32(kBase + DMA_STATUS_REG_OFFSET);
+  if ((status & kDmaStatusEndMask) == 0) {
+    return OTCRYPTO_ASYNC_INCOMPLETE;
+  }
+
+  // Acknowledge the end of the transfer.
+  abs_mmio_write32(kBase + DMA_STATUS_REG_OFFSET, status & kDmaStatusEndMask);
+
+  if (bitfield_bit32_read(status, DMA_STATUS_ERROR_BIT) ||
+      bitfield_bit32_read(status, DMA_STATUS_ABORTED_BIT)) {
+    return OTCRYPTO_RECOV_ERR;
+  }
+  HARDENED_CHECK_NE(status & (1u << DMA_STATUS_DONE_BIT), 0);
+  return OTCRYPTO_OK;
+}
+
+status_t dma_transfer_wait(void) {
+  // Bound the wait by the size of the transfer that is running.
+  const uint32_t kBase = dma_base();
+  uint32_t total_len =
+      abs_mmio_read32(kBase + DMA_TOTAL_DATA_SIZE_REG_OFFSET);
+  uint32_t max_iters = kDmaWaitItersBase + total_len * kDmaWaitItersPerByte;
+
+  uint32_t attempt_cnt = 0;
+  while ((abs_mmio_read32(kBase + DMA_STATUS_REG_OFFSET) & kDmaStatusEndMask) ==
+         0) {
+    attempt_cnt++;
+    if (attempt_cnt >= max_iters) {
+      // Abort the transfer and give it the same budget to wind down before
+      // clearing its status.
+      uint32_t ctrl = abs_mmio_read32(kBase + DMA_CONTROL_REG_OFFSET);
+      ctrl = bitfield_bit32_write(ctrl, DMA_CONTROL_GO_BIT, false);
+      ctrl = bitfield_bit32_write(ctrl, DMA_CONTROL_ABORT_BIT, true);
+      abs_mmio_write32(kBase + DMA_CONTROL_REG_OFFSET, ctrl);
+      for (attempt_cnt = 0; attempt_cnt < max_iters; attempt_cnt++) {
+        uint32_t status = abs_mmio_read32(kBase + DMA_STATUS_REG_OFFSET);
+        if ((status & kDmaStatusEndMask) != 0) {
+          abs_mmio_write32(kBase + DMA_STATUS_REG_OFFSET,
+                           status & kDmaStatusEndMask);
+          break;
+        }
+      }
+      return OTCRYPTO_RECOV_ERR;
+    }
+  }
+  return dma_transfer_check();
+}
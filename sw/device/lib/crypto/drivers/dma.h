@@ -0,0 +1,105 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OPENTITAN_SW_DEVICE_LIB_CRYPTO_DRIVERS_DMA_H_
+#define OPENTITAN_SW_DEVICE_LIB_CRYPTO_DRIVERS_DMA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sw/device/lib/base/hardened.h"
+#include "sw/device/lib/base/macros.h"
+#include "sw/device/lib/crypto/impl/status.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief DMA driver for the OpenTitan cryptography library.
+ *
+ * Only available on tops that instantiate the DMA controller. Drivers that
+ * can use it are built with `HAS_DMA` defined.
+ *
+ * The driver only performs transfers within the OpenTitan internal address
+ * space. It does not touch the DMA-enabled memory range configuration; that
+ * range must already be set up (and is typically locked) by the boot stages.
+ * Callers check `dma_memory_range_check` first and fall back to CPU writes if
+ * the range is not valid or does not cover their buffer.
+ */
+
+enum {
+  /**
+   * Minimum transfer length in bytes for which offloading to the DMA pays off.
+   *
+   * Below this, programming the DMA costs more than writing the data with the
+   * CPU.
+   */
+  kDmaMinTransferBytes = 256,
+};
+
+/**
+ * Check whether the DMA may read a buffer.
+ *
+ * The DMA refuses to run until the boot stages mark the DMA-enabled memory
+ * range as valid. The crypto library additionally only lets the DMA read
+ * buffers that lie entirely within that range.
+ *
+ * @param src Start of the buffer.
+ * @param len Length of the buffer in bytes.
+ * @return `kHardenedBoolTrue` if the range is valid and covers the buffer.
+ */
+OT_WARN_UNUSED_RESULT
+hardened_bool_t dma_memory_range_check(const uint8_t *src, size_t len);
+
+/**
+ * Start a DMA transfer from memory to a peripheral FIFO register.
+ *
+ * Copies `len` bytes from `src` to the fixed address `fifo_addr` with 32-bit
+ * writes. The FIFO must apply backpressure on the bus while full.
+ *
+ * Returns as soon as the transfer is started; use `dma_transfer_check` or
+ * `dma_transfer_wait` to wait for completion. The caller must not modify
+ * `src` until then.
+ *
+ * @param fifo_addr Address of the FIFO register.
+ * @param src Source buffer (must be 32-bit aligned).
+ * @param len Number of bytes (must be a nonzero multiple of 4).
+ * @return Result of the operation (`OTCRYPTO_BAD_ARGS` if the buffer is not
+ * covered by the DMA-enabled memory range, `OTCRYPTO_RECOV_ERR` if the DMA is
+ * busy).
+ */
+OT_WARN_UNUSED_RESULT
+status_t dma_fifo_write_start(uint32_t fifo_addr, const uint8_t *src,
+                              size_t len);
+
+/**
+ * Check the status of the DMA transfer started last, without blocking.
+ *
+ * Clears the status bits once the transfer has completed.
+ *
+ * @return `OTCRYPTO_OK` if done, `OTCRYPTO_ASYNC_INCOMPLETE` if the transfer is
+ * still running, or an error if the DMA reported a failure.
+ */
+OT_WARN_UNUSED_RESULT
+status_t dma_transfer_check(void);
+
+/**
+ * Block until the DMA transfer started last has completed.
+ *
+ * The wait is bounded by the transfer length. On timeout, the transfer is
+ * aborted and `OTCRYPTO_RECOV_ERR` is returned; the destination peripheral
+ * then holds a partial message and must be reset by the caller.
+ *
+ * @return Result of the transfer.
+ */
+OT_WARN_UNUSED_RESULT
+status_t dma_transfer_wait(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // OPENTITAN_SW_DEVICE_LIB_CRYPTO_DRIVERS_DMA_H_
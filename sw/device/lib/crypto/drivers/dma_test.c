@@ -0,0 +1,150 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/lib/crypto/drivers/dma.h"
+
+#include "hw/top/dt/dt_dma.h"
+#include "sw/device/lib/base/macros.h"
+#include "sw/device/lib/base/memory.h"
+#include "sw/device/lib/crypto/drivers/entropy.h"
+#include "sw/device/lib/crypto/drivers/hmac.h"
+#include "sw/device/lib/crypto/drivers/kmac.h"
+#include "sw/device/lib/crypto/impl/status.h"
+#include "sw/device/lib/dif/dif_dma.h"
+#include "sw/device/lib/runtime/ibex.h"
+#include "sw/device/lib/runtime/log.h"
+#include "sw/device/lib/testing/test_framework/check.h"
+#include "sw/device/lib/testing/test_framework/ottf_main.h"
+
+OTTF_DEFINE_TEST_CONFIG();
+
+enum {
+  /**
+   * Message length in bytes; large enough for the drivers to use the DMA.
+   */
+  kMsgLen = 4096,
+  /**
+   * Update size that keeps the HMAC driver on the CPU path.
+   */
+  kCpuChunkLen = 64,
+};
+
+static_assert(kCpuChunkLen < kDmaMinTransferBytes,
+              "CPU chunk length must be below the DMA threshold.");
+
+static uint32_t msg_words[kMsgLen / sizeof(uint32_t)];
+
+// SHA3-256 of the 4096-byte message {0x00, 0x01, ..., 0xff, 0x00, ...}.
+static const uint8_t kExpectedSha3Digest[] = {
+    0xee, 0xb3, 0xb4, 0xce, 0xe6, 0x5c, 0xff, 0xa2, 0xa3, 0x13, 0x65,
+    0xe3, 0xe7, 0xc3, 0x87, 0x01, 0x10, 0x9c, 0xbb, 0xf4, 0x4e, 0xc1,
+    0x46, 0xe0, 0x98, 0x43, 0x1e, 0x87, 0xca, 0x70, 0xec, 0x83,
+};
+
+static void log_throughput(const char *name, uint64_t cycles) {
+  CHECK(cycles <= UINT32_MAX);
+  uint32_t cycles_u32 = (uint32_t)cycles;
+  LOG_INFO("%s: %d bytes in %d cycles (%d cycles/KiB).", name, kMsgLen,
+           cycles_u32, (uint32_t)(cycles * 1024 / kMsgLen));
+}
+
+static status_t sha256_cpu_test(const uint8_t *msg, uint32_t *digest) {
+  hmac_ctx_t ctx;
+  hmac_hash_sha256_init(&ctx);
+  uint64_t start = ibex_mcycle_read();
+  for (size_t i = 0; i < kMsgLen; i += kCpuChunkLen) {
+    TRY(hmac_update(&ctx, &msg[i], kCpuChunkLen));
+  }
+  TRY(hmac_final(&ctx, digest));
+  log_throughput("SHA-256 (CPU)", ibex_mcycle_read() - start);
+  return OK_STATUS();
+}
+
+static status_t sha256_fallback_test(const uint8_t *msg,
+                                     const uint32_t *expected) {
+  // Without a valid DMA-enabled memory range, the driver must use the CPU.
+  TRY_CHECK(dma_memory_range_check(msg, kMsgLen) == kHardenedBoolFalse);
+  uint32_t digest[kHmacSha256DigestWords];
+  uint64_t start = ibex_mcycle_read();
+  TRY(hmac_hash_sha256(msg, kMsgLen, digest));
+  log_throughput("SHA-256 (no DMA range)", ibex_mcycle_read() - start);
+  TRY_CHECK_ARRAYS_EQ(digest, expected, kHmacSha256DigestWords);
+  return OK_STATUS();
+}
+
+static status_t sha256_dma_test(const uint8_t *msg, const uint32_t *expected) {
+  uint32_t digest[kHmacSha256DigestWords];
+  uint64_t start = ibex_mcycle_read();
+  TRY(hmac_hash_sha256(msg, kMsgLen, digest));
+  log_throughput("SHA-256 (DMA)", ibex_mcycle_read() - start);
+  TRY_CHECK_ARRAYS_EQ(digest, expected, kHmacSha256DigestWords);
+  return OK_STATUS();
+}
+
+static status_t sha256_async_test(const uint8_t *msg,
+                                  const uint32_t *expected) {
+  hmac_ctx_t ctx;
+  hmac_async_update_t op;
+  hmac_hash_sha256_init(&ctx);
+
+  uint64_t start = ibex_mcycle_read();
+  TRY(hmac_update_async_start(&ctx, msg, kMsgLen, &op));
+  uint32_t polls = 0;
+  while (true) {
+    status_t res = hmac_update_async_finalize(&ctx, &op);
+    if (status_ok(res)) {
+      break;
+    }
+    TRY_CHECK(status_err(res) == kUnavailable);
+    ++polls;
+  }
+  uint32_t digest[kHmacSha256DigestWords];
+  TRY(hmac_final(&ctx, digest));
+  log_throughput("SHA-256 (DMA, async)", ibex_mcycle_read() - start);
+  LOG_INFO("Polled %d times before the transfer completed.", polls);
+  TRY_CHECK_ARRAYS_EQ(digest, expected, kHmacSha256DigestWords);
+  return OK_STATUS();
+}
+
+static status_t sha3_dma_test(const uint8_t *msg) {
+  uint32_t digest[256 / 32];
+  uint64_t start = ibex_mcycle_read();
+  TRY(kmac_sha3_256(msg, kMsgLen, digest));
+  log_throughput("SHA3-256 (DMA)", ibex_mcycle_read() - start);
+  TRY_CHECK_ARRAYS_EQ((uint8_t *)digest, kExpectedSha3Digest,
+                      sizeof(kExpectedSha3Digest));
+  return OK_STATUS();
+}
+
+bool test_main(void) {
+  uint8_t *msg = (uint8_t *)msg_words;
+  for (size_t i = 0; i < kMsgLen; ++i) {
+    msg[i] = i & UINT8_MAX;
+  }
+
+  CHECK_STATUS_OK(entropy_complex_init());
+  CHECK_STATUS_OK(kmac_hwip_default_configure());
+
+  uint32_t expected[kHmacSha256DigestWords];
+  CHECK_STATUS_OK(sha256_cpu_test(msg, expected));
+
+  // Nothing before this test marks the DMA-enabled memory range as valid, so
+  // the drivers must fall back to the CPU.
+  dif_dma_t dma;
+  CHECK_DIF_OK(dif_dma_init_from_dt(kDtDma, &dma));
+  bool range_valid;
+  CHECK_DIF_OK(dif_dma_is_memory_range_valid(&dma, &range_valid));
+  CHECK(!range_valid);
+  CHECK_STATUS_OK(sha256_fallback_test(msg, expected));
+
+  // Let the DMA read the message buffer.
+  CHECK_DIF_OK(
+      dif_dma_memory_range_set(&dma, (uint32_t)msg_words, sizeof(msg_words)));
+  CHECK(dma_memory_range_check(msg, kMsgLen) == kHardenedBoolTrue);
+
+  CHECK_STATUS_OK(sha256_dma_test(msg, expected));
+  CHECK_STATUS_OK(sha256_async_test(msg, expected));
+  CHECK_STATUS_OK(sha3_dma_test(msg));
+  return true;
+}
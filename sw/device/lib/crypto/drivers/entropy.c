@@ -9,6 +9,7 @@
 #include "hw/top/dt/dt_entropy_src.h"
 #include "sw/device/lib/base/abs_mmio.h"
 #include "sw/device/lib/base/bitfield.h"
+#include "sw/device/lib/base/hardened_memory.h"
 #include "sw/device/lib/base/math.h"
 #include "sw/device/lib/base/memory.h"
 #include "sw/device/lib/base/multibits.h"
@@ -893,6 +894,9 @@ static status_t edn_check(const edn_config_t *config) {
 }
 
 status_t entropy_complex_init(void) {
+  // Wipe the pool while the entropy complex (which also feeds the random
+  // words used for wiping) may still be running.
+  HARDENED_TRY(entropy_pool_flush());
   entropy_complex_stop_all();
 
   const entropy_complex_config_t *config =
@@ -923,6 +927,7 @@ status_t entropy_complex_check(void) {
 status_t entropy_csrng_instantiate(
     hardened_bool_t disable_trng_input,
     const entropy_seed_material_t *seed_material) {
+  HARDENED_TRY(entropy_pool_flush());
   return csrng_send_app_cmd(csrng_base(),
                             (entropy_csrng_cmd_t){
                                 .id = kEntropyDrbgOpInstantiate,
@@ -935,6 +940,7 @@ status_t entropy_csrng_instantiate(
 
 status_t entropy_csrng_reseed(hardened_bool_t disable_trng_input,
                               const entropy_seed_material_t *seed_material) {
+  HARDENED_TRY(entropy_pool_flush());
   return csrng_send_app_cmd(csrng_base(),
                             (entropy_csrng_cmd_t){
                                 .id = kEntropyDrbgOpReseed,
@@ -946,6 +952,7 @@ status_t entropy_csrng_reseed(hardened_bool_t disable_trng_input,
 }
 
 status_t entropy_csrng_update(const entropy_seed_material_t *seed_material) {
+  HARDENED_TRY(entropy_pool_flush());
   return csrng_send_app_cmd(csrng_base(),
                             (entropy_csrng_cmd_t){
                                 .id = kEntropyDrbgOpUpdate,
@@ -1018,6 +1025,7 @@ status_t entropy_csrng_generate(const entropy_seed_material_t *seed_material,
 }
 
 status_t entropy_csrng_uninstantiate(void) {
+  HARDENED_TRY(entropy_pool_flush());
   return csrng_send_app_cmd(csrng_base(),
                             (entropy_csrng_cmd_t){
                                 .id = kEntropyDrbgOpUninstantiate,
@@ -1026,3 +1034,111 @@ status_t entropy_csrng_uninstantiate(void) {
                             },
                             kEntropyCsrngSendAppCmdTypeCsrng, true);
 }
+
+#if OTCRYPTO_ENTROPY_POOL_WORDS > 0
+/**
+ * Buffered SW CSRNG output.
+ *
+ * The valid words are `words[0..level)`; requests are served from the top.
+ * Words above `level` have always been wiped, so flushing only needs to touch
+ * the valid part.
+ */
+typedef struct entropy_pool {
+  /**
+   * Number of valid words in the pool.
+   */
+  size_t level;
+  /**
+   * Pre-generated FIPS-checked CSRNG output.
+   */
+  uint32_t words[kEntropyPoolWords];
+} entropy_pool_t;
+
+static entropy_pool_t entropy_pool;
+
+/**
+ * Wipe words of the random pool.
+ *
+ * Uses a plain constant store rather than `hardened_memshred()`: shredding
+ * would draw a fresh EDN word for every pool word, which costs more than
+ * generating the pool in the first place. Callers that copy pool words out
+ * shred their own output buffer.
+ *
+ * @param words Words to wipe.
+ * @param len Number of words.
+ */
+static void entropy_pool_wipe(uint32_t *words, size_t len) {
+  memset(words, 0, len * sizeof(uint32_t));
+}
+
+/**
+ * Top up the random pool with a single generate command.
+ *
+ * On failure, the pool is flushed; the partial output may not be FIPS
+ * compatible.
+ *
+ * @return Operation status in `status_t` format.
+ */
+OT_WARN_UNUSED_RESULT
+static status_t entropy_pool_refill(void) {
+  HARDENED_TRY(entropy_complex_check());
+
+  size_t level = entropy_pool.level;
+  HARDENED_CHECK_LT(level, kEntropyPoolWords);
+  status_t res = entropy_csrng_generate(
+      &kEntropyEmptySeed, &entropy_pool.words[level], kEntropyPoolWords - level,
+      /*fips_check=*/kHardenedBoolTrue);
+  if (launder32(res.value) != kHardenedBoolTrue) {
+    // Treat the whole buffer as valid so that it gets wiped.
+    entropy_pool.level = kEntropyPoolWords;
+    HARDENED_TRY(entropy_pool_flush());
+    return res;
+  }
+  HARDENED_CHECK_EQ(res.value, kHardenedBoolTrue);
+  entropy_pool.level = kEntropyPoolWords;
+  return OTCRYPTO_OK;
+}
+#endif
+
+status_t entropy_pool_generate(uint32_t *buf, size_t len) {
+  if (len == 0) {
+    return OTCRYPTO_OK;
+  }
+  if (buf == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  if (len > kEntropyPoolWords) {
+    // Too large for the pool; generate directly.
+    HARDENED_TRY(entropy_complex_check());
+    return entropy_csrng_generate(&kEntropyEmptySeed, buf, len,
+                                  /*fips_check=*/kHardenedBoolTrue);
+  }
+
+#if OTCRYPTO_ENTROPY_POOL_WORDS > 0
+  if (entropy_pool.level < len ||
+      entropy_pool.level < kEntropyPoolWatermarkWords) {
+    HARDENED_TRY(entropy_pool_refill());
+  }
+
+  // Take the words from the top of the pool and wipe them, so that they can
+  // never be handed out twice.
+  size_t level = entropy_pool.level;
+  HARDENED_CHECK_LE(len, level);
+  uint32_t *words = &entropy_pool.words[level - len];
+  HARDENED_TRY(hardened_memcpy(buf, words, len));
+  entropy_pool_wipe(words, len);
+  entropy_pool.level = level - len;
+  HARDENED_CHECK_EQ(entropy_pool.level + len, level);
+#endif
+  return OTCRYPTO_OK;
+}
+
+status_t entropy_pool_flush(void) {
+#if OTCRYPTO_ENTROPY_POOL_WORDS > 0
+  size_t level = entropy_pool.level;
+  entropy_pool.level = 0;
+  entropy_pool_wipe(entropy_pool.words, level);
+#endif
+  return OTCRYPTO_OK;
+}
@@ -35,6 +35,38 @@ enum {
   kEntropySeedWords = kEntropySeedBytes / sizeof(uint32_t),
 };
 
+#ifndef OTCRYPTO_ENTROPY_POOL_WORDS
+/**
+ * Default size of the random pool in 32-bit words.
+ *
+ * May be overridden at build time; setting it to zero disables the pool.
+ */
+#define OTCRYPTO_ENTROPY_POOL_WORDS 64
+#endif
+
+#ifndef OTCRYPTO_ENTROPY_POOL_WATERMARK_WORDS
+/**
+ * Default refill watermark of the random pool in 32-bit words.
+ *
+ * May be overridden at build time.
+ */
+#define OTCRYPTO_ENTROPY_POOL_WATERMARK_WORDS (OTCRYPTO_ENTROPY_POOL_WORDS / 4)
+#endif
+
+enum {
+  /**
+   * Number of words buffered by the random pool.
+   */
+  kEntropyPoolWords = OTCRYPTO_ENTROPY_POOL_WORDS,
+  /**
+   * The pool is refilled when fewer words than this remain.
+   */
+  kEntropyPoolWatermarkWords = OTCRYPTO_ENTROPY_POOL_WATERMARK_WORDS,
+};
+
+static_assert(kEntropyPoolWatermarkWords <= kEntropyPoolWords,
+              "Pool watermark must not exceed the pool size.");
+
 /**
  * Seed material as specified in NIST SP 800-90Ar1 section 10.2.1.3.1. Up to 12
  * words of seed material can be provided using this interface.
@@ -217,6 +249,41 @@ status_t entropy_csrng_generate(const entropy_seed_material_t *seed_material,
 OT_WARN_UNUSED_RESULT
 status_t entropy_csrng_uninstantiate(void);
 
+/**
+ * Read FIPS-checked random words from the SW CSRNG through the random pool.
+ *
+ * Small requests are served from a buffer of pre-generated SW CSRNG output,
+ * so that in the common case the cost is a copy rather than a CSRNG command.
+ * The pool is refilled with a single generate command when it cannot serve a
+ * request or drops below `kEntropyPoolWatermarkWords`, and the entropy complex
+ * configuration is checked before every refill. Requests larger than the pool
+ * bypass it.
+ *
+ * Pool contents are only generated with the FIPS check enabled, and they are
+ * discarded whenever the SW CSRNG is instantiated, reseeded, updated or
+ * uninstantiated, so output after a reseed never comes from the old state.
+ * Consumed words are wiped from the pool.
+ *
+ * There is no way to pass additional input; callers that need it must use
+ * `entropy_csrng_generate()` instead.
+ *
+ * @param[out] buf A buffer to fill with random words.
+ * @param len The number of words to read into `buf`.
+ * @return Operation status in `status_t` format.
+ */
+OT_WARN_UNUSED_RESULT
+status_t entropy_pool_generate(uint32_t *buf, size_t len);
+
+/**
+ * Wipe and invalidate the random pool.
+ *
+ * Called internally by all operations that change the SW CSRNG state.
+ *
+ * @return Operation status in `status_t` format.
+ */
+OT_WARN_UNUSED_RESULT
+status_t entropy_pool_flush(void);
+
 #ifdef __cplusplus
 }
 #endif
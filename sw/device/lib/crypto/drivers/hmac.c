@@ -10,11 +10,16 @@
 #include "sw/device/lib/base/crc32.h"
 #include "sw/device/lib/base/hardened.h"
 #include "sw/device/lib/base/hardened_memory.h"
+#include "sw/device/lib/base/macros.h"
 #include "sw/device/lib/base/memory.h"
 #include "sw/device/lib/crypto/drivers/entropy.h"
 #include "sw/device/lib/crypto/drivers/rv_core_ibex.h"
 #include "sw/device/lib/crypto/impl/status.h"
 
+#ifdef HAS_DMA
+#include "sw/device/lib/crypto/drivers/dma.h"
+#endif
+
 #include "hw/top/hmac_regs.h"  // Generated.
 
 // Module ID for status codes.
@@ -330,14 +335,14 @@ static status_t hmac_context_wipe(hmac_ctx_t *ctx) {
 }
 
 /**
- * Write given byte array into the `MSG_FIFO`. This function should only be
- * called when HMAC HWIP is already running and expecting further message bytes.
+ * Write given byte array into the `MSG_FIFO` with the CPU.
  *
  * @param message The incoming message buffer to be fed into HMAC_FIFO.
  * @param message_len The length of `message` in bytes.
  * @return Result of the operation.
  */
-static status_t msg_fifo_write(const uint8_t *message, size_t message_len) {
+static status_t msg_fifo_write_cpu(const uint8_t *message,
+                                   size_t message_len) {
   // TODO(#23191): Should we handle backpressure here?
   // Begin by writing a one byte at a time until the data is aligned.
   size_t i = 0;
@@ -365,6 +370,104 @@ static status_t msg_fifo_write(const uint8_t *message, size_t message_len) {
   return OTCRYPTO_OK;
 }
 
+/**
+ * Split a message into the parts written by the CPU and by the DMA.
+ *
+ * The DMA only moves the word-aligned middle of the message, and only if it is
+ * long enough to be worth it; the unaligned head and tail are written by the
+ * CPU. Without DMA support, the whole message goes in the head.
+ *
+ * @param message The message.
+ * @param message_len The length of `message` in bytes.
+ * @param[out] head_len Number of leading bytes to write with the CPU.
+ * @param[out] dma_len Number of bytes after the head to write with the DMA.
+ */
+static void msg_fifo_split(const uint8_t *message, size_t message_len,
+                           size_t *head_len, size_t *dma_len) {
+  *head_len = message_len;
+  *dma_len = 0;
+#ifdef HAS_DMA
+  size_t misalignment = misalignment32_of((uintptr_t)message);
+  size_t head = misalignment == 0 ? 0 : sizeof(uint32_t) - misalignment;
+  if (message_len < head + kDmaMinTransferBytes) {
+    return;
+  }
+  size_t bulk_len = (message_len - head) & ~(sizeof(uint32_t) - 1);
+  // Fall back to the CPU if the DMA may not read the message.
+  if (dma_memory_range_check(&message[head], bulk_len) != kHardenedBoolTrue) {
+    return;
+  }
+  *head_len = head;
+  *dma_len = bulk_len;
+#endif
+}
+
+#ifdef HAS_DMA
+/**
+ * Stop and clear HMAC HWIP after a failed DMA transfer.
+ *
+ * The message FIFO holds an unknown part of the message at this point, so the
+ * operation cannot be resumed. The caller's context is left untouched and
+ * still describes the state before the failed update.
+ */
+static void dma_failure_clear(void) {
+  uint32_t cmd =
+      bitfield_bit32_write(HMAC_CMD_REG_RESVAL, HMAC_CMD_HASH_STOP_BIT, 1);
+  abs_mmio_write32(hmac_base() + HMAC_CMD_REG_OFFSET, cmd);
+  // Best effort: HMAC may not reach a block boundary with a partial message,
+  // in which case `clear` still disables and wipes it.
+  OT_DISCARD(status_ok(hmac_idle_wait()));
+  OT_DISCARD(status_ok(clear()));
+}
+
+/**
+ * Write the bulk of a message into `MSG_FIFO` with the DMA and wait for it.
+ *
+ * Clears HMAC HWIP if the transfer fails.
+ *
+ * @param message Word-aligned message bytes.
+ * @param message_len Length of `message` in bytes (multiple of 4).
+ * @return Result of the operation.
+ */
+static status_t msg_fifo_write_dma(const uint8_t *message, size_t message_len) {
+  status_t res = dma_fifo_write_start(hmac_base() + HMAC_MSG_FIFO_REG_OFFSET,
+                                      message, message_len);
+  if (status_ok(res)) {
+    res = dma_transfer_wait();
+  }
+  if (!status_ok(res)) {
+    dma_failure_clear();
+  }
+  return res;
+}
+#endif
+
+/**
+ * Write given byte array into the `MSG_FIFO`. This function should only be
+ * called when HMAC HWIP is already running and expecting further message bytes.
+ *
+ * On tops with a DMA controller, long messages are moved into the FIFO by the
+ * DMA.
+ *
+ * @param message The incoming message buffer to be fed into HMAC_FIFO.
+ * @param message_len The length of `message` in bytes.
+ * @return Result of the operation.
+ */
+static status_t msg_fifo_write(const uint8_t *message, size_t message_len) {
+  size_t head_len;
+  size_t dma_len;
+  msg_fifo_split(message, message_len, &head_len, &dma_len);
+  HARDENED_TRY(msg_fifo_write_cpu(message, head_len));
+#ifdef HAS_DMA
+  if (dma_len != 0) {
+    HARDENED_TRY(msg_fifo_write_dma(&message[head_len], dma_len));
+  }
+#endif
+  size_t written = head_len + dma_len;
+  HARDENED_TRY(msg_fifo_write_cpu(&message[written], message_len - written));
+  return OTCRYPTO_OK;
+}
+
 /**
  * Determine the HMAC block configuration register.
  *
@@ -713,6 +816,38 @@ hardened_bool_t hmac_key_integrity_checksum_check(const hmac_key_t *key) {
   return kHardenedBoolFalse;
 }
 
+/**
+ * Complete an update once all full blocks have been written to the FIFO.
+ *
+ * Stops the hash, saves the context and keeps the leftover bytes as the new
+ * partial block.
+ *
+ * @param ctx Context object.
+ * @param leftover Bytes that did not fill a block.
+ * @param leftover_len Number of leftover bytes.
+ * @return Result of the operation.
+ */
+static status_t update_stop(hmac_ctx_t *ctx, const uint8_t *leftover,
+                            size_t leftover_len) {
+  // Send the STOP command.
+  uint32_t cmd =
+      bitfield_bit32_write(HMAC_CMD_REG_RESVAL, HMAC_CMD_HASH_STOP_BIT, 1);
+  abs_mmio_write32(hmac_base() + HMAC_CMD_REG_OFFSET, cmd);
+
+  // Wait for HMAC to be done, then store the context.
+  HARDENED_TRY(hmac_idle_wait());
+  context_save(ctx);
+
+  // Write leftover bytes to `partial_block`, so that future update/final call
+  // can feed them to HMAC HWIP.
+  memcpy(ctx->partial_block, leftover, leftover_len);
+  ctx->partial_block_bytelen = leftover_len;
+
+  // Clean up.
+  HARDENED_TRY(clear());
+  return OTCRYPTO_OK;
+}
+
 status_t hmac_update(hmac_ctx_t *ctx, const uint8_t *data, size_t len) {
   // Make sure that the entropy complex is configured correctly.
   HARDENED_TRY(entropy_complex_check());
@@ -742,23 +877,79 @@ status_t hmac_update(hmac_ctx_t *ctx, const uint8_t *data, size_t len) {
                               ctx->partial_block_bytelen));
   HARDENED_TRY(msg_fifo_write(data, len - leftover_len));
 
-  // Send the STOP command.
-  uint32_t cmd =
-      bitfield_bit32_write(HMAC_CMD_REG_RESVAL, HMAC_CMD_HASH_STOP_BIT, 1);
-  abs_mmio_write32(hmac_base() + HMAC_CMD_REG_OFFSET, cmd);
+  return update_stop(ctx, data + (len - leftover_len), leftover_len);
+}
 
-  // Wait for HMAC to be done, then store the context.
-  HARDENED_TRY(hmac_idle_wait());
-  context_save(ctx);
+status_t hmac_update_async_start(hmac_ctx_t *ctx, const uint8_t *data,
+                                 size_t len, hmac_async_update_t *op) {
+  op->pending = kHardenedBoolFalse;
 
-  // Write leftover bytes to `partial_block`, so that future update/final call
-  // can feed them to HMAC HWIP.
-  memcpy(ctx->partial_block, data + (len - leftover_len), leftover_len);
-  ctx->partial_block_bytelen = leftover_len;
+  // Updates that do not fill a block, or that are too short to be worth a DMA
+  // transfer, complete synchronously.
+  size_t block_bytelen = ctx->msg_block_wordlen * sizeof(uint32_t);
+  if (len < block_bytelen - ctx->partial_block_bytelen) {
+    return hmac_update(ctx, data, len);
+  }
+  size_t len_rem = len % block_bytelen;
+  size_t leftover_len = (ctx->partial_block_bytelen + len_rem) % block_bytelen;
+  size_t head_len;
+  size_t dma_len;
+  msg_fifo_split(data, len - leftover_len, &head_len, &dma_len);
+  if (dma_len == 0) {
+    return hmac_update(ctx, data, len);
+  }
 
-  // Clean up.
-  HARDENED_TRY(clear());
+#ifdef HAS_DMA
+  HARDENED_TRY(entropy_complex_check());
+  HARDENED_TRY(context_restore(ctx));
+
+  // Write the partial block and the unaligned head with the CPU, then hand the
+  // bulk of the message over to the DMA.
+  HARDENED_TRY(msg_fifo_write_cpu((unsigned char *)ctx->partial_block,
+                                  ctx->partial_block_bytelen));
+  HARDENED_TRY(msg_fifo_write_cpu(data, head_len));
+  status_t res = dma_fifo_write_start(hmac_base() + HMAC_MSG_FIFO_REG_OFFSET,
+                                      &data[head_len], dma_len);
+  if (!status_ok(res)) {
+    dma_failure_clear();
+    return res;
+  }
+
+  op->tail = &data[head_len + dma_len];
+  op->tail_len = len - leftover_len - head_len - dma_len;
+  op->leftover = &data[len - leftover_len];
+  op->leftover_len = leftover_len;
+  op->pending = kHardenedBoolTrue;
   return OTCRYPTO_OK;
+#else
+  return OTCRYPTO_FATAL_ERR;
+#endif
+}
+
+status_t hmac_update_async_finalize(hmac_ctx_t *ctx, hmac_async_update_t *op) {
+  if (op->pending == kHardenedBoolFalse) {
+    // The update already completed in `hmac_update_async_start`.
+    return OTCRYPTO_OK;
+  }
+  HARDENED_CHECK_EQ(op->pending, kHardenedBoolTrue);
+
+#ifdef HAS_DMA
+  status_t res = dma_transfer_check();
+  if (status_err(res) == kUnavailable) {
+    // Still running; `res` is `OTCRYPTO_ASYNC_INCOMPLETE`.
+    return res;
+  }
+  op->pending = kHardenedBoolFalse;
+  if (!status_ok(res)) {
+    dma_failure_clear();
+    return res;
+  }
+
+  HARDENED_TRY(msg_fifo_write_cpu(op->tail, op->tail_len));
+  return update_stop(ctx, op->leftover, op->leftover_len);
+#else
+  return OTCRYPTO_FATAL_ERR;
+#endif
 }
 
 status_t hmac_final(hmac_ctx_t *ctx, uint32_t *digest) {
@@ -90,6 +90,22 @@ typedef struct hmac_ctx {
   size_t partial_block_bytelen;
 } hmac_ctx_t;
 
+/**
+ * State of an asynchronous update started with `hmac_update_async_start`.
+ *
+ * Contents are internal to the driver.
+ */
+typedef struct hmac_async_update {
+  // Message bytes to write with the CPU once the DMA transfer is done.
+  const uint8_t *tail;
+  size_t tail_len;
+  // Message bytes to keep as the new partial block.
+  const uint8_t *leftover;
+  size_t leftover_len;
+  // Whether a DMA transfer is still outstanding.
+  hardened_bool_t pending;
+} hmac_async_update_t;
+
 /**
  * One-shot SHA256 hash computation.
  *
@@ -326,6 +342,40 @@ hardened_bool_t hmac_key_integrity_checksum_check(const hmac_key_t *key);
 OT_WARN_UNUSED_RESULT
 status_t hmac_update(hmac_ctx_t *ctx, const uint8_t *data, size_t len);
 
+/**
+ * Start updating the context with additional message data in the background.
+ *
+ * On tops with a DMA controller, the bulk of the message is moved into the
+ * HMAC message FIFO by the DMA while this function returns. The HMAC block is
+ * busy until `hmac_update_async_finalize` succeeds; no other HMAC operation
+ * may be started in between, and `data` must stay valid and unmodified.
+ *
+ * Short updates, and all updates on tops without a DMA controller, are
+ * processed synchronously; `hmac_update_async_finalize` must still be called.
+ *
+ * @param ctx Context object referring to a particular SHA-2/HMAC stream.
+ * @param data Incoming message bytes to be processed into the stream.
+ * @param len Size of the `data` buffer in bytes.
+ * @param[out] op State of the asynchronous update.
+ * @return OK or error.
+ */
+OT_WARN_UNUSED_RESULT
+status_t hmac_update_async_start(hmac_ctx_t *ctx, const uint8_t *data,
+                                 size_t len, hmac_async_update_t *op);
+
+/**
+ * Complete an update started with `hmac_update_async_start`.
+ *
+ * Does not block: returns `OTCRYPTO_ASYNC_INCOMPLETE` while the DMA transfer
+ * is still running, in which case the caller should try again later.
+ *
+ * @param ctx Context object passed to `hmac_update_async_start`.
+ * @param op State of the asynchronous update.
+ * @return OK, `OTCRYPTO_ASYNC_INCOMPLETE`, or error.
+ */
+OT_WARN_UNUSED_RESULT
+status_t hmac_update_async_finalize(hmac_ctx_t *ctx, hmac_async_update_t *op);
+
 /**
  * Finalize the SHA-2/HMAC stream and return the digest/tag.
  *
@@ -12,6 +12,10 @@
 #include "sw/device/lib/crypto/drivers/rv_core_ibex.h"
 #include "sw/device/lib/crypto/impl/status.h"
 
+#ifdef HAS_DMA
+#include "sw/device/lib/crypto/drivers/dma.h"
+#endif
+
 #include "hw/top/kmac_regs.h"  // Generated.
 
 // Module ID for status codes.
@@ -371,6 +375,27 @@ static status_t wait_status_bit(uint32_t bit_position, bool bit_value) {
   }
 }
 
+#ifdef HAS_DMA
+/**
+ * Return KMAC HWIP to idle after a failed DMA transfer.
+ *
+ * The message FIFO holds an unknown part of the message, so the operation is
+ * finished without reading the digest; `CMD.DONE` wipes the Keccak state.
+ */
+static void dma_failure_clear(void) {
+  uint32_t cmd_reg = KMAC_CMD_REG_RESVAL;
+  cmd_reg = bitfield_field32_write(cmd_reg, KMAC_CMD_CMD_FIELD,
+                                   KMAC_CMD_CMD_VALUE_PROCESS);
+  abs_mmio_write32(kmac_base() + KMAC_CMD_REG_OFFSET, cmd_reg);
+  if (status_ok(wait_status_bit(KMAC_STATUS_SHA3_SQUEEZE_BIT, 1))) {
+    cmd_reg = KMAC_CMD_REG_RESVAL;
+    cmd_reg = bitfield_field32_write(cmd_reg, KMAC_CMD_CMD_FIELD,
+                                     KMAC_CMD_CMD_VALUE_DONE);
+    abs_mmio_write32(kmac_base() + KMAC_CMD_REG_OFFSET, cmd_reg);
+  }
+}
+#endif
+
 /**
  * Encode a given integer as byte array and return its size along with it.
  *
@@ -644,6 +669,25 @@ static status_t kmac_process_msg_blocks(kmac_operation_t operation,
     abs_mmio_write8(kBase + KMAC_MSG_FIFO_REG_OFFSET, message[i]);
   }
 
+#ifdef HAS_DMA
+  // Let the DMA move the word-aligned bulk of long messages if it may read
+  // them. A full FIFO stalls the DMA instead of the CPU.
+  size_t dma_len = (message_len - i) & ~(sizeof(uint32_t) - 1);
+  if (dma_len >= kDmaMinTransferBytes &&
+      dma_memory_range_check(&message[i], dma_len) == kHardenedBoolTrue) {
+    status_t res = dma_fifo_write_start(kBase + KMAC_MSG_FIFO_REG_OFFSET,
+                                        &message[i], dma_len);
+    if (status_ok(res)) {
+      res = dma_transfer_wait();
+    }
+    if (!status_ok(res)) {
+      dma_failure_clear();
+      return res;
+    }
+    i += dma_len;
+  }
+#endif
+
   // Write one word at a time as long as there is a full word available.
   for (; i + sizeof(uint32_t) <= message_len; i += sizeof(uint32_t)) {
     HARDENED_TRY(wait_status_bit(KMAC_STATUS_FIFO_FULL_BIT, 0));
@@ -57,5 +57,24 @@ status_t entropy_csrng_generate(const entropy_seed_material_t *seed_material,
 }
 
 status_t entropy_csrng_uninstantiate(void) { return OTCRYPTO_OK; }
+
+status_t entropy_pool_generate(uint32_t *buf, size_t len) {
+  if (len == 0) {
+    return OTCRYPTO_OK;
+  }
+  if (buf == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  // Since this mock library is for tests only, the randomness does not need
+  // to be real; it only needs to differ from one word to the next.
+  static uint32_t state = 0x6d2b79f5;
+  for (size_t i = 0; i < len; i++) {
+    state = state * 1664525 + 1013904223;
+    buf[i] = state;
+  }
+  return OTCRYPTO_OK;
+}
+
+status_t entropy_pool_flush(void) { return OTCRYPTO_OK; }
 }
 }  // namespace test
@@ -13,6 +13,7 @@
 // Module ID for status codes.
 #define MODULE_ID MAKE_MODULE_ID('g', 'h', 'a')
 
+#ifndef OTCRYPTO_GHASH_CLMUL
 enum {
   /**
    * Log2 of the number of bytes in an AES block.
@@ -51,6 +52,7 @@ static_assert(kGhashBlockNumBytes == (1 << kGhashBlockLog2NumBytes),
 static const uint16_t kGFReduceTable[16] = {
     0x0000, 0x201c, 0x4038, 0x6024, 0x8070, 0xa06c, 0xc048, 0xe054,
     0x00e1, 0x20fd, 0x40d9, 0x60c5, 0x8091, 0xa08d, 0xc0a9, 0xe0b5};
+#endif  // OTCRYPTO_GHASH_CLMUL
 
 /**
  * Performs a bitwise XOR of two blocks.
@@ -69,6 +71,7 @@ static inline void block_xor(const ghash_block_t *x, const ghash_block_t *y,
   }
 }
 
+#ifndef OTCRYPTO_GHASH_CLMUL
 /**
  * Logical right shift of an AES block.
  *
@@ -145,6 +148,7 @@ static uint8_t reverse_bits(uint8_t byte) {
   }
   return out;
 }
+#endif  // OTCRYPTO_GHASH_CLMUL
 
 uint32_t ghash_context_integrity_checksum(const ghash_context_t *ghash_ctx) {
   uint32_t ctx;
@@ -157,6 +161,10 @@ uint32_t ghash_context_integrity_checksum(const ghash_context_t *ghash_ctx) {
   crc32_add(&ctx, (unsigned char *)ghash_ctx->tbl0, sizeof(ghash_ctx->tbl0));
   crc32_add(&ctx, (unsigned char *)&ghash_ctx->correction_term0,
             sizeof(ghash_ctx->correction_term0));
+#ifdef OTCRYPTO_GHASH_CLMUL
+  crc32_add(&ctx, (unsigned char *)&ghash_ctx->correction_term0_agg,
+            sizeof(ghash_ctx->correction_term0_agg));
+#endif
   crc32_add(&ctx, (unsigned char *)&ghash_ctx->enc_initial_counter_block0,
             sizeof(ghash_ctx->enc_initial_counter_block0));
   // Note that we do not calculate the crc over the state.
@@ -172,6 +180,7 @@ hardened_bool_t ghash_context_integrity_checksum_check(
   return kHardenedBoolFalse;
 }
 
+#ifndef OTCRYPTO_GHASH_CLMUL
 void ghash_init_subkey(const uint32_t *hash_subkey, ghash_block_t *tbl) {
   // Initialize 0 * H = 0.
   memset(tbl[0].data, 0, kGhashBlockNumBytes);
@@ -193,16 +202,6 @@ void ghash_init_subkey(const uint32_t *hash_subkey, ghash_block_t *tbl) {
   }
 }
 
-void ghash_init(ghash_context_t *ctx) {
-  // Randomize the initial state.
-  hardened_memshred(ctx->state0.data, kGhashBlockNumWords);
-  hardened_memshred(ctx->state1.data, kGhashBlockNumWords);
-  // Initialize the ghash block counter.
-  ctx->ghash_block_cnt = 0;
-
-  ctx->checksum = ghash_context_integrity_checksum(ctx);
-}
-
 /**
  * Multiply the GHASH state by the hash subkey.
  *
@@ -221,7 +220,7 @@ void ghash_init(ghash_context_t *ctx) {
  * @return Multiplication of the state and the hash subkey.
  */
 static ghash_block_t galois_mul_state_key(ghash_block_t state,
-                                          ghash_block_t tbl[16]) {
+                                          const ghash_block_t *tbl) {
   // Initialize the multiplication result to 0.
   ghash_block_t result;
   memset(result.data, 0, kGhashBlockNumBytes);
@@ -268,6 +267,258 @@ static ghash_block_t galois_mul_state_key(ghash_block_t state,
   }
   return result;
 }
+#else   // OTCRYPTO_GHASH_CLMUL
+enum {
+  /**
+   * Number of 32-bit words in an unreduced 256-bit carry-less product.
+   */
+  kGhashProductNumWords = 2 * kGhashBlockNumWords,
+};
+
+/**
+ * Carry-less multiply of two 32-bit words, low half of the product.
+ *
+ * Uses the Zbc `clmul` instruction when available. The portable fallback is
+ * constant-time and only exists so that the backend can be exercised in host
+ * unit tests.
+ *
+ * @param a First operand.
+ * @param b Second operand.
+ * @return Bits 0..31 of the carry-less product.
+ */
+static inline uint32_t clmul32(uint32_t a, uint32_t b) {
+#if defined(OT_PLATFORM_RV32) && defined(__riscv_zbc)
+  uint32_t out;
+  asm("clmul %0, %1, %2" : "=r"(out) : "r"(a), "r"(b));
+  return out;
+#else
+  uint32_t out = 0;
+  for (size_t i = 0; i < 32; ++i) {
+    out ^= (a << i) & (0 - ((b >> i) & 1));
+  }
+  return out;
+#endif
+}
+
+/**
+ * Carry-less multiply of two 32-bit words, high half of the product.
+ *
+ * Uses the Zbc `clmulh` instruction when available; see `clmul32`.
+ *
+ * @param a First operand.
+ * @param b Second operand.
+ * @return Bits 32..63 of the carry-less product.
+ */
+static inline uint32_t clmulh32(uint32_t a, uint32_t b) {
+#if defined(OT_PLATFORM_RV32) && defined(__riscv_zbc)
+  uint32_t out;
+  asm("clmulh %0, %1, %2" : "=r"(out) : "r"(a), "r"(b));
+  return out;
+#else
+  uint32_t out = 0;
+  for (size_t i = 1; i < 32; ++i) {
+    out ^= (a >> (32 - i)) & (0 - ((b >> i) & 1));
+  }
+  return out;
+#endif
+}
+
+/**
+ * Karatsuba carry-less multiplication of two 64-bit values.
+ *
+ * Operands and result are little-endian arrays of 32-bit words.
+ *
+ * @param a First operand (2 words).
+ * @param b Second operand (2 words).
+ * @param[out] out Carry-less product (4 words).
+ */
+static inline void clmul64(const uint32_t *a, const uint32_t *b,
+                           uint32_t *out) {
+  uint32_t lo0 = clmul32(a[0], b[0]);
+  uint32_t lo1 = clmulh32(a[0], b[0]);
+  uint32_t hi0 = clmul32(a[1], b[1]);
+  uint32_t hi1 = clmulh32(a[1], b[1]);
+  uint32_t am = a[0] ^ a[1];
+  uint32_t bm = b[0] ^ b[1];
+  uint32_t mid0 = clmul32(am, bm) ^ lo0 ^ hi0;
+  uint32_t mid1 = clmulh32(am, bm) ^ lo1 ^ hi1;
+  out[0] = lo0;
+  out[1] = lo1 ^ mid0;
+  out[2] = hi0 ^ mid1;
+  out[3] = hi1;
+}
+
+/**
+ * Karatsuba carry-less multiplication of two 128-bit values.
+ *
+ * The product is accumulated (xored) into `acc`, so that several products can
+ * share a single modular reduction.
+ *
+ * @param a First operand (4 words).
+ * @param b Second operand (4 words).
+ * @param[in,out] acc Accumulator for the unreduced product (8 words).
+ */
+static void clmul128_acc(const uint32_t *a, const uint32_t *b, uint32_t *acc) {
+  uint32_t lo[4];
+  uint32_t hi[4];
+  uint32_t mid[4];
+  uint32_t am[2] = {a[0] ^ a[2], a[1] ^ a[3]};
+  uint32_t bm[2] = {b[0] ^ b[2], b[1] ^ b[3]};
+  clmul64(&a[0], &b[0], lo);
+  clmul64(&a[2], &b[2], hi);
+  clmul64(am, bm, mid);
+  for (size_t i = 0; i < 4; ++i) {
+    mid[i] ^= lo[i] ^ hi[i];
+    acc[i] ^= lo[i];
+    acc[i + 4] ^= hi[i];
+  }
+  for (size_t i = 0; i < 4; ++i) {
+    acc[i + 2] ^= mid[i];
+  }
+}
+
+/**
+ * Convert a GHASH block to the bit-reflected integer form.
+ *
+ * GCM stores the coefficient of x^0 in the MSB of the first byte. Reading the
+ * block as a big-endian 128-bit integer therefore puts the coefficient of x^i
+ * at bit (127 - i), which is the form the multiplier operates on.
+ *
+ * @param block Input block.
+ * @param[out] out Integer form, little-endian words (4 words).
+ */
+static inline void block_to_int(const ghash_block_t *block, uint32_t *out) {
+  for (size_t i = 0; i < kGhashBlockNumWords; ++i) {
+    out[i] = __builtin_bswap32(block->data[kGhashBlockNumWords - 1 - i]);
+  }
+}
+
+/**
+ * Convert from the bit-reflected integer form back to a GHASH block.
+ *
+ * @param in Integer form, little-endian words (4 words).
+ * @param[out] block Output block.
+ */
+static inline void int_to_block(const uint32_t *in, ghash_block_t *block) {
+  for (size_t i = 0; i < kGhashBlockNumWords; ++i) {
+    block->data[kGhashBlockNumWords - 1 - i] = __builtin_bswap32(in[i]);
+  }
+}
+
+/**
+ * Reduce a 256-bit carry-less product modulo the GCM polynomial.
+ *
+ * Because both operands are bit-reflected, the raw product is shifted by one
+ * bit with respect to the reflected form of the polynomial product; we fix
+ * that first. The lower 128 bits then hold the coefficients of x^128 and
+ * above, which are folded back using x^128 = x^7 + x^2 + x + 1 (a right shift
+ * by i in reflected form is a multiplication by x^i). The bits shifted out by
+ * that fold are folded once more up front, so the whole reduction is a fixed
+ * sequence of shifts and xors.
+ *
+ * @param prod Unreduced product (8 words).
+ * @param[out] result Reduced field element as a GHASH block.
+ */
+static void gf_reduce(const uint32_t *prod, ghash_block_t *result) {
+  uint32_t p[kGhashProductNumWords];
+  uint32_t carry = 0;
+  for (size_t i = 0; i < kGhashProductNumWords; ++i) {
+    p[i] = (prod[i] << 1) | carry;
+    carry = prod[i] >> 31;
+  }
+
+  // Fold the bits of the low half that would be shifted out below.
+  uint32_t d[kGhashBlockNumWords];
+  memcpy(d, p, sizeof(d));
+  d[3] ^= (p[0] << 31) ^ (p[0] << 30) ^ (p[0] << 25);
+
+  // out = high ^ d ^ (d >> 1) ^ (d >> 2) ^ (d >> 7)
+  uint32_t out[kGhashBlockNumWords];
+  for (size_t i = 0; i < kGhashBlockNumWords; ++i) {
+    uint32_t next = i + 1 < kGhashBlockNumWords ? d[i + 1] : 0;
+    out[i] = p[i + kGhashBlockNumWords] ^ d[i] ^ (d[i] >> 1) ^
+             (next << 31) ^ (d[i] >> 2) ^ (next << 30) ^ (d[i] >> 7) ^
+             (next << 25);
+  }
+  int_to_block(out, result);
+}
+
+void ghash_init_subkey(const uint32_t *hash_subkey, ghash_block_t *tbl) {
+  // tbl[0] = H and tbl[1] = H^2, both in integer form. Squaring is linear in
+  // GF(2^128), so for H = H0 + H1 the squares of the shares are also shares of
+  // H^2.
+  uint32_t h[kGhashBlockNumWords];
+  for (size_t i = 0; i < kGhashBlockNumWords; ++i) {
+    h[i] = __builtin_bswap32(hash_subkey[kGhashBlockNumWords - 1 - i]);
+  }
+  memcpy(tbl[0].data, h, kGhashBlockNumBytes);
+
+  uint32_t prod[kGhashProductNumWords] = {0};
+  ghash_block_t h2;
+  clmul128_acc(h, h, prod);
+  gf_reduce(prod, &h2);
+  block_to_int(&h2, tbl[1].data);
+}
+
+/**
+ * Multiply the GHASH state by the hash subkey.
+ *
+ * See NIST SP800-38D, section 6.3.
+ *
+ * Uses a two-level Karatsuba carry-less multiplication (9 clmul/clmulh pairs)
+ * followed by a branch-free reduction. Runs in constant time.
+ *
+ * @param state GHASH state.
+ * @param tbl Precomputed powers of the masked hash subkey.
+ * @return Multiplication of the state and the hash subkey.
+ */
+static ghash_block_t galois_mul_state_key(ghash_block_t state,
+                                          const ghash_block_t *tbl) {
+  uint32_t x[kGhashBlockNumWords];
+  uint32_t prod[kGhashProductNumWords] = {0};
+  block_to_int(&state, x);
+  clmul128_acc(x, tbl[0].data, prod);
+
+  ghash_block_t result;
+  gf_reduce(prod, &result);
+  return result;
+}
+
+/**
+ * Compute x1 * H^2 + x2 * H with a single modular reduction.
+ *
+ * This is the aggregated form of two Horner steps of GHASH.
+ *
+ * @param x1 First block (multiplied by H^2).
+ * @param x2 Second block (multiplied by H).
+ * @param tbl Precomputed powers of the masked hash subkey.
+ * @return The combined product.
+ */
+static ghash_block_t galois_mul2_state_key(const ghash_block_t *x1,
+                                           const ghash_block_t *x2,
+                                           const ghash_block_t *tbl) {
+  uint32_t x[kGhashBlockNumWords];
+  uint32_t prod[kGhashProductNumWords] = {0};
+  block_to_int(x1, x);
+  clmul128_acc(x, tbl[1].data, prod);
+  block_to_int(x2, x);
+  clmul128_acc(x, tbl[0].data, prod);
+
+  ghash_block_t result;
+  gf_reduce(prod, &result);
+  return result;
+}
+#endif  // OTCRYPTO_GHASH_CLMUL
+
+void ghash_init(ghash_context_t *ctx) {
+  // Randomize the initial state.
+  hardened_memshred(ctx->state0.data, kGhashBlockNumWords);
+  hardened_memshred(ctx->state1.data, kGhashBlockNumWords);
+  // Initialize the ghash block counter.
+  ctx->ghash_block_cnt = 0;
+
+  ctx->checksum = ghash_context_integrity_checksum(ctx);
+}
 
 /**
  * Single-block update function for GHASH.
@@ -346,6 +597,52 @@ static void ghash_process_block(ghash_context_t *ctx, ghash_block_t *block) {
   ctx->ghash_block_cnt++;
 }
 
+#ifdef OTCRYPTO_GHASH_CLMUL
+/**
+ * Two-block update function for GHASH with aggregated reduction.
+ *
+ * Equivalent to two calls to `ghash_process_block`, but each share only needs
+ * one modular reduction. Must not be used for the first block of a message,
+ * which needs the initial correction terms.
+ *
+ * @param ctx GHASH context.
+ * @param block0 First block to incorporate.
+ * @param block1 Second block to incorporate.
+ */
+static void ghash_process_two_blocks(ghash_context_t *ctx,
+                                     const ghash_block_t *block0,
+                                     const ghash_block_t *block1) {
+  // tmp = (share0+TN-1)+share1
+  ghash_block_t tmp;
+  hardened_memcpy(tmp.data, block0->data, kGhashBlockNumWords);
+  hardened_xor_in_place(tmp.data, ctx->state0.data, kGhashBlockNumWords);
+  hardened_xor_in_place(tmp.data, ctx->state1.data, kGhashBlockNumWords);
+
+  // Process share 0.
+  // share0 = tmp * H0^2 + TN * H0 + (S0*(H0^2+1))
+  ghash_block_t s0_tmp = galois_mul2_state_key(&tmp, block1, ctx->tbl0);
+  hardened_memcpy(ctx->state0.data, s0_tmp.data, kGhashBlockNumWords);
+  hardened_xor_in_place(ctx->state0.data, ctx->correction_term0_agg.data,
+                        kGhashBlockNumWords);
+
+  // Check the context once for each absorbed block.
+  HARDENED_CHECK_EQ(ghash_context_integrity_checksum_check(ctx),
+                    kHardenedBoolTrue);
+
+  // Process share 1.
+  // share1 = tmp * H1^2 + TN * H1 + (S0*H1^2)
+  ghash_block_t s1_tmp = galois_mul2_state_key(&tmp, block1, ctx->tbl1);
+  hardened_memcpy(ctx->state1.data, s1_tmp.data, kGhashBlockNumWords);
+  hardened_xor_in_place(ctx->state1.data, ctx->correction_term1_agg.data,
+                        kGhashBlockNumWords);
+
+  HARDENED_CHECK_EQ(ghash_context_integrity_checksum_check(ctx),
+                    kHardenedBoolTrue);
+
+  ctx->ghash_block_cnt += 2;
+}
+#endif  // OTCRYPTO_GHASH_CLMUL
+
 void ghash_process_full_blocks(ghash_context_t *ctx, size_t partial_len,
                                ghash_block_t *partial, size_t input_len,
                                const uint8_t *input) {
@@ -364,6 +661,18 @@ void ghash_process_full_blocks(ghash_context_t *ctx, size_t partial_len,
     // Process the block.
     ghash_process_block(ctx, partial);
 
+#ifdef OTCRYPTO_GHASH_CLMUL
+    // Process pairs of full blocks with a single reduction per share.
+    while (input_len >= 2 * kGhashBlockNumBytes) {
+      ghash_block_t next;
+      memcpy(partial->data, input, kGhashBlockNumBytes);
+      memcpy(next.data, input + kGhashBlockNumBytes, kGhashBlockNumBytes);
+      ghash_process_two_blocks(ctx, partial, &next);
+      input += 2 * kGhashBlockNumBytes;
+      input_len -= 2 * kGhashBlockNumBytes;
+    }
+#endif
+
     // Process any remaining full blocks of input.
     while (input_len >= kGhashBlockNumBytes) {
       memcpy(partial->data, input, kGhashBlockNumBytes);
@@ -428,6 +737,16 @@ void ghash_handle_enc_initial_counter_block(
   hardened_memcpy(s1.data, enc_initial_counter_block1, kGhashBlockNumWords);
   ctx->correction_term1_init = galois_mul_state_key(s1, ctx->tbl1);
 
+#ifdef OTCRYPTO_GHASH_CLMUL
+  // correction_term0_agg = S0 * (H0^2 + 1).
+  ghash_block_t zero = {.data = {0}};
+  mul_tmp = galois_mul2_state_key(&s0, &zero, ctx->tbl0);
+  block_xor(&mul_tmp, &s0, &ctx->correction_term0_agg);
+
+  // correction_term1_agg = S0 * H1^2.
+  ctx->correction_term1_agg = galois_mul2_state_key(&s0, &zero, ctx->tbl1);
+#endif
+
   // Save the encrypted initial counter blocks into the ghash context as we
   // need them throughout the ghash computations.
   hardened_memcpy(ctx->enc_initial_counter_block0.data,
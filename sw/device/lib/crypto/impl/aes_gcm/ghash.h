@@ -23,6 +23,23 @@ enum {
    * Size of a GHASH cipher block (128 bits) in words.
    */
   kGhashBlockNumWords = kGhashBlockNumBytes / sizeof(uint32_t),
+#ifdef OTCRYPTO_GHASH_CLMUL
+  /**
+   * Number of precomputed blocks per hash subkey share.
+   *
+   * The carry-less multiply backend only stores the powers H and H^2 of the
+   * hash subkey, in the bit-reflected integer form used by the multiplier.
+   */
+  kGhashSubkeyTableNumBlocks = 2,
+#else
+  /**
+   * Number of precomputed blocks per hash subkey share.
+   *
+   * The table-based backend stores the products of the hash subkey with all
+   * 4-bit polynomials.
+   */
+  kGhashSubkeyTableNumBlocks = 16,
+#endif
 };
 
 /**
@@ -36,11 +53,11 @@ typedef struct ghash_context {
   /**
    * Precomputed product table for the hash subkey share 0.
    */
-  ghash_block_t tbl0[16];
+  ghash_block_t tbl0[kGhashSubkeyTableNumBlocks];
   /**
    * Precomputed product table for the hash subkey share 1.
    */
-  ghash_block_t tbl1[16];
+  ghash_block_t tbl1[kGhashSubkeyTableNumBlocks];
   /**
    * Cipher block representing the current GHASH state for share 0.
    */
@@ -61,6 +78,18 @@ typedef struct ghash_context {
    * Precomputed initial correction term (S1 * H1) for state share 1.
    */
   ghash_block_t correction_term1_init;
+#ifdef OTCRYPTO_GHASH_CLMUL
+  /**
+   * Precomputed correction term (S0 * (H0^2+1)) for state share 0 when two
+   * blocks are absorbed with a single reduction.
+   */
+  ghash_block_t correction_term0_agg;
+  /**
+   * Precomputed correction term (S0 * H1^2) for state share 1 when two
+   * blocks are absorbed with a single reduction.
+   */
+  ghash_block_t correction_term1_agg;
+#endif
   /**
    * Encrypted initial counter block share 0.
    */
@@ -107,6 +136,9 @@ hardened_bool_t ghash_context_integrity_checksum_check(
  * This routine will precompute a product table for the hash subkey for the
  * GHASH context. It will not set the state to 0; call `ghash_init` afterwards.
  *
+ * The table holds `kGhashSubkeyTableNumBlocks` blocks; its contents depend on
+ * the GHASH backend selected at build time.
+ *
  * This operation should only be called once per key, and afterwards the
  * context object can be used for multiple separate GHASH operations with that
  * key. The reason for separating this and `ghash_init` into two functions is
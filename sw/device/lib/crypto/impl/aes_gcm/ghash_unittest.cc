@@ -22,6 +22,33 @@ std::array<uint32_t, 4> Zero = {
     0x0,
 };
 
+/**
+ * Sets up the CRC32 mock for a number of context checksum computations.
+ *
+ * @param crc32 CRC32 mock.
+ * @param ctx GHASH context whose checksum is computed.
+ * @param cycles Expected number of checksum computations.
+ */
+void ExpectChecksums(rom_test::MockCrc32 &crc32, ghash_context_t &ctx,
+                     int cycles) {
+  EXPECT_CALL(crc32, Init(testing::NotNull())).Times(cycles);
+  EXPECT_CALL(crc32, Add(testing::NotNull(), ctx.tbl0, sizeof(ctx.tbl0)))
+      .Times(cycles);
+  EXPECT_CALL(crc32, Add(testing::NotNull(), ctx.correction_term0.data, 16))
+      .Times(cycles);
+#ifdef OTCRYPTO_GHASH_CLMUL
+  EXPECT_CALL(crc32,
+              Add(testing::NotNull(), ctx.correction_term0_agg.data, 16))
+      .Times(cycles);
+#endif
+  EXPECT_CALL(crc32,
+              Add(testing::NotNull(), ctx.enc_initial_counter_block0.data, 16))
+      .Times(cycles);
+  EXPECT_CALL(crc32, Finish(testing::NotNull()))
+      .Times(cycles)
+      .WillRepeatedly(testing::Return(0));
+}
+
 TEST(Ghash, McGrawViegaTestCase1) {
   // GHASH computation from test case 1 of:
   // https://csrc.nist.rip/groups/ST/toolkit/BCM/documents/proposedmodes/gcm/gcm-spec.pdf
@@ -45,17 +72,7 @@ TEST(Ghash, McGrawViegaTestCase1) {
   ghash_init_subkey(Zero.data(), ctx.tbl1);
 
   constexpr int kExpectedCrc32Cycles = 3;
-  EXPECT_CALL(crc32_, Init(testing::NotNull())).Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Add(testing::NotNull(), ctx.tbl0, 256))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Add(testing::NotNull(), ctx.correction_term0.data, 16))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_,
-              Add(testing::NotNull(), ctx.enc_initial_counter_block0.data, 16))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Finish(testing::NotNull()))
-      .Times(kExpectedCrc32Cycles)
-      .WillRepeatedly(testing::Return(0));
+  ExpectChecksums(crc32_, ctx, kExpectedCrc32Cycles);
 
   ghash_handle_enc_initial_counter_block(Zero.data(), Zero.data(), &ctx);
   ghash_init(&ctx);
@@ -88,17 +105,7 @@ TEST(Ghash, ProcessFullBlocksOneByte) {
   ghash_init_subkey(Zero.data(), ctx.tbl1);
 
   constexpr int kExpectedCrc32Cycles = 2;
-  EXPECT_CALL(crc32_, Init(testing::NotNull())).Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Add(testing::NotNull(), ctx.tbl0, 256))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Add(testing::NotNull(), ctx.correction_term0.data, 16))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_,
-              Add(testing::NotNull(), ctx.enc_initial_counter_block0.data, 16))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Finish(testing::NotNull()))
-      .Times(kExpectedCrc32Cycles)
-      .WillRepeatedly(testing::Return(0));
+  ExpectChecksums(crc32_, ctx, kExpectedCrc32Cycles);
 
   ghash_handle_enc_initial_counter_block(Zero.data(), Zero.data(), &ctx);
   ghash_init(&ctx);
@@ -128,17 +135,7 @@ TEST(Ghash, Mul1) {
   ghash_init_subkey(Zero.data(), ctx.tbl1);
 
   constexpr int kExpectedCrc32Cycles = 4;
-  EXPECT_CALL(crc32_, Init(testing::NotNull())).Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Add(testing::NotNull(), ctx.tbl0, 256))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Add(testing::NotNull(), ctx.correction_term0.data, 16))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_,
-              Add(testing::NotNull(), ctx.enc_initial_counter_block0.data, 16))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Finish(testing::NotNull()))
-      .Times(kExpectedCrc32Cycles)
-      .WillRepeatedly(testing::Return(0));
+  ExpectChecksums(crc32_, ctx, kExpectedCrc32Cycles);
   constexpr int kExpectedCrc32AddCycles = 5;
 
   ghash_handle_enc_initial_counter_block(Zero.data(), Zero.data(), &ctx);
@@ -203,17 +200,7 @@ TEST(Ghash, McGrawViegaTestCase2) {
   ghash_init_subkey(Zero.data(), ctx.tbl1);
 
   constexpr int kExpectedCrc32Cycles = 5;
-  EXPECT_CALL(crc32_, Init(testing::NotNull())).Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Add(testing::NotNull(), ctx.tbl0, 256))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Add(testing::NotNull(), ctx.correction_term0.data, 16))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_,
-              Add(testing::NotNull(), ctx.enc_initial_counter_block0.data, 16))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Finish(testing::NotNull()))
-      .Times(kExpectedCrc32Cycles)
-      .WillRepeatedly(testing::Return(0));
+  ExpectChecksums(crc32_, ctx, kExpectedCrc32Cycles);
 
   ghash_handle_enc_initial_counter_block(Zero.data(), Zero.data(), &ctx);
   ghash_init(&ctx);
@@ -266,17 +253,7 @@ TEST(Ghash, ContextReset) {
   ghash_init_subkey(Zero.data(), ctx.tbl1);
 
   constexpr int kExpectedCrc32Cycles = 9;
-  EXPECT_CALL(crc32_, Init(testing::NotNull())).Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Add(testing::NotNull(), ctx.tbl0, 256))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Add(testing::NotNull(), ctx.correction_term0.data, 16))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_,
-              Add(testing::NotNull(), ctx.enc_initial_counter_block0.data, 16))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Finish(testing::NotNull()))
-      .Times(kExpectedCrc32Cycles)
-      .WillRepeatedly(testing::Return(0));
+  ExpectChecksums(crc32_, ctx, kExpectedCrc32Cycles);
 
   ghash_handle_enc_initial_counter_block(Zero.data(), Zero.data(), &ctx);
 
@@ -347,17 +324,7 @@ TEST(Ghash, McGrawViegaTestCase18) {
   ghash_init_subkey(Zero.data(), ctx.tbl1);
 
   constexpr int kExpectedCrc32Cycles = 10;
-  EXPECT_CALL(crc32_, Init(testing::NotNull())).Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Add(testing::NotNull(), ctx.tbl0, 256))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Add(testing::NotNull(), ctx.correction_term0.data, 16))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_,
-              Add(testing::NotNull(), ctx.enc_initial_counter_block0.data, 16))
-      .Times(kExpectedCrc32Cycles);
-  EXPECT_CALL(crc32_, Finish(testing::NotNull()))
-      .Times(kExpectedCrc32Cycles)
-      .WillRepeatedly(testing::Return(0));
+  ExpectChecksums(crc32_, ctx, kExpectedCrc32Cycles);
 
   ghash_handle_enc_initial_counter_block(Zero.data(), Zero.data(), &ctx);
   ghash_init(&ctx);
@@ -371,5 +338,88 @@ TEST(Ghash, McGrawViegaTestCase18) {
   EXPECT_THAT(result, testing::ElementsAreArray(exp_result));
 }
 
+TEST(Ghash, McGrawViegaTestCase18Masked) {
+  // Same computation as `McGrawViegaTestCase18`, but with random shares of the
+  // hash subkey and of the encrypted initial counter block. The ciphertext is
+  // long enough that the carry-less multiply backend absorbs two blocks with a
+  // single reduction, so this exercises the aggregated correction terms with
+  // non-zero masks. Both backends must produce the same result.
+  //
+  // The expected result is GHASH(H,A,C) + S, where S = S0 + S1.
+  std::array<uint32_t, 4> H = {
+      0x05f2beac,
+      0xebb8b479,
+      0xac9b88ce,
+      0xd7da3287,
+  };
+  std::array<uint32_t, 4> H0 = {
+      0x7def9ca3,
+      0x605e50b6,
+      0x772a66b9,
+      0x7a11005a,
+  };
+  std::array<uint32_t, 4> H1;
+  for (size_t i = 0; i < H.size(); i++) {
+    H1[i] = H[i] ^ H0[i];
+  }
+  std::array<uint32_t, 4> S0 = {
+      0x97b38bd4,
+      0x1b06c181,
+      0x3f231cdf,
+      0x290ae120,
+  };
+  std::array<uint32_t, 4> S1 = {
+      0x0edf0f42,
+      0x3e972c1e,
+      0xebabe33f,
+      0x82f1f745,
+  };
+  std::array<uint32_t, 5> A = {
+      0xcefaedfe, 0xefbeadde, 0xcefaedfe, 0xefbeadde, 0xd2daadab,
+  };
+  std::array<uint32_t, 15> C = {
+      0x2fef8d5a, 0xf1539e0c, 0x53785df7, 0x202a9e65, 0x2ab2b2ee,
+      0x1964deaf, 0x4fab58a0, 0xf46b746f, 0xb7c3c00f, 0x4544f280,
+      0xf1eba32d, 0xde2cd8c5, 0x978941a2, 0x2ef80e20, 0x3f7eae44,
+  };
+  std::array<uint32_t, 4> exp_result = {
+      0x6fcfffd5,
+      0x694dacc5,
+      0x42872172,
+      0x0b177f1a,
+  };
+  for (size_t i = 0; i < exp_result.size(); i++) {
+    exp_result[i] ^= S0[i] ^ S1[i];
+  }
+
+  // Encode bitlengths of A and C as big-endian 64-bit integers.
+  std::array<uint64_t, 2> bitlengths = {
+      A.size() * sizeof(uint32_t) * 8,
+      C.size() * sizeof(uint32_t) * 8,
+  };
+  bitlengths[0] = __builtin_bswap64(bitlengths[0]);
+  bitlengths[1] = __builtin_bswap64(bitlengths[1]);
+
+  // Compute GHASH(H, A, C) + S.
+  ghash_context_t ctx;
+  rom_test::MockCrc32 crc32_;
+  ghash_init_subkey(H0.data(), ctx.tbl0);
+  ghash_init_subkey(H1.data(), ctx.tbl1);
+
+  constexpr int kExpectedCrc32Cycles = 10;
+  ExpectChecksums(crc32_, ctx, kExpectedCrc32Cycles);
+
+  ghash_handle_enc_initial_counter_block(S0.data(), S1.data(), &ctx);
+  ghash_init(&ctx);
+  ghash_update(&ctx, A.size() * sizeof(uint32_t), (unsigned char *)A.data());
+  ghash_update(&ctx, C.size() * sizeof(uint32_t), (unsigned char *)C.data());
+  ghash_update(&ctx, bitlengths.size() * sizeof(uint64_t),
+               (unsigned char *)bitlengths.data());
+  uint32_t result[kGhashBlockNumWords];
+  ghash_final(&ctx, result);
+
+  EXPECT_THAT(result, testing::ElementsAreArray(exp_result));
+}
+
 }  // namespace
 }  // namespace ghash_unittest
@@ -206,6 +206,16 @@ static otcrypto_status_t generate(hardened_bool_t fips_check,
 otcrypto_status_t otcrypto_drbg_generate(
     otcrypto_const_byte_buf_t additional_input,
     otcrypto_word32_buf_t drbg_output) {
+  if (additional_input.len == 0 && drbg_output.len != 0) {
+    // Without additional input, serve the request from the random pool. The
+    // pool checks the entropy complex itself whenever it is refilled.
+    if (drbg_output.data == NULL) {
+      return OTCRYPTO_BAD_ARGS;
+    }
+    HARDENED_TRY(hardened_memshred(drbg_output.data, drbg_output.len));
+    return entropy_pool_generate(drbg_output.data, drbg_output.len);
+  }
+
   // Ensure the entropy complex is initialized.
   HARDENED_TRY(entropy_complex_check());
 
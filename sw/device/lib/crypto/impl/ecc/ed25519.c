@@ -0,0 +1,113 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/lib/crypto/impl/ecc/ed25519.h"
+
+#include "sw/device/lib/base/hardened.h"
+#include "sw/device/lib/crypto/drivers/otbn.h"
+
+#include "hw/top_earlgrey/sw/autogen/top_earlgrey.h"
+
+// Module ID for status codes.
+#define MODULE_ID MAKE_MODULE_ID('e', 'd', 'r')
+
+// Declare the OTBN app.
+OTBN_DECLARE_APP_SYMBOLS(run_ed25519);  // The OTBN Ed25519 app.
+static const otbn_app_t kOtbnAppEd25519 = OTBN_APP_T_INIT(run_ed25519);
+
+// Declare offsets for input and output buffers.
+OTBN_DECLARE_SYMBOL_ADDR(run_ed25519, mode);
+OTBN_DECLARE_SYMBOL_ADDR(run_ed25519, ed25519_hash_k);
+OTBN_DECLARE_SYMBOL_ADDR(run_ed25519, ed25519_public_key);
+OTBN_DECLARE_SYMBOL_ADDR(run_ed25519, ed25519_sig_R);
+OTBN_DECLARE_SYMBOL_ADDR(run_ed25519, ed25519_sig_S);
+OTBN_DECLARE_SYMBOL_ADDR(run_ed25519, ed25519_verify_result);
+
+static const otbn_addr_t kOtbnVarMode = OTBN_ADDR_T_INIT(run_ed25519, mode);
+static const otbn_addr_t kOtbnVarHashK =
+    OTBN_ADDR_T_INIT(run_ed25519, ed25519_hash_k);
+static const otbn_addr_t kOtbnVarPublicKey =
+    OTBN_ADDR_T_INIT(run_ed25519, ed25519_public_key);
+static const otbn_addr_t kOtbnVarSigR =
+    OTBN_ADDR_T_INIT(run_ed25519, ed25519_sig_R);
+static const otbn_addr_t kOtbnVarSigS =
+    OTBN_ADDR_T_INIT(run_ed25519, ed25519_sig_S);
+static const otbn_addr_t kOtbnVarVerifyResult =
+    OTBN_ADDR_T_INIT(run_ed25519, ed25519_verify_result);
+
+// Declare mode constants.
+OTBN_DECLARE_SYMBOL_ADDR(run_ed25519, MODE_VERIFY);
+OTBN_DECLARE_SYMBOL_ADDR(run_ed25519, MODE_VERIFY_COFACTORED);
+static const uint32_t kOtbnEd25519ModeVerify =
+    OTBN_ADDR_T_INIT(run_ed25519, MODE_VERIFY);
+static const uint32_t kOtbnEd25519ModeVerifyCofactored =
+    OTBN_ADDR_T_INIT(run_ed25519, MODE_VERIFY_COFACTORED);
+
+enum {
+  /*
+   * Mode is represented by a single word.
+   */
+  kOtbnEd25519ModeWords = 1,
+};
+
+status_t ed25519_verify_start(const ed25519_signature_t *signature,
+                              const uint32_t hash_k[kEd25519HashWords],
+                              const uint32_t public_key[kEd25519PointWords],
+                              hardened_bool_t cofactored) {
+  // Select the verification equation.
+  uint32_t mode;
+  if (cofactored == kHardenedBoolTrue) {
+    HARDENED_CHECK_EQ(launder32(cofactored), kHardenedBoolTrue);
+    mode = kOtbnEd25519ModeVerifyCofactored;
+  } else if (cofactored == kHardenedBoolFalse) {
+    HARDENED_CHECK_EQ(launder32(cofactored), kHardenedBoolFalse);
+    mode = kOtbnEd25519ModeVerify;
+  } else {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Load the Ed25519 app. Fails if OTBN is non-idle.
+  HARDENED_TRY(otbn_load_app(kOtbnAppEd25519));
+
+  // Set mode so start() will jump into the requested verification routine.
+  HARDENED_TRY(otbn_dmem_write(kOtbnEd25519ModeWords, &mode, kOtbnVarMode));
+
+  // Set the challenge hash k. The hash output is interpreted as a
+  // little-endian integer (RFC 8032, section 5.1.7), which matches the byte
+  // order OTBN expects.
+  HARDENED_TRY(otbn_dmem_write(kEd25519HashWords, hash_k, kOtbnVarHashK));
+
+  // Set the public key A.
+  HARDENED_TRY(
+      otbn_dmem_write(kEd25519PointWords, public_key, kOtbnVarPublicKey));
+
+  // Set the signature R.
+  HARDENED_TRY(otbn_dmem_write(kEd25519PointWords, signature->r, kOtbnVarSigR));
+
+  // Set the signature S.
+  HARDENED_TRY(
+      otbn_dmem_write(kEd25519ScalarWords, signature->s, kOtbnVarSigS));
+
+  // Start the OTBN routine.
+  return otbn_execute();
+}
+
+status_t ed25519_verify_finalize(hardened_bool_t *result) {
+  // Spin here waiting for OTBN to complete.
+  HARDENED_TRY_WIPE_DMEM(otbn_busy_wait_for_done());
+
+  // Read the verification result out of DMEM.
+  uint32_t verify_result;
+  HARDENED_TRY_WIPE_DMEM(
+      otbn_dmem_read(1, kOtbnVarVerifyResult, &verify_result));
+  if (launder32(verify_result) == kHardenedBoolTrue) {
+    HARDENED_CHECK_EQ(verify_result, kHardenedBoolTrue);
+    *result = kHardenedBoolTrue;
+  } else {
+    *result = kHardenedBoolFalse;
+  }
+
+  // Wipe DMEM.
+  return otbn_dmem_sec_wipe();
+}
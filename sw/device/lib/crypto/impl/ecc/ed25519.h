@@ -0,0 +1,113 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OPENTITAN_SW_DEVICE_LIB_CRYPTO_IMPL_ECC_ED25519_H_
+#define OPENTITAN_SW_DEVICE_LIB_CRYPTO_IMPL_ECC_ED25519_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sw/device/lib/base/hardened.h"
+#include "sw/device/lib/crypto/drivers/otbn.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+enum {
+  /**
+   * Length of an encoded Ed25519 curve point in bits.
+   */
+  kEd25519PointBits = 256,
+  /**
+   * Length of an encoded Ed25519 curve point in bytes.
+   */
+  kEd25519PointBytes = kEd25519PointBits / 8,
+  /**
+   * Length of an encoded Ed25519 curve point in words.
+   */
+  kEd25519PointWords = kEd25519PointBytes / sizeof(uint32_t),
+  /**
+   * Length of an encoded element of the Ed25519 scalar field in bits.
+   */
+  kEd25519ScalarBits = 256,
+  /**
+   * Length of an encoded scalar in bytes.
+   */
+  kEd25519ScalarBytes = kEd25519ScalarBits / 8,
+  /**
+   * Length of an encoded scalar in words.
+   */
+  kEd25519ScalarWords = kEd25519ScalarBytes / sizeof(uint32_t),
+  /**
+   * Length of the SHA-512 hash used to derive the challenge k in bits.
+   */
+  kEd25519HashBits = 512,
+  /**
+   * Length of the SHA-512 hash used to derive the challenge k in bytes.
+   */
+  kEd25519HashBytes = kEd25519HashBits / 8,
+  /**
+   * Length of the SHA-512 hash used to derive the challenge k in words.
+   */
+  kEd25519HashWords = kEd25519HashBytes / sizeof(uint32_t),
+};
+
+/**
+ * A type that holds an Ed25519 signature.
+ *
+ * The signature consists of the encoded point R and the scalar S, in the byte
+ * order of RFC 8032.
+ */
+typedef struct ed25519_signature {
+  uint32_t r[kEd25519PointWords];
+  uint32_t s[kEd25519ScalarWords];
+} ed25519_signature_t;
+
+/**
+ * Start an async Ed25519 signature verification operation on OTBN.
+ *
+ * The caller computes the challenge hash k = SHA-512(dom2(F, C) || R || A ||
+ * PH(M)) and passes it in the byte order of the hash output; OTBN reduces it
+ * modulo the group order.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * @param signature Signature to be verified.
+ * @param hash_k Challenge hash k.
+ * @param public_key Encoded public key A.
+ * @param cofactored Whether to use the cofactored verification equation.
+ * @return Result of the operation (OK or error).
+ */
+OT_WARN_UNUSED_RESULT
+status_t ed25519_verify_start(const ed25519_signature_t *signature,
+                              const uint32_t hash_k[kEd25519HashWords],
+                              const uint32_t public_key[kEd25519PointWords],
+                              hardened_bool_t cofactored);
+
+/**
+ * Finish an async Ed25519 signature verification operation on OTBN.
+ *
+ * Blocks until OTBN is idle.
+ *
+ * If the signature is valid, writes `kHardenedBoolTrue` to `result`;
+ * otherwise, writes `kHardenedBoolFalse`.
+ *
+ * Note: the caller must check the `result` buffer in order to determine if a
+ * signature passed verification. If a signature is invalid, but nothing goes
+ * wrong during computation (e.g. hardware errors, failed preconditions), the
+ * status will be OK but `result` will be `kHardenedBoolFalse`.
+ *
+ * @param[out] result Output buffer (true if signature is valid, false
+ * otherwise)
+ * @return Result of the operation (OK or error).
+ */
+OT_WARN_UNUSED_RESULT
+status_t ed25519_verify_finalize(hardened_bool_t *result);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // OPENTITAN_SW_DEVICE_LIB_CRYPTO_IMPL_ECC_ED25519_H_
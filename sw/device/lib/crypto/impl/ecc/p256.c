@@ -82,12 +82,12 @@ enum {
   /*
    * The expected instruction counts for constant time functions.
    */
-  kModeKeygenInsCnt = 573915,
-  kModeKeygenSideloadInsCnt = 573800,
+  kModeKeygenInsCnt = 244627,
+  kModeKeygenSideloadInsCnt = 244512,
   kModeEcdhInsCnt = 581598,
   kModeEcdhSideloadInsCnt = 581658,
-  kModeEcdsaSignInsCnt = 607087,
-  kModeEcdsaSignSideloadInsCnt = 607147,
+  kModeEcdsaSignInsCnt = 277799,
+  kModeEcdsaSignSideloadInsCnt = 277859,
 };
 
 static status_t p256_masked_scalar_write(p256_masked_scalar_t *src,
@@ -4,12 +4,28 @@
 
 #include "sw/device/lib/crypto/include/ed25519.h"
 
+#include "sw/device/lib/crypto/drivers/entropy.h"
+#include "sw/device/lib/crypto/drivers/hmac.h"
+#include "sw/device/lib/crypto/impl/ecc/ed25519.h"
+#include "sw/device/lib/crypto/impl/integrity.h"
 #include "sw/device/lib/crypto/impl/status.h"
 #include "sw/device/lib/crypto/include/datatypes.h"
 
 // Module ID for status codes.
 #define MODULE_ID MAKE_MODULE_ID('e', '2', '5')
 
+/**
+ * Domain separation prefix dom2(1, "") for Ed25519ph (RFC 8032, section 5.1).
+ *
+ * Consists of the string "SigEd25519 no Ed25519 collisions", the prehash flag
+ * 1, and the length 0 of the (empty) context string.
+ */
+static const uint8_t kEd25519phDom2[] = {
+    'S', 'i', 'g', 'E', 'd', '2', '5', '5', '1', '9', ' ', 'n',
+    'o', ' ', 'E', 'd', '2', '5', '5', '1', '9', ' ', 'c', 'o',
+    'l', 'l', 'i', 's', 'i', 'o', 'n', 's', 0x01, 0x00,
+};
+
 otcrypto_status_t otcrypto_ed25519_keygen(
     otcrypto_blinded_key_t *private_key, otcrypto_unblinded_key_t *public_key) {
   // TODO: Ed25519 is not yet implemented.
@@ -27,10 +43,13 @@ otcrypto_status_t otcrypto_ed25519_sign(
 otcrypto_status_t otcrypto_ed25519_verify(
     const otcrypto_unblinded_key_t *public_key,
     otcrypto_const_byte_buf_t input_message,
-    otcrypto_eddsa_sign_mode_t sign_mode, otcrypto_const_word32_buf_t signature,
+    otcrypto_eddsa_sign_mode_t sign_mode,
+    otcrypto_eddsa_verify_mode_t verify_mode,
+    otcrypto_const_word32_buf_t signature,
     hardened_bool_t *verification_result) {
-  // TODO: Ed25519 is not yet implemented.
-  return OTCRYPTO_NOT_IMPLEMENTED;
+  HARDENED_TRY(otcrypto_ed25519_verify_async_start(
+      public_key, input_message, sign_mode, verify_mode, signature));
+  return otcrypto_ed25519_verify_async_finalize(verification_result);
 }
 
 otcrypto_status_t otcrypto_ed25519_keygen_async_start(
@@ -59,17 +78,135 @@ otcrypto_status_t otcrypto_ed25519_sign_async_finalize(
   return OTCRYPTO_NOT_IMPLEMENTED;
 }
 
+/**
+ * Compute the challenge hash k for Ed25519 signature verification.
+ *
+ * Computes k = SHA-512(dom2(F, C) || R || A || PH(M)) as described in RFC
+ * 8032, section 5.1.7. For pure Ed25519, dom2 is empty and PH is the identity
+ * function; for Ed25519ph, the context string is empty and PH is SHA-512.
+ *
+ * @param signature Signature (R, S).
+ * @param public_key Encoded public key A.
+ * @param message Input message M.
+ * @param sign_mode EdDSA signature hashing mode.
+ * @param[out] hash_k Challenge hash k.
+ * @return OK or error.
+ */
+OT_WARN_UNUSED_RESULT
+static status_t ed25519_challenge_hash(const ed25519_signature_t *signature,
+                                       const uint32_t *public_key,
+                                       otcrypto_const_byte_buf_t message,
+                                       otcrypto_eddsa_sign_mode_t sign_mode,
+                                       uint32_t hash_k[kEd25519HashWords]) {
+  // Hash the message first if needed, before the streaming hash below starts.
+  uint32_t prehash[kHmacSha512DigestWords];
+  if (sign_mode == kOtcryptoEddsaSignModeHashEddsa) {
+    HARDENED_CHECK_EQ(launder32(sign_mode), kOtcryptoEddsaSignModeHashEddsa);
+    HARDENED_TRY(hmac_hash_sha512(message.data, message.len, prehash));
+  } else if (sign_mode != kOtcryptoEddsaSignModeEddsa) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  hmac_ctx_t ctx;
+  hmac_hash_sha512_init(&ctx);
+  if (sign_mode == kOtcryptoEddsaSignModeHashEddsa) {
+    HARDENED_TRY(hmac_update(&ctx, kEd25519phDom2, sizeof(kEd25519phDom2)));
+  }
+  HARDENED_TRY(hmac_update(&ctx, (const uint8_t *)signature->r,
+                           kEd25519PointBytes));
+  HARDENED_TRY(
+      hmac_update(&ctx, (const uint8_t *)public_key, kEd25519PointBytes));
+  if (sign_mode == kOtcryptoEddsaSignModeHashEddsa) {
+    HARDENED_TRY(hmac_update(&ctx, (const uint8_t *)prehash, sizeof(prehash)));
+  } else {
+    HARDENED_CHECK_EQ(launder32(sign_mode), kOtcryptoEddsaSignModeEddsa);
+    HARDENED_TRY(hmac_update(&ctx, message.data, message.len));
+  }
+  return hmac_final(&ctx, hash_k);
+}
+
 otcrypto_status_t otcrypto_ed25519_verify_async_start(
     const otcrypto_unblinded_key_t *public_key,
     otcrypto_const_byte_buf_t input_message,
     otcrypto_eddsa_sign_mode_t sign_mode,
+    otcrypto_eddsa_verify_mode_t verify_mode,
     otcrypto_const_word32_buf_t signature) {
-  // TODO: Ed25519 is not yet implemented.
-  return OTCRYPTO_NOT_IMPLEMENTED;
+  if (public_key == NULL || public_key->key == NULL ||
+      signature.data == NULL ||
+      (input_message.data == NULL && input_message.len != 0)) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Ensure the entropy complex is initialized.
+  HARDENED_TRY(entropy_complex_check());
+
+  // Check the integrity of the public key.
+  if (integrity_unblinded_key_check(public_key) != kHardenedBoolTrue) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  HARDENED_CHECK_EQ(launder32(integrity_unblinded_key_check(public_key)),
+                    kHardenedBoolTrue);
+
+  // Check the public key mode.
+  if (public_key->key_mode != kOtcryptoKeyModeEd25519) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  HARDENED_CHECK_EQ(launder32(public_key->key_mode), kOtcryptoKeyModeEd25519);
+
+  // Check the public key size.
+  if (public_key->key_length != kEd25519PointBytes) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  HARDENED_CHECK_EQ(launder32(public_key->key_length), kEd25519PointBytes);
+
+  // Check the signature length.
+  if (signature.len > UINT32_MAX / sizeof(uint32_t) ||
+      signature.len * sizeof(uint32_t) != sizeof(ed25519_signature_t)) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+  HARDENED_CHECK_EQ(launder32(signature.len) * sizeof(uint32_t),
+                    sizeof(ed25519_signature_t));
+  const ed25519_signature_t *sig = (const ed25519_signature_t *)signature.data;
+
+  // Select the verification equation.
+  hardened_bool_t cofactored;
+  if (verify_mode == kOtcryptoEddsaVerifyModeCofactorless) {
+    HARDENED_CHECK_EQ(launder32(verify_mode),
+                      kOtcryptoEddsaVerifyModeCofactorless);
+    cofactored = kHardenedBoolFalse;
+  } else if (verify_mode == kOtcryptoEddsaVerifyModeCofactored) {
+    HARDENED_CHECK_EQ(launder32(verify_mode),
+                      kOtcryptoEddsaVerifyModeCofactored);
+    cofactored = kHardenedBoolTrue;
+  } else {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Compute the challenge hash k on Ibex while OTBN is still idle.
+  uint32_t hash_k[kEd25519HashWords];
+  HARDENED_TRY(ed25519_challenge_hash(sig, public_key->key, input_message,
+                                      sign_mode, hash_k));
+
+  // Start the asynchronous signature-verification routine.
+  HARDENED_TRY(ed25519_verify_start(sig, hash_k, public_key->key, cofactored));
+
+  // To detect forgeries of the pointer to the public key that we have passed
+  // to the ECC implementation, check again its integrity. If the pointer would
+  // have been tampered with between the first integrity check we did when
+  // entering the CryptoLib and here, we would detect this now.
+  HARDENED_CHECK_EQ(integrity_unblinded_key_check(public_key),
+                    kHardenedBoolTrue);
+  return OTCRYPTO_OK;
 }
 
 otcrypto_status_t otcrypto_ed25519_verify_async_finalize(
     hardened_bool_t *verification_result) {
-  // TODO: Ed25519 is not yet implemented.
-  return OTCRYPTO_NOT_IMPLEMENTED;
+  if (verification_result == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Ensure the entropy complex is initialized.
+  HARDENED_TRY(entropy_complex_check());
+
+  return ed25519_verify_finalize(verification_result);
 }
@@ -40,11 +40,70 @@ static_assert(kOtcryptoRsa3072PrivateKeyblobBytes ==
 static_assert(kOtcryptoRsa4096PrivateKeyblobBytes ==
                   sizeof(rsa_4096_private_key_t),
               "RSA-4096 keyblob size mismatch.");
+static_assert(kOtcryptoRsa2048CrtPrivateKeyblobBytes ==
+                  sizeof(rsa_2048_crt_private_key_t),
+              "RSA-2048 CRT keyblob size mismatch.");
+static_assert(kOtcryptoRsa3072CrtPrivateKeyblobBytes ==
+                  sizeof(rsa_3072_crt_private_key_t),
+              "RSA-3072 CRT keyblob size mismatch.");
+static_assert(kOtcryptoRsa4096CrtPrivateKeyblobBytes ==
+                  sizeof(rsa_4096_crt_private_key_t),
+              "RSA-4096 CRT keyblob size mismatch.");
+
+/**
+ * Get the length of a CRT keyblob for the given RSA size.
+ *
+ * @param size RSA size parameter.
+ * @return Keyblob length in bytes, or 0 if the size is invalid.
+ */
+static size_t crt_keyblob_length(const otcrypto_rsa_size_t size) {
+  switch (launder32(size)) {
+    case kOtcryptoRsaSize2048:
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize2048);
+      return kOtcryptoRsa2048CrtPrivateKeyblobBytes;
+    case kOtcryptoRsaSize3072:
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize3072);
+      return kOtcryptoRsa3072CrtPrivateKeyblobBytes;
+    case kOtcryptoRsaSize4096:
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize4096);
+      return kOtcryptoRsa4096CrtPrivateKeyblobBytes;
+    default:
+      return 0;
+  }
+}
+
+/**
+ * Check if a private key buffer holds (or is meant to hold) a CRT key.
+ *
+ * The CRT form is selected by the keyblob length. Does not check the rest of
+ * the key; see `private_key_structural_check`.
+ *
+ * @param size RSA size parameter.
+ * @param private_key Key to check.
+ * @return True if the keyblob length is the CRT keyblob length for `size`.
+ */
+static hardened_bool_t private_key_is_crt(
+    const otcrypto_rsa_size_t size, const otcrypto_blinded_key_t *private_key) {
+  if (launder32(private_key->keyblob_length) == crt_keyblob_length(size)) {
+    HARDENED_CHECK_EQ(private_key->keyblob_length, crt_keyblob_length(size));
+    return kHardenedBoolTrue;
+  }
+  return kHardenedBoolFalse;
+}
 
 otcrypto_status_t otcrypto_rsa_keygen(otcrypto_rsa_size_t size,
                                       otcrypto_unblinded_key_t *public_key,
                                       otcrypto_blinded_key_t *private_key) {
-  HARDENED_TRY(otcrypto_rsa_keygen_async_start(size));
+  if (private_key == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Pick the key format from the keyblob length.
+  if (private_key_is_crt(size, private_key) == kHardenedBoolTrue) {
+    HARDENED_TRY(otcrypto_rsa_keygen_crt_async_start(size));
+  } else {
+    HARDENED_TRY(otcrypto_rsa_keygen_async_start(size));
+  }
   return otcrypto_rsa_keygen_async_finalize(public_key, private_key);
 }
 
@@ -194,8 +253,10 @@ static status_t private_key_structural_check(
   HARDENED_CHECK_NE(key_length, 0);
   HARDENED_CHECK_NE(keyblob_length, 0);
 
+  // The keyblob holds either the private exponent d or the CRT form.
   if (private_key->config.key_length != key_length ||
-      private_key->keyblob_length != keyblob_length) {
+      (private_key->keyblob_length != keyblob_length &&
+       private_key->keyblob_length != crt_keyblob_length(size))) {
     return OTCRYPTO_BAD_ARGS;
   }
 
@@ -318,6 +379,15 @@ otcrypto_status_t otcrypto_rsa_keypair_from_cofactor(
   return OTCRYPTO_OK;
 }
 
+otcrypto_status_t otcrypto_rsa_keypair_from_primes(
+    otcrypto_rsa_size_t size, otcrypto_const_word32_buf_t p,
+    otcrypto_const_word32_buf_t q, otcrypto_unblinded_key_t *public_key,
+    otcrypto_blinded_key_t *private_key) {
+  HARDENED_TRY(otcrypto_rsa_keypair_from_primes_async_start(size, p, q));
+  return otcrypto_rsa_keypair_from_primes_async_finalize(public_key,
+                                                         private_key);
+}
+
 otcrypto_status_t otcrypto_rsa_sign(const otcrypto_blinded_key_t *private_key,
                                     const otcrypto_hash_digest_t message_digest,
                                     otcrypto_rsa_padding_t padding_mode,
@@ -472,6 +542,75 @@ otcrypto_status_t otcrypto_rsa_keygen_async_start(otcrypto_rsa_size_t size) {
   return OTCRYPTO_FATAL_ERR;
 }
 
+otcrypto_status_t otcrypto_rsa_keygen_crt_async_start(
+    otcrypto_rsa_size_t size) {
+  // Check that the entropy complex is initialized.
+  HARDENED_TRY(entropy_complex_check());
+
+  switch (launder32(size)) {
+    case kOtcryptoRsaSize2048:
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize2048);
+      return rsa_keygen_crt_2048_start();
+    case kOtcryptoRsaSize3072:
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize3072);
+      return rsa_keygen_crt_3072_start();
+    case kOtcryptoRsaSize4096:
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize4096);
+      return rsa_keygen_crt_4096_start();
+    default:
+      return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Should be unreachable.
+  HARDENED_TRAP();
+  return OTCRYPTO_FATAL_ERR;
+}
+
+/**
+ * Finalize a CRT key generation or derivation for any RSA size.
+ *
+ * The caller is responsible for the structural checks on both keys and for
+ * computing the checksums afterwards.
+ *
+ * @param size RSA size parameter.
+ * @param[out] public_key Destination public key struct.
+ * @param[out] private_key Destination private key struct.
+ * @return OK or error.
+ */
+static status_t keygen_crt_finalize(otcrypto_rsa_size_t size,
+                                    otcrypto_unblinded_key_t *public_key,
+                                    otcrypto_blinded_key_t *private_key) {
+  switch (launder32(size)) {
+    case kOtcryptoRsaSize2048: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize2048);
+      rsa_2048_public_key_t *pk = (rsa_2048_public_key_t *)public_key->key;
+      rsa_2048_crt_private_key_t *sk =
+          (rsa_2048_crt_private_key_t *)private_key->keyblob;
+      return rsa_keygen_crt_2048_finalize(pk, sk);
+    }
+    case kOtcryptoRsaSize3072: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize3072);
+      rsa_3072_public_key_t *pk = (rsa_3072_public_key_t *)public_key->key;
+      rsa_3072_crt_private_key_t *sk =
+          (rsa_3072_crt_private_key_t *)private_key->keyblob;
+      return rsa_keygen_crt_3072_finalize(pk, sk);
+    }
+    case kOtcryptoRsaSize4096: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize4096);
+      rsa_4096_public_key_t *pk = (rsa_4096_public_key_t *)public_key->key;
+      rsa_4096_crt_private_key_t *sk =
+          (rsa_4096_crt_private_key_t *)private_key->keyblob;
+      return rsa_keygen_crt_4096_finalize(pk, sk);
+    }
+    default:
+      return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Should be unreachable.
+  HARDENED_TRAP();
+  return OTCRYPTO_FATAL_ERR;
+}
+
 otcrypto_status_t otcrypto_rsa_keygen_async_finalize(
     otcrypto_unblinded_key_t *public_key, otcrypto_blinded_key_t *private_key) {
   // Check for NULL pointers.
@@ -498,6 +637,15 @@ otcrypto_status_t otcrypto_rsa_keygen_async_finalize(
       private_key->keyblob,
       ceil_div(private_key->keyblob_length, sizeof(uint32_t))));
 
+  // CRT keys come from a separate keygen mode; OTBN checks that the mode
+  // matches the one that was started.
+  if (private_key_is_crt(size, private_key) == kHardenedBoolTrue) {
+    HARDENED_TRY(keygen_crt_finalize(size, public_key, private_key));
+    public_key->checksum = integrity_unblinded_checksum(public_key);
+    private_key->checksum = integrity_blinded_checksum(private_key);
+    return OTCRYPTO_OK;
+  }
+
   // Call the required finalize() operation.
   otcrypto_rsa_size_t size_used = launder32(0);
   switch (size) {
@@ -613,8 +761,12 @@ otcrypto_status_t otcrypto_rsa_keypair_from_cofactor_async_finalize(
   // Check the caller-provided public key buffer.
   HARDENED_TRY(public_key_structural_check(public_key));
 
-  // Check the caller-provided private key buffer.
+  // Check the caller-provided private key buffer. Keys from a cofactor are
+  // never in CRT form.
   HARDENED_TRY(private_key_structural_check(size, private_key));
+  if (private_key_is_crt(size, private_key) != kHardenedBoolFalse) {
+    return OTCRYPTO_BAD_ARGS;
+  }
 
   // Randomize the keyblob memory.
   HARDENED_TRY(hardened_memshred(
@@ -650,6 +802,124 @@ otcrypto_status_t otcrypto_rsa_keypair_from_cofactor_async_finalize(
   return OTCRYPTO_OK;
 }
 
+otcrypto_status_t otcrypto_rsa_keypair_from_primes_async_start(
+    otcrypto_rsa_size_t size, otcrypto_const_word32_buf_t p,
+    otcrypto_const_word32_buf_t q) {
+  if (p.data == NULL || q.data == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Check that the entropy complex is initialized.
+  HARDENED_TRY(entropy_complex_check());
+
+  // Both primes must be half the length of the modulus.
+  if (p.len != q.len) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  switch (launder32(size)) {
+    case kOtcryptoRsaSize2048: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize2048);
+      if (p.len != sizeof(rsa_2048_cofactor_t) / sizeof(uint32_t)) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+      return rsa_keygen_from_primes_crt_2048_start(
+          (const rsa_2048_cofactor_t *)p.data,
+          (const rsa_2048_cofactor_t *)q.data);
+    }
+    case kOtcryptoRsaSize3072: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize3072);
+      if (p.len != sizeof(rsa_3072_cofactor_t) / sizeof(uint32_t)) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+      return rsa_keygen_from_primes_crt_3072_start(
+          (const rsa_3072_cofactor_t *)p.data,
+          (const rsa_3072_cofactor_t *)q.data);
+    }
+    case kOtcryptoRsaSize4096: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize4096);
+      if (p.len != sizeof(rsa_4096_cofactor_t) / sizeof(uint32_t)) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+      return rsa_keygen_from_primes_crt_4096_start(
+          (const rsa_4096_cofactor_t *)p.data,
+          (const rsa_4096_cofactor_t *)q.data);
+    }
+    default:
+      return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Should be unreachable.
+  HARDENED_TRAP();
+  return OTCRYPTO_FATAL_ERR;
+}
+
+otcrypto_status_t otcrypto_rsa_keypair_from_primes_async_finalize(
+    otcrypto_unblinded_key_t *public_key, otcrypto_blinded_key_t *private_key) {
+  // Check for NULL pointers.
+  if (public_key == NULL || public_key->key == NULL || private_key == NULL ||
+      private_key->keyblob == NULL) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Check that the entropy complex is initialized.
+  HARDENED_TRY(entropy_complex_check());
+
+  // Infer the RSA size from the public key modulus.
+  otcrypto_rsa_size_t size;
+  HARDENED_TRY(rsa_size_from_public_key(public_key, &size));
+
+  // Check the caller-provided public key buffer.
+  HARDENED_TRY(public_key_structural_check(public_key));
+
+  // Check the caller-provided private key buffer, which must be a CRT key.
+  HARDENED_TRY(private_key_structural_check(size, private_key));
+  if (private_key_is_crt(size, private_key) != kHardenedBoolTrue) {
+    return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Randomize the keyblob memory.
+  HARDENED_TRY(hardened_memshred(
+      private_key->keyblob,
+      ceil_div(private_key->keyblob_length, sizeof(uint32_t))));
+
+  // Call the required finalize() operation.
+  switch (launder32(size)) {
+    case kOtcryptoRsaSize2048: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize2048);
+      rsa_2048_public_key_t *pk = (rsa_2048_public_key_t *)public_key->key;
+      rsa_2048_crt_private_key_t *sk =
+          (rsa_2048_crt_private_key_t *)private_key->keyblob;
+      HARDENED_TRY(rsa_keygen_from_primes_crt_2048_finalize(pk, sk));
+      break;
+    }
+    case kOtcryptoRsaSize3072: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize3072);
+      rsa_3072_public_key_t *pk = (rsa_3072_public_key_t *)public_key->key;
+      rsa_3072_crt_private_key_t *sk =
+          (rsa_3072_crt_private_key_t *)private_key->keyblob;
+      HARDENED_TRY(rsa_keygen_from_primes_crt_3072_finalize(pk, sk));
+      break;
+    }
+    case kOtcryptoRsaSize4096: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize4096);
+      rsa_4096_public_key_t *pk = (rsa_4096_public_key_t *)public_key->key;
+      rsa_4096_crt_private_key_t *sk =
+          (rsa_4096_crt_private_key_t *)private_key->keyblob;
+      HARDENED_TRY(rsa_keygen_from_primes_crt_4096_finalize(pk, sk));
+      break;
+    }
+    default:
+      // Invalid key size.
+      return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Construct checksums for the new keys.
+  public_key->checksum = integrity_unblinded_checksum(public_key);
+  private_key->checksum = integrity_blinded_checksum(private_key);
+  return OTCRYPTO_OK;
+}
+
 /**
  * Ensure that the key mode matches the RSA sign padding mode.
  *
@@ -685,6 +955,52 @@ static status_t key_mode_padding_check(otcrypto_key_mode_t key_mode,
   return OTCRYPTO_FATAL_ERR;
 }
 
+/**
+ * Start generating a signature with a CRT key for any RSA size.
+ *
+ * The caller is responsible for checking the key.
+ *
+ * @param size RSA size parameter.
+ * @param private_key Private key in CRT form.
+ * @param message_digest Message digest to sign.
+ * @param padding_mode Signature padding mode.
+ * @return Result of the operation.
+ */
+static status_t sign_crt_start(otcrypto_rsa_size_t size,
+                               const otcrypto_blinded_key_t *private_key,
+                               const otcrypto_hash_digest_t message_digest,
+                               otcrypto_rsa_padding_t padding_mode) {
+  switch (launder32(size)) {
+    case kOtcryptoRsaSize2048: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize2048);
+      rsa_2048_crt_private_key_t *sk =
+          (rsa_2048_crt_private_key_t *)private_key->keyblob;
+      return rsa_signature_generate_crt_2048_start(
+          sk, message_digest, (rsa_signature_padding_t)padding_mode);
+    }
+    case kOtcryptoRsaSize3072: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize3072);
+      rsa_3072_crt_private_key_t *sk =
+          (rsa_3072_crt_private_key_t *)private_key->keyblob;
+      return rsa_signature_generate_crt_3072_start(
+          sk, message_digest, (rsa_signature_padding_t)padding_mode);
+    }
+    case kOtcryptoRsaSize4096: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize4096);
+      rsa_4096_crt_private_key_t *sk =
+          (rsa_4096_crt_private_key_t *)private_key->keyblob;
+      return rsa_signature_generate_crt_4096_start(
+          sk, message_digest, (rsa_signature_padding_t)padding_mode);
+    }
+    default:
+      return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Should be unreachable.
+  HARDENED_TRAP();
+  return OTCRYPTO_FATAL_ERR;
+}
+
 otcrypto_status_t otcrypto_rsa_sign_async_start(
     const otcrypto_blinded_key_t *private_key,
     const otcrypto_hash_digest_t message_digest,
@@ -717,6 +1033,11 @@ otcrypto_status_t otcrypto_rsa_sign_async_start(
     return OTCRYPTO_BAD_ARGS;
   }
 
+  // CRT keys have their own signature generation routines.
+  if (private_key_is_crt(size, private_key) == kHardenedBoolTrue) {
+    return sign_crt_start(size, private_key, message_digest, padding_mode);
+  }
+
   // Start the appropriate signature generation routine.
   switch (launder32(size)) {
     case kOtcryptoRsaSize2048: {
@@ -994,6 +1315,80 @@ otcrypto_status_t otcrypto_rsa_encrypt_async_finalize(
   return OTCRYPTO_FATAL_ERR;
 }
 
+/**
+ * Start decrypting with a CRT key for any RSA size.
+ *
+ * The caller is responsible for checking the key.
+ *
+ * @param size RSA size parameter.
+ * @param private_key Private key in CRT form.
+ * @param ciphertext Ciphertext to decrypt.
+ * @return Result of the operation.
+ */
+static status_t decrypt_crt_start(otcrypto_rsa_size_t size,
+                                  const otcrypto_blinded_key_t *private_key,
+                                  otcrypto_const_word32_buf_t ciphertext) {
+  switch (launder32(size)) {
+    case kOtcryptoRsaSize2048: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize2048);
+      if (ciphertext.len != kRsa2048NumWords) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+      rsa_2048_crt_private_key_t *sk =
+          (rsa_2048_crt_private_key_t *)private_key->keyblob;
+      rsa_2048_int_t *ctext = (rsa_2048_int_t *)ciphertext.data;
+
+      // Check that ciphertext is < n.
+      if (bignum_lt(ctext->data, sk->n.data, kRsa2048NumWords) ==
+          kHardenedBoolFalse) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+
+      return rsa_decrypt_crt_2048_start(sk, ctext);
+    }
+    case kOtcryptoRsaSize3072: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize3072);
+      if (ciphertext.len != kRsa3072NumWords) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+      rsa_3072_crt_private_key_t *sk =
+          (rsa_3072_crt_private_key_t *)private_key->keyblob;
+      rsa_3072_int_t *ctext = (rsa_3072_int_t *)ciphertext.data;
+
+      // Check that ciphertext is < n.
+      if (bignum_lt(ctext->data, sk->n.data, kRsa3072NumWords) ==
+          kHardenedBoolFalse) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+
+      return rsa_decrypt_crt_3072_start(sk, ctext);
+    }
+    case kOtcryptoRsaSize4096: {
+      HARDENED_CHECK_EQ(size, kOtcryptoRsaSize4096);
+      if (ciphertext.len != kRsa4096NumWords) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+      rsa_4096_crt_private_key_t *sk =
+          (rsa_4096_crt_private_key_t *)private_key->keyblob;
+      rsa_4096_int_t *ctext = (rsa_4096_int_t *)ciphertext.data;
+
+      // Check that ciphertext is < n.
+      if (bignum_lt(ctext->data, sk->n.data, kRsa4096NumWords) ==
+          kHardenedBoolFalse) {
+        return OTCRYPTO_BAD_ARGS;
+      }
+
+      return rsa_decrypt_crt_4096_start(sk, ctext);
+    }
+    default:
+      return OTCRYPTO_BAD_ARGS;
+  }
+
+  // Should be unreachable.
+  HARDENED_TRAP();
+  return OTCRYPTO_FATAL_ERR;
+}
+
 otcrypto_status_t otcrypto_rsa_decrypt_async_start(
     const otcrypto_blinded_key_t *private_key,
     otcrypto_const_word32_buf_t ciphertext) {
@@ -1029,6 +1424,11 @@ otcrypto_status_t otcrypto_rsa_decrypt_async_start(
   HARDENED_CHECK_EQ(private_key->config.key_mode,
                     kOtcryptoKeyModeRsaEncryptOaep);
 
+  // CRT keys have their own decryption routines.
+  if (private_key_is_crt(size, private_key) == kHardenedBoolTrue) {
+    return decrypt_crt_start(size, private_key, ciphertext);
+  }
+
   // Start the appropriate decryption routine.
   switch (launder32(size)) {
     case kOtcryptoRsaSize2048: {
@@ -159,6 +159,63 @@ typedef struct rsa_4096_cofactor_t {
   uint32_t data[kRsa4096NumWords / 2];
 } rsa_4096_cofactor_t;
 
+/**
+ * A type that holds an RSA-2048 private key in CRT form.
+ *
+ * The private key consists of the primes p and q, the exponents
+ * dp = d mod (p - 1) and dq = d mod (q - 1) in two Boolean shares each, the
+ * coefficient qinv = q^-1 mod p and the public modulus n. All values other
+ * than n are half the size of the modulus, so they share the cofactor type.
+ */
+typedef struct rsa_2048_crt_private_key_t {
+  rsa_2048_cofactor_t p;
+  rsa_2048_cofactor_t q;
+  rsa_2048_cofactor_t dp0;
+  rsa_2048_cofactor_t dp1;
+  rsa_2048_cofactor_t dq0;
+  rsa_2048_cofactor_t dq1;
+  rsa_2048_cofactor_t qinv;
+  rsa_2048_int_t n;
+} rsa_2048_crt_private_key_t;
+
+/**
+ * A type that holds an RSA-3072 private key in CRT form.
+ *
+ * The private key consists of the primes p and q, the exponents
+ * dp = d mod (p - 1) and dq = d mod (q - 1) in two Boolean shares each, the
+ * coefficient qinv = q^-1 mod p and the public modulus n. All values other
+ * than n are half the size of the modulus, so they share the cofactor type.
+ */
+typedef struct rsa_3072_crt_private_key_t {
+  rsa_3072_cofactor_t p;
+  rsa_3072_cofactor_t q;
+  rsa_3072_cofactor_t dp0;
+  rsa_3072_cofactor_t dp1;
+  rsa_3072_cofactor_t dq0;
+  rsa_3072_cofactor_t dq1;
+  rsa_3072_cofactor_t qinv;
+  rsa_3072_int_t n;
+} rsa_3072_crt_private_key_t;
+
+/**
+ * A type that holds an RSA-4096 private key in CRT form.
+ *
+ * The private key consists of the primes p and q, the exponents
+ * dp = d mod (p - 1) and dq = d mod (q - 1) in two Boolean shares each, the
+ * coefficient qinv = q^-1 mod p and the public modulus n. All values other
+ * than n are half the size of the modulus, so they share the cofactor type.
+ */
+typedef struct rsa_4096_crt_private_key_t {
+  rsa_4096_cofactor_t p;
+  rsa_4096_cofactor_t q;
+  rsa_4096_cofactor_t dp0;
+  rsa_4096_cofactor_t dp1;
+  rsa_4096_cofactor_t dq0;
+  rsa_4096_cofactor_t dq1;
+  rsa_4096_cofactor_t qinv;
+  rsa_4096_int_t n;
+} rsa_4096_crt_private_key_t;
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -43,6 +43,13 @@ status_t rsa_decrypt_2048_start(const rsa_2048_private_key_t *private_key,
                                          &private_key->d1, &private_key->n);
 }
 
+status_t rsa_decrypt_crt_2048_start(
+    const rsa_2048_crt_private_key_t *private_key,
+    const rsa_2048_int_t *ciphertext) {
+  // Start computing (ciphertext ^ d) mod n with the CRT.
+  return rsa_modexp_crt_2048_start(ciphertext, private_key);
+}
+
 status_t rsa_decrypt_finalize(const otcrypto_hash_mode_t hash_mode,
                               const uint8_t *label, size_t label_bytelen,
                               size_t plaintext_max_bytelen, uint8_t *plaintext,
@@ -136,6 +143,13 @@ status_t rsa_decrypt_3072_start(const rsa_3072_private_key_t *private_key,
                                          &private_key->d1, &private_key->n);
 }
 
+status_t rsa_decrypt_crt_3072_start(
+    const rsa_3072_crt_private_key_t *private_key,
+    const rsa_3072_int_t *ciphertext) {
+  // Start computing (ciphertext ^ d) mod n with the CRT.
+  return rsa_modexp_crt_3072_start(ciphertext, private_key);
+}
+
 status_t rsa_encrypt_4096_start(const rsa_4096_public_key_t *public_key,
                                 const otcrypto_hash_mode_t hash_mode,
                                 const uint8_t *message, size_t message_bytelen,
@@ -163,3 +177,10 @@ status_t rsa_decrypt_4096_start(const rsa_4096_private_key_t *private_key,
   return rsa_modexp_consttime_4096_start(ciphertext, &private_key->d0,
                                          &private_key->d1, &private_key->n);
 }
+
+status_t rsa_decrypt_crt_4096_start(
+    const rsa_4096_crt_private_key_t *private_key,
+    const rsa_4096_int_t *ciphertext) {
+  // Start computing (ciphertext ^ d) mod n with the CRT.
+  return rsa_modexp_crt_4096_start(ciphertext, private_key);
+}
@@ -58,6 +58,27 @@ status_t rsa_signature_generate_2048_start(
     const otcrypto_hash_digest_t message_digest,
     const rsa_signature_padding_t padding_mode);
 
+/**
+ * Starts generating an RSA-2048 signature with a CRT key; returns immediately.
+ *
+ * The key exponent must be F4=65537; no other exponents are supported. The
+ * signature is checked against the public key before it is released.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * The signature can be read with `rsa_signature_generate_2048_finalize`.
+ *
+ * @param private_key RSA private key in CRT form.
+ * @param message_digest Message digest to sign.
+ * @param padding_mode Signature padding mode.
+ * @return Result of the operation (OK or error).
+ */
+OT_WARN_UNUSED_RESULT
+status_t rsa_signature_generate_crt_2048_start(
+    const rsa_2048_crt_private_key_t *private_key,
+    const otcrypto_hash_digest_t message_digest,
+    const rsa_signature_padding_t padding_mode);
+
 /**
  * Waits for an RSA-2048 signature generation to complete.
  *
@@ -124,6 +145,27 @@ status_t rsa_signature_generate_3072_start(
     const otcrypto_hash_digest_t message_digest,
     const rsa_signature_padding_t padding_mode);
 
+/**
+ * Starts generating an RSA-3072 signature with a CRT key; returns immediately.
+ *
+ * The key exponent must be F4=65537; no other exponents are supported. The
+ * signature is checked against the public key before it is released.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * The signature can be read with `rsa_signature_generate_3072_finalize`.
+ *
+ * @param private_key RSA private key in CRT form.
+ * @param message_digest Message digest to sign.
+ * @param padding_mode Signature padding mode.
+ * @return Result of the operation (OK or error).
+ */
+OT_WARN_UNUSED_RESULT
+status_t rsa_signature_generate_crt_3072_start(
+    const rsa_3072_crt_private_key_t *private_key,
+    const otcrypto_hash_digest_t message_digest,
+    const rsa_signature_padding_t padding_mode);
+
 /**
  * Waits for an RSA-3072 signature generation to complete.
  *
@@ -167,6 +209,27 @@ status_t rsa_signature_generate_4096_start(
     const otcrypto_hash_digest_t message_digest,
     const rsa_signature_padding_t padding_mode);
 
+/**
+ * Starts generating an RSA-4096 signature with a CRT key; returns immediately.
+ *
+ * The key exponent must be F4=65537; no other exponents are supported. The
+ * signature is checked against the public key before it is released.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * The signature can be read with `rsa_signature_generate_4096_finalize`.
+ *
+ * @param private_key RSA private key in CRT form.
+ * @param message_digest Message digest to sign.
+ * @param padding_mode Signature padding mode.
+ * @return Result of the operation (OK or error).
+ */
+OT_WARN_UNUSED_RESULT
+status_t rsa_signature_generate_crt_4096_start(
+    const rsa_4096_crt_private_key_t *private_key,
+    const otcrypto_hash_digest_t message_digest,
+    const rsa_signature_padding_t padding_mode);
+
 /**
  * Waits for an RSA-4096 signature generation to complete.
  *
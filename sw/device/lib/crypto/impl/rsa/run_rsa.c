@@ -16,17 +16,27 @@ OTBN_DECLARE_APP_SYMBOLS(run_rsa);
 static const otbn_app_t kOtbnAppRsa = OTBN_APP_T_INIT(run_rsa);
 
 // Declare offsets for input and output buffers.
-OTBN_DECLARE_SYMBOL_ADDR(run_rsa, mode);    // Application mode.
-OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_n);   // Public modulus n.
-OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_d0);  // Private exponent d0.
-OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_d1);  // Private exponent d1.
-OTBN_DECLARE_SYMBOL_ADDR(run_rsa, inout);   // Input/output buffer.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, mode);      // Application mode.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_n);     // Public modulus n.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_d0);    // Private exponent d0.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_d1);    // Private exponent d1.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, inout);     // Input/output buffer.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_p);     // Prime p.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_q);     // Prime q.
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_g);     // First share of dq (CRT).
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_h);     // Second share of dq (CRT).
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, rsa_qinv);  // q^-1 mod p (CRT).
 
 static const otbn_addr_t kOtbnVarRsaMode = OTBN_ADDR_T_INIT(run_rsa, mode);
 static const otbn_addr_t kOtbnVarRsaN = OTBN_ADDR_T_INIT(run_rsa, rsa_n);
 static const otbn_addr_t kOtbnVarRsaD0 = OTBN_ADDR_T_INIT(run_rsa, rsa_d0);
 static const otbn_addr_t kOtbnVarRsaD1 = OTBN_ADDR_T_INIT(run_rsa, rsa_d1);
 static const otbn_addr_t kOtbnVarRsaInOut = OTBN_ADDR_T_INIT(run_rsa, inout);
+static const otbn_addr_t kOtbnVarRsaP = OTBN_ADDR_T_INIT(run_rsa, rsa_p);
+static const otbn_addr_t kOtbnVarRsaQ = OTBN_ADDR_T_INIT(run_rsa, rsa_q);
+static const otbn_addr_t kOtbnVarRsaG = OTBN_ADDR_T_INIT(run_rsa, rsa_g);
+static const otbn_addr_t kOtbnVarRsaH = OTBN_ADDR_T_INIT(run_rsa, rsa_h);
+static const otbn_addr_t kOtbnVarRsaQinv = OTBN_ADDR_T_INIT(run_rsa, rsa_qinv);
 
 // Declare mode constants.
 OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_2048_KEYGEN);
@@ -38,6 +48,15 @@ OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_3072_MODEXP);
 OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_3072_MODEXP_F4);
 OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_4096_MODEXP);
 OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_4096_MODEXP_F4);
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_2048_KEYGEN_CRT);
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_3072_KEYGEN_CRT);
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_4096_KEYGEN_CRT);
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_2048_DERIVE_CRT);
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_3072_DERIVE_CRT);
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_4096_DERIVE_CRT);
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_2048_MODEXP_CRT);
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_3072_MODEXP_CRT);
+OTBN_DECLARE_SYMBOL_ADDR(run_rsa, MODE_RSA_4096_MODEXP_CRT);
 static const uint32_t kMode2048Keygen =
     OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_2048_KEYGEN);
 static const uint32_t kMode3072Keygen =
@@ -56,6 +75,24 @@ static const uint32_t kMode4096Modexp =
     OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_4096_MODEXP);
 static const uint32_t kMode4096ModexpF4 =
     OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_4096_MODEXP_F4);
+static const uint32_t kMode2048KeygenCrt =
+    OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_2048_KEYGEN_CRT);
+static const uint32_t kMode3072KeygenCrt =
+    OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_3072_KEYGEN_CRT);
+static const uint32_t kMode4096KeygenCrt =
+    OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_4096_KEYGEN_CRT);
+static const uint32_t kMode2048DeriveCrt =
+    OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_2048_DERIVE_CRT);
+static const uint32_t kMode3072DeriveCrt =
+    OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_3072_DERIVE_CRT);
+static const uint32_t kMode4096DeriveCrt =
+    OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_4096_DERIVE_CRT);
+static const uint32_t kMode2048ModexpCrt =
+    OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_2048_MODEXP_CRT);
+static const uint32_t kMode3072ModexpCrt =
+    OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_3072_MODEXP_CRT);
+static const uint32_t kMode4096ModexpCrt =
+    OTBN_ADDR_T_INIT(run_rsa, MODE_RSA_4096_MODEXP_CRT);
 
 enum {
   /**
@@ -76,11 +113,14 @@ status_t rsa_modexp_wait(size_t *num_words) {
   HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(1, kOtbnVarRsaMode, &mode));
 
   *num_words = 0;
-  if (mode == kMode2048Modexp || mode == kMode2048ModexpF4) {
+  if (mode == kMode2048Modexp || mode == kMode2048ModexpF4 ||
+      mode == kMode2048ModexpCrt) {
     *num_words = kRsa2048NumWords;
-  } else if (mode == kMode3072Modexp || mode == kMode3072ModexpF4) {
+  } else if (mode == kMode3072Modexp || mode == kMode3072ModexpF4 ||
+             mode == kMode3072ModexpCrt) {
     *num_words = kRsa3072NumWords;
-  } else if (mode == kMode4096Modexp || mode == kMode4096ModexpF4) {
+  } else if (mode == kMode4096Modexp || mode == kMode4096ModexpF4 ||
+             mode == kMode4096ModexpCrt) {
     *num_words = kRsa4096NumWords;
   } else {
     // Wipe DMEM.
@@ -248,6 +288,78 @@ status_t rsa_modexp_4096_finalize(rsa_4096_int_t *result) {
   return rsa_modexp_finalize(kRsa4096NumWords, result->data);
 }
 
+/**
+ * Start a CRT private-key operation of variable size.
+ *
+ * Loads the base and the CRT form of the private key, then starts OTBN. OTBN
+ * runs two half-size exponentiations and recombines them, then checks the
+ * result against the public exponent before releasing it.
+ *
+ * @param mode Mode parameter for the operation.
+ * @param num_words Number of words for the modulus.
+ * @param base Exponentiation base (`num_words` words).
+ * @param p First prime (`num_words / 2` words).
+ * @param q Second prime (`num_words / 2` words).
+ * @param dp0 First share of d mod (p - 1) (`num_words / 2` words).
+ * @param dp1 Second share of d mod (p - 1) (`num_words / 2` words).
+ * @param dq0 First share of d mod (q - 1) (`num_words / 2` words).
+ * @param dq1 Second share of d mod (q - 1) (`num_words / 2` words).
+ * @param qinv Coefficient q^-1 mod p (`num_words / 2` words).
+ * @return Status of the operation (OK or error).
+ */
+static status_t modexp_crt_start(uint32_t mode, size_t num_words,
+                                 const uint32_t *base, const uint32_t *p,
+                                 const uint32_t *q, const uint32_t *dp0,
+                                 const uint32_t *dp1, const uint32_t *dq0,
+                                 const uint32_t *dq1, const uint32_t *qinv) {
+  // Load the OTBN app. Fails if OTBN is not idle.
+  HARDENED_TRY(otbn_load_app(kOtbnAppRsa));
+
+  // Set mode.
+  HARDENED_TRY(otbn_dmem_write(1, &mode, kOtbnVarRsaMode));
+
+  // Set the base and the CRT private key.
+  size_t half_words = num_words / 2;
+  HARDENED_TRY(otbn_dmem_write(num_words, base, kOtbnVarRsaInOut));
+  HARDENED_TRY(otbn_dmem_write(half_words, p, kOtbnVarRsaP));
+  HARDENED_TRY(otbn_dmem_write(half_words, q, kOtbnVarRsaQ));
+  HARDENED_TRY(otbn_dmem_write(half_words, dp0, kOtbnVarRsaD0));
+  HARDENED_TRY(otbn_dmem_write(half_words, dp1, kOtbnVarRsaD1));
+  HARDENED_TRY(otbn_dmem_write(half_words, dq0, kOtbnVarRsaG));
+  HARDENED_TRY(otbn_dmem_write(half_words, dq1, kOtbnVarRsaH));
+  HARDENED_TRY(otbn_dmem_write(half_words, qinv, kOtbnVarRsaQinv));
+
+  // Start OTBN.
+  return otbn_execute();
+}
+
+status_t rsa_modexp_crt_2048_start(
+    const rsa_2048_int_t *base, const rsa_2048_crt_private_key_t *private_key) {
+  return modexp_crt_start(kMode2048ModexpCrt, kRsa2048NumWords, base->data,
+                          private_key->p.data, private_key->q.data,
+                          private_key->dp0.data, private_key->dp1.data,
+                          private_key->dq0.data, private_key->dq1.data,
+                          private_key->qinv.data);
+}
+
+status_t rsa_modexp_crt_3072_start(
+    const rsa_3072_int_t *base, const rsa_3072_crt_private_key_t *private_key) {
+  return modexp_crt_start(kMode3072ModexpCrt, kRsa3072NumWords, base->data,
+                          private_key->p.data, private_key->q.data,
+                          private_key->dp0.data, private_key->dp1.data,
+                          private_key->dq0.data, private_key->dq1.data,
+                          private_key->qinv.data);
+}
+
+status_t rsa_modexp_crt_4096_start(
+    const rsa_4096_int_t *base, const rsa_4096_crt_private_key_t *private_key) {
+  return modexp_crt_start(kMode4096ModexpCrt, kRsa4096NumWords, base->data,
+                          private_key->p.data, private_key->q.data,
+                          private_key->dp0.data, private_key->dp1.data,
+                          private_key->dq0.data, private_key->dq1.data,
+                          private_key->qinv.data);
+}
+
 /**
  * Start the OTBN key generation program in random-key mode.
  *
@@ -350,3 +462,207 @@ status_t rsa_keygen_4096_finalize(rsa_4096_public_key_t *public_key,
 
   return OTCRYPTO_OK;
 }
+
+/**
+ * Finalize a CRT key generation or derivation operation.
+ *
+ * Checks the application mode against expectations, then reads back the
+ * modulus and the CRT form of the private key.
+ *
+ * @param exp_mode Application mode to expect.
+ * @param num_words Number of words for the modulus.
+ * @param[out] n Buffer for the modulus (`num_words` words).
+ * @param[out] p Buffer for the first prime (`num_words / 2` words).
+ * @param[out] q Buffer for the second prime (`num_words / 2` words).
+ * @param[out] dp0 Buffer for the first share of dp (`num_words / 2` words).
+ * @param[out] dp1 Buffer for the second share of dp (`num_words / 2` words).
+ * @param[out] dq0 Buffer for the first share of dq (`num_words / 2` words).
+ * @param[out] dq1 Buffer for the second share of dq (`num_words / 2` words).
+ * @param[out] qinv Buffer for q^-1 mod p (`num_words / 2` words).
+ * @return OK or error.
+ */
+static status_t keygen_crt_finalize(uint32_t exp_mode, size_t num_words,
+                                    uint32_t *n, uint32_t *p, uint32_t *q,
+                                    uint32_t *dp0, uint32_t *dp1,
+                                    uint32_t *dq0, uint32_t *dq1,
+                                    uint32_t *qinv) {
+  // Spin here waiting for OTBN to complete.
+  HARDENED_TRY_WIPE_DMEM(otbn_busy_wait_for_done());
+
+  // Read the mode from OTBN dmem and panic if it's not as expected.
+  uint32_t act_mode = 0;
+  HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(1, kOtbnVarRsaMode, &act_mode));
+  if (act_mode != exp_mode) {
+    HARDENED_TRY(otbn_dmem_sec_wipe());
+    return OTCRYPTO_FATAL_ERR;
+  }
+  HARDENED_CHECK_EQ(launder32(act_mode), exp_mode);
+
+  // Read the public modulus (n) from OTBN dmem.
+  HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(num_words, kOtbnVarRsaN, n));
+
+  // Read the primes and the CRT exponents and coefficient from OTBN dmem.
+  size_t half_words = num_words / 2;
+  HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(half_words, kOtbnVarRsaP, p));
+  HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(half_words, kOtbnVarRsaQ, q));
+  HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(half_words, kOtbnVarRsaD0, dp0));
+  HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(half_words, kOtbnVarRsaD1, dp1));
+  HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(half_words, kOtbnVarRsaG, dq0));
+  HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(half_words, kOtbnVarRsaH, dq1));
+  HARDENED_TRY_WIPE_DMEM(otbn_dmem_read(half_words, kOtbnVarRsaQinv, qinv));
+
+  // Wipe DMEM.
+  return otbn_dmem_sec_wipe();
+}
+
+/**
+ * Start the OTBN CRT key derivation program.
+ *
+ * @param mode Mode parameter for derivation.
+ * @param half_words Number of words for each prime.
+ * @param p First prime.
+ * @param q Second prime.
+ * @return Result of the operation.
+ */
+static status_t derive_crt_start(uint32_t mode, size_t half_words,
+                                 const uint32_t *p, const uint32_t *q) {
+  // Load the RSA app. Fails if OTBN is non-idle.
+  HARDENED_TRY(otbn_load_app(kOtbnAppRsa));
+
+  // Set mode.
+  HARDENED_TRY(otbn_dmem_write(1, &mode, kOtbnVarRsaMode));
+
+  // Set the primes and start OTBN.
+  HARDENED_TRY(otbn_dmem_write(half_words, p, kOtbnVarRsaP));
+  HARDENED_TRY(otbn_dmem_write(half_words, q, kOtbnVarRsaQ));
+  return otbn_execute();
+}
+
+status_t rsa_keygen_crt_2048_start(void) {
+  return keygen_start(kMode2048KeygenCrt);
+}
+
+status_t rsa_keygen_crt_2048_finalize(rsa_2048_public_key_t *public_key,
+                                      rsa_2048_crt_private_key_t *private_key) {
+  HARDENED_TRY(keygen_crt_finalize(kMode2048KeygenCrt, kRsa2048NumWords,
+                                   private_key->n.data, private_key->p.data,
+                                   private_key->q.data, private_key->dp0.data,
+                                   private_key->dp1.data, private_key->dq0.data,
+                                   private_key->dq1.data,
+                                   private_key->qinv.data));
+
+  // Copy the modulus to the public key.
+  HARDENED_TRY(hardened_memcpy(public_key->n.data, private_key->n.data,
+                               ARRAYSIZE(private_key->n.data)));
+
+  return OTCRYPTO_OK;
+}
+
+status_t rsa_keygen_from_primes_crt_2048_start(const rsa_2048_cofactor_t *p,
+                                               const rsa_2048_cofactor_t *q) {
+  return derive_crt_start(kMode2048DeriveCrt, ARRAYSIZE(p->data), p->data,
+                          q->data);
+}
+
+status_t rsa_keygen_from_primes_crt_2048_finalize(
+    rsa_2048_public_key_t *public_key,
+    rsa_2048_crt_private_key_t *private_key) {
+  HARDENED_TRY(keygen_crt_finalize(kMode2048DeriveCrt, kRsa2048NumWords,
+                                   private_key->n.data, private_key->p.data,
+                                   private_key->q.data, private_key->dp0.data,
+                                   private_key->dp1.data, private_key->dq0.data,
+                                   private_key->dq1.data,
+                                   private_key->qinv.data));
+
+  // Copy the modulus to the public key.
+  HARDENED_TRY(hardened_memcpy(public_key->n.data, private_key->n.data,
+                               ARRAYSIZE(private_key->n.data)));
+
+  return OTCRYPTO_OK;
+}
+
+status_t rsa_keygen_crt_3072_start(void) {
+  return keygen_start(kMode3072KeygenCrt);
+}
+
+status_t rsa_keygen_crt_3072_finalize(rsa_3072_public_key_t *public_key,
+                                      rsa_3072_crt_private_key_t *private_key) {
+  HARDENED_TRY(keygen_crt_finalize(kMode3072KeygenCrt, kRsa3072NumWords,
+                                   private_key->n.data, private_key->p.data,
+                                   private_key->q.data, private_key->dp0.data,
+                                   private_key->dp1.data, private_key->dq0.data,
+                                   private_key->dq1.data,
+                                   private_key->qinv.data));
+
+  // Copy the modulus to the public key.
+  HARDENED_TRY(hardened_memcpy(public_key->n.data, private_key->n.data,
+                               ARRAYSIZE(private_key->n.data)));
+
+  return OTCRYPTO_OK;
+}
+
+status_t rsa_keygen_from_primes_crt_3072_start(const rsa_3072_cofactor_t *p,
+                                               const rsa_3072_cofactor_t *q) {
+  return derive_crt_start(kMode3072DeriveCrt, ARRAYSIZE(p->data), p->data,
+                          q->data);
+}
+
+status_t rsa_keygen_from_primes_crt_3072_finalize(
+    rsa_3072_public_key_t *public_key,
+    rsa_3072_crt_private_key_t *private_key) {
+  HARDENED_TRY(keygen_crt_finalize(kMode3072DeriveCrt, kRsa3072NumWords,
+                                   private_key->n.data, private_key->p.data,
+                                   private_key->q.data, private_key->dp0.data,
+                                   private_key->dp1.data, private_key->dq0.data,
+                                   private_key->dq1.data,
+                                   private_key->qinv.data));
+
+  // Copy the modulus to the public key.
+  HARDENED_TRY(hardened_memcpy(public_key->n.data, private_key->n.data,
+                               ARRAYSIZE(private_key->n.data)));
+
+  return OTCRYPTO_OK;
+}
+
+status_t rsa_keygen_crt_4096_start(void) {
+  return keygen_start(kMode4096KeygenCrt);
+}
+
+status_t rsa_keygen_crt_4096_finalize(rsa_4096_public_key_t *public_key,
+                                      rsa_4096_crt_private_key_t *private_key) {
+  HARDENED_TRY(keygen_crt_finalize(kMode4096KeygenCrt, kRsa4096NumWords,
+                                   private_key->n.data, private_key->p.data,
+                                   private_key->q.data, private_key->dp0.data,
+                                   private_key->dp1.data, private_key->dq0.data,
+                                   private_key->dq1.data,
+                                   private_key->qinv.data));
+
+  // Copy the modulus to the public key.
+  HARDENED_TRY(hardened_memcpy(public_key->n.data, private_key->n.data,
+                               ARRAYSIZE(private_key->n.data)));
+
+  return OTCRYPTO_OK;
+}
+
+status_t rsa_keygen_from_primes_crt_4096_start(const rsa_4096_cofactor_t *p,
+                                               const rsa_4096_cofactor_t *q) {
+  return derive_crt_start(kMode4096DeriveCrt, ARRAYSIZE(p->data), p->data,
+                          q->data);
+}
+
+status_t rsa_keygen_from_primes_crt_4096_finalize(
+    rsa_4096_public_key_t *public_key,
+    rsa_4096_crt_private_key_t *private_key) {
+  HARDENED_TRY(keygen_crt_finalize(kMode4096DeriveCrt, kRsa4096NumWords,
+                                   private_key->n.data, private_key->p.data,
+                                   private_key->q.data, private_key->dp0.data,
+                                   private_key->dp1.data, private_key->dq0.data,
+                                   private_key->dq1.data,
+                                   private_key->qinv.data));
+
+  // Copy the modulus to the public key.
+  HARDENED_TRY(hardened_memcpy(public_key->n.data, private_key->n.data,
+                               ARRAYSIZE(private_key->n.data)));
+
+  return OTCRYPTO_OK;
+}
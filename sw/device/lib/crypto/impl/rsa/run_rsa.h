@@ -168,6 +168,63 @@ status_t rsa_modexp_vartime_4096_start(const rsa_4096_int_t *base,
  */
 status_t rsa_modexp_4096_finalize(rsa_4096_int_t *result);
 
+/**
+ * Start an RSA-2048 private-key operation with the CRT.
+ *
+ * Runs two half-size constant-time exponentiations modulo p and q and
+ * recombines them with Garner's formula. Before releasing the result, OTBN
+ * checks it with the public exponent e=65537 and raises an error if the check
+ * fails, so that a fault during the computation does not leak the key.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * The result can be read with `rsa_modexp_2048_finalize()`.
+ *
+ * @param base Exponentiation base.
+ * @param private_key Private key in CRT form.
+ * @return Status of the operation (OK or error).
+ */
+status_t rsa_modexp_crt_2048_start(
+    const rsa_2048_int_t *base, const rsa_2048_crt_private_key_t *private_key);
+
+/**
+ * Start an RSA-3072 private-key operation with the CRT.
+ *
+ * Runs two half-size constant-time exponentiations modulo p and q and
+ * recombines them with Garner's formula. Before releasing the result, OTBN
+ * checks it with the public exponent e=65537 and raises an error if the check
+ * fails, so that a fault during the computation does not leak the key.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * The result can be read with `rsa_modexp_3072_finalize()`.
+ *
+ * @param base Exponentiation base.
+ * @param private_key Private key in CRT form.
+ * @return Status of the operation (OK or error).
+ */
+status_t rsa_modexp_crt_3072_start(
+    const rsa_3072_int_t *base, const rsa_3072_crt_private_key_t *private_key);
+
+/**
+ * Start an RSA-4096 private-key operation with the CRT.
+ *
+ * Runs two half-size constant-time exponentiations modulo p and q and
+ * recombines them with Garner's formula. Before releasing the result, OTBN
+ * checks it with the public exponent e=65537 and raises an error if the check
+ * fails, so that a fault during the computation does not leak the key.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * The result can be read with `rsa_modexp_4096_finalize()`.
+ *
+ * @param base Exponentiation base.
+ * @param private_key Private key in CRT form.
+ * @return Status of the operation (OK or error).
+ */
+status_t rsa_modexp_crt_4096_start(
+    const rsa_4096_int_t *base, const rsa_4096_crt_private_key_t *private_key);
+
 /**
  * Starts an RSA-2048 key generation operation; returns immediately.
  *
@@ -240,6 +297,171 @@ status_t rsa_keygen_4096_start(void);
 status_t rsa_keygen_4096_finalize(rsa_4096_public_key_t *public_key,
                                   rsa_4096_private_key_t *private_key);
 
+/**
+ * Starts an RSA-2048 key generation operation for a CRT key; returns
+ * immediately.
+ *
+ * The key exponent is always F4=65537; no other exponents are supported.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * @return Result of the operation (OK or error).
+ */
+status_t rsa_keygen_crt_2048_start(void);
+
+/**
+ * Waits for an RSA-2048 CRT key generation to complete.
+ *
+ * Should be invoked only after `rsa_keygen_crt_2048_start`. Blocks until OTBN
+ * is done processing.
+ *
+ * @param[out] public_key Generated public key (n, e).
+ * @param[out] private_key Generated private key in CRT form.
+ * @return Result of the operation (OK or error).
+ */
+status_t rsa_keygen_crt_2048_finalize(rsa_2048_public_key_t *public_key,
+                                      rsa_2048_crt_private_key_t *private_key);
+
+/**
+ * Starts deriving an RSA-2048 CRT key from its primes; returns immediately.
+ *
+ * The primes must both be exactly half the length of the modulus (i.e. the
+ * most significant bit is set). The key exponent is always F4=65537; no other
+ * exponents are supported.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * @param p First prime.
+ * @param q Second prime.
+ * @return Result of the operation (OK or error).
+ */
+status_t rsa_keygen_from_primes_crt_2048_start(const rsa_2048_cofactor_t *p,
+                                               const rsa_2048_cofactor_t *q);
+
+/**
+ * Waits for an RSA-2048 CRT key derivation to complete.
+ *
+ * Should be invoked only after `rsa_keygen_from_primes_crt_2048_start`. Blocks
+ * until OTBN is done processing.
+ *
+ * @param[out] public_key Derived public key (n, e).
+ * @param[out] private_key Derived private key in CRT form.
+ * @return Result of the operation (OK or error).
+ */
+status_t rsa_keygen_from_primes_crt_2048_finalize(
+    rsa_2048_public_key_t *public_key,
+    rsa_2048_crt_private_key_t *private_key);
+
+/**
+ * Starts an RSA-3072 key generation operation for a CRT key; returns
+ * immediately.
+ *
+ * The key exponent is always F4=65537; no other exponents are supported.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * @return Result of the operation (OK or error).
+ */
+status_t rsa_keygen_crt_3072_start(void);
+
+/**
+ * Waits for an RSA-3072 CRT key generation to complete.
+ *
+ * Should be invoked only after `rsa_keygen_crt_3072_start`. Blocks until OTBN
+ * is done processing.
+ *
+ * @param[out] public_key Generated public key (n, e).
+ * @param[out] private_key Generated private key in CRT form.
+ * @return Result of the operation (OK or error).
+ */
+status_t rsa_keygen_crt_3072_finalize(rsa_3072_public_key_t *public_key,
+                                      rsa_3072_crt_private_key_t *private_key);
+
+/**
+ * Starts deriving an RSA-3072 CRT key from its primes; returns immediately.
+ *
+ * The primes must both be exactly half the length of the modulus (i.e. the
+ * most significant bit is set). The key exponent is always F4=65537; no other
+ * exponents are supported.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * @param p First prime.
+ * @param q Second prime.
+ * @return Result of the operation (OK or error).
+ */
+status_t rsa_keygen_from_primes_crt_3072_start(const rsa_3072_cofactor_t *p,
+                                               const rsa_3072_cofactor_t *q);
+
+/**
+ * Waits for an RSA-3072 CRT key derivation to complete.
+ *
+ * Should be invoked only after `rsa_keygen_from_primes_crt_3072_start`. Blocks
+ * until OTBN is done processing.
+ *
+ * @param[out] public_key Derived public key (n, e).
+ * @param[out] private_key Derived private key in CRT form.
+ * @return Result of the operation (OK or error).
+ */
+status_t rsa_keygen_from_primes_crt_3072_finalize(
+    rsa_3072_public_key_t *public_key,
+    rsa_3072_crt_private_key_t *private_key);
+
+/**
+ * Starts an RSA-4096 key generation operation for a CRT key; returns
+ * immediately.
+ *
+ * The key exponent is always F4=65537; no other exponents are supported.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * @return Result of the operation (OK or error).
+ */
+status_t rsa_keygen_crt_4096_start(void);
+
+/**
+ * Waits for an RSA-4096 CRT key generation to complete.
+ *
+ * Should be invoked only after `rsa_keygen_crt_4096_start`. Blocks until OTBN
+ * is done processing.
+ *
+ * @param[out] public_key Generated public key (n, e).
+ * @param[out] private_key Generated private key in CRT form.
+ * @return Result of the operation (OK or error).
+ */
+status_t rsa_keygen_crt_4096_finalize(rsa_4096_public_key_t *public_key,
+                                      rsa_4096_crt_private_key_t *private_key);
+
+/**
+ * Starts deriving an RSA-4096 CRT key from its primes; returns immediately.
+ *
+ * The primes must both be exactly half the length of the modulus (i.e. the
+ * most significant bit is set). The key exponent is always F4=65537; no other
+ * exponents are supported.
+ *
+ * Returns an `OTCRYPTO_ASYNC_INCOMPLETE` error if OTBN is busy.
+ *
+ * @param p First prime.
+ * @param q Second prime.
+ * @return Result of the operation (OK or error).
+ */
+status_t rsa_keygen_from_primes_crt_4096_start(const rsa_4096_cofactor_t *p,
+                                               const rsa_4096_cofactor_t *q);
+
+/**
+ * Waits for an RSA-4096 CRT key derivation to complete.
+ *
+ * Should be invoked only after `rsa_keygen_from_primes_crt_4096_start`. Blocks
+ * until OTBN is done processing.
+ *
+ * @param[out] public_key Derived public key (n, e).
+ * @param[out] private_key Derived private key in CRT form.
+ * @return Result of the operation (OK or error).
+ */
+status_t rsa_keygen_from_primes_crt_4096_finalize(
+    rsa_4096_public_key_t *public_key,
+    rsa_4096_crt_private_key_t *private_key);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
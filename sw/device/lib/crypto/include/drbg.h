@@ -90,9 +90,15 @@ otcrypto_status_t otcrypto_drbg_manual_reseed(
  * The caller should allocate space for the `drbg_output` buffer and set the
  * length of expected output in the `len` field.
  *
- * The output is generated in 16-byte blocks; if `drbg_output->len` is not a
- * multiple of 4, some output from the hardware will be discarded. This detail
- * may be important for known-answer tests.
+ * If `additional_input` is empty, small requests are served from a pool of
+ * pre-generated DRBG output that is refilled in bulk, which makes them much
+ * cheaper. The pool is discarded whenever the DRBG is instantiated, reseeded
+ * or uninstantiated. Output therefore does not line up with single hardware
+ * generate requests; use `otcrypto_drbg_manual_generate` for known-answer
+ * tests.
+ *
+ * Otherwise, the output is generated in 16-byte blocks; if `drbg_output->len`
+ * is not a multiple of 4, some output from the hardware will be discarded.
  *
  * @param additional_input Pointer to the additional data.
  * @param[out] drbg_output Pointer to the generated pseudo random bits.
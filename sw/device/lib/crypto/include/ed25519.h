@@ -28,6 +28,23 @@ typedef enum otcrypto_eddsa_sign_mode {
   kOtcryptoEddsaSignModeHashEddsa = 0x9a6,
 } otcrypto_eddsa_sign_mode_t;
 
+/**
+ * Verification equation for EdDSA signatures.
+ *
+ * RFC 8032 permits both equations. They agree on all honestly generated
+ * signatures, but may disagree on adversarially chosen public keys or
+ * signatures with a small-order component. Use the same mode as the other
+ * verifiers in the system if they must agree on every signature.
+ *
+ * Values are hardened.
+ */
+typedef enum otcrypto_eddsa_verify_mode {
+  // Cofactorless verification, [S]B = R + [k]A.
+  kOtcryptoEddsaVerifyModeCofactorless = 0x7b1,
+  // Cofactored verification, [8][S]B = [8]R + [8][k]A.
+  kOtcryptoEddsaVerifyModeCofactored = 0x56e,
+} otcrypto_eddsa_verify_mode_t;
+
 /**
  * Generates a key pair for Ed25519.
  *
@@ -69,9 +86,17 @@ otcrypto_status_t otcrypto_ed25519_sign(
  * status code, as for other operations, only indicates whether errors were
  * encountered, and may return OK even when the signature is invalid.
  *
+ * The public key is the 32-byte encoding of the point A from RFC 8032, and
+ * the signature is the 64-byte encoding of (R, S). Signatures with an encoding
+ * that cannot be decoded, or with S >= L, are reported as invalid.
+ *
+ * The implementation runs in variable time, which is safe because all inputs
+ * are public.
+ *
  * @param public_key Pointer to the unblinded public key struct.
  * @param input_message Input message to be signed for verification.
  * @param sign_mode EdDSA signature hashing mode.
+ * @param verify_mode EdDSA verification equation.
  * @param signature Pointer to the signature to be verified.
  * @param[out] verification_result Whether the signature passed verification.
  * @return Result of the Ed25519 verification operation.
@@ -80,7 +105,9 @@ OT_WARN_UNUSED_RESULT
 otcrypto_status_t otcrypto_ed25519_verify(
     const otcrypto_unblinded_key_t *public_key,
     otcrypto_const_byte_buf_t input_message,
-    otcrypto_eddsa_sign_mode_t sign_mode, otcrypto_const_word32_buf_t signature,
+    otcrypto_eddsa_sign_mode_t sign_mode,
+    otcrypto_eddsa_verify_mode_t verify_mode,
+    otcrypto_const_word32_buf_t signature,
     hardened_bool_t *verification_result);
 
 /**
@@ -147,11 +174,12 @@ otcrypto_status_t otcrypto_ed25519_sign_async_finalize(
 /**
  * Starts asynchronous signature verification for Ed25519.
  *
- * See `otcrypto_ecdsa_p256_verify` for requirements on input values.
+ * See `otcrypto_ed25519_verify` for requirements on input values.
  *
  * @param public_key Pointer to the unblinded public key struct.
  * @param input_message Input message to be signed for verification.
  * @param sign_mode EdDSA signature hashing mode.
+ * @param verify_mode EdDSA verification equation.
  * @param signature Pointer to the signature to be verified.
  * @return Result of async Ed25519 verification start operation.
  */
@@ -160,12 +188,13 @@ otcrypto_status_t otcrypto_ed25519_verify_async_start(
     const otcrypto_unblinded_key_t *public_key,
     otcrypto_const_byte_buf_t input_message,
     otcrypto_eddsa_sign_mode_t sign_mode,
+    otcrypto_eddsa_verify_mode_t verify_mode,
     otcrypto_const_word32_buf_t signature);
 
 /**
  * Finalizes asynchronous signature verification for Ed25519.
  *
- * See `otcrypto_ecdsa_p256_verify` for requirements on input values.
+ * See `otcrypto_ed25519_verify` for requirements on input values.
  *
  * May block until the operation is complete.
  *
@@ -75,6 +75,18 @@ enum {
   kOtcryptoRsa2048PrivateKeyblobBytes = 768,
   kOtcryptoRsa3072PrivateKeyblobBytes = 1152,
   kOtcryptoRsa4096PrivateKeyblobBytes = 1536,
+  /**
+   * Number of bytes needed for RSA private keyblobs in CRT form.
+   *
+   * CRT keys hold the primes p and q, the exponents d mod (p - 1) and
+   * d mod (q - 1) and the coefficient q^-1 mod p instead of d, which makes
+   * private-key operations several times faster. Set `keyblob_length` to
+   * this value instead of the one above to generate or use a CRT key;
+   * `config.key_length` stays the same.
+   */
+  kOtcryptoRsa2048CrtPrivateKeyblobBytes = 1152,
+  kOtcryptoRsa3072CrtPrivateKeyblobBytes = 1728,
+  kOtcryptoRsa4096CrtPrivateKeyblobBytes = 2304,
 };
 
 /**
@@ -89,6 +101,10 @@ enum {
  * space for the keyblob, setting `config.key_length` and `keyblob_length`
  * accordingly.
  *
+ * If `keyblob_length` is the CRT keyblob length for this size (e.g.
+ * `kOtcryptoRsa2048CrtPrivateKeyblobBytes`), the private key is generated in
+ * CRT form.
+ *
  * The value in the `checksum` field of key structs is not checked here and
  * will be populated by the key generation function.
  *
@@ -158,6 +174,30 @@ otcrypto_status_t otcrypto_rsa_keypair_from_cofactor(
     otcrypto_const_word32_buf_t cofactor_share1,
     otcrypto_unblinded_key_t *public_key, otcrypto_blinded_key_t *private_key);
 
+/**
+ * Constructs an RSA keypair in CRT form from its two primes.
+ *
+ * Computes the modulus n = p * q, the private exponents d mod (p - 1) and
+ * d mod (q - 1) for e=2^16+1, and the coefficient q^-1 mod p. Both primes must
+ * be exactly half the length of the modulus.
+ *
+ * The caller should allocate space for the private key and set the `keyblob`,
+ * `keyblob_length`, and `key_length` fields accordingly; `keyblob_length` must
+ * be the CRT keyblob length for this size. Similarly, the caller should
+ * allocate space for the public key and set the `key` and `key_length` fields.
+ *
+ * @param size RSA size parameter.
+ * @param p First prime.
+ * @param q Second prime.
+ * @param[out] public_key Destination public key struct.
+ * @param[out] private_key Destination private key struct.
+ * @return Result of the RSA key construction.
+ */
+otcrypto_status_t otcrypto_rsa_keypair_from_primes(
+    otcrypto_rsa_size_t size, otcrypto_const_word32_buf_t p,
+    otcrypto_const_word32_buf_t q, otcrypto_unblinded_key_t *public_key,
+    otcrypto_blinded_key_t *private_key);
+
 /**
  * Computes the digital signature on the input message data.
  *
@@ -279,6 +319,18 @@ otcrypto_status_t otcrypto_rsa_decrypt(
  */
 otcrypto_status_t otcrypto_rsa_keygen_async_start(otcrypto_rsa_size_t size);
 
+/**
+ * Starts the asynchronous RSA key generation function for a CRT key.
+ *
+ * Like `otcrypto_rsa_keygen_async_start`, but the private key is generated in
+ * CRT form. Finalize with `otcrypto_rsa_keygen_async_finalize`, passing a
+ * private key with the CRT keyblob length.
+ *
+ * @param size RSA size parameter.
+ * @return Result of async RSA keygen start operation.
+ */
+otcrypto_status_t otcrypto_rsa_keygen_crt_async_start(otcrypto_rsa_size_t size);
+
 /**
  * Finalizes the asynchronous RSA key generation function.
  *
@@ -328,6 +380,34 @@ otcrypto_status_t otcrypto_rsa_keypair_from_cofactor_async_start(
 otcrypto_status_t otcrypto_rsa_keypair_from_cofactor_async_finalize(
     otcrypto_unblinded_key_t *public_key, otcrypto_blinded_key_t *private_key);
 
+/**
+ * Starts constructing an RSA keypair in CRT form from its two primes.
+ *
+ * See `otcrypto_rsa_keypair_from_primes` for the details on the requirements
+ * for input buffers.
+ *
+ * @param size RSA size parameter.
+ * @param p First prime.
+ * @param q Second prime.
+ * @return Result of the RSA key construction.
+ */
+otcrypto_status_t otcrypto_rsa_keypair_from_primes_async_start(
+    otcrypto_rsa_size_t size, otcrypto_const_word32_buf_t p,
+    otcrypto_const_word32_buf_t q);
+
+/**
+ * Finalizes constructing an RSA keypair in CRT form from its two primes.
+ *
+ * See `otcrypto_rsa_keypair_from_primes` for the details on the requirements
+ * for output buffers.
+ *
+ * @param[out] public_key Destination public key struct.
+ * @param[out] private_key Destination private key struct.
+ * @return Result of the RSA key construction.
+ */
+otcrypto_status_t otcrypto_rsa_keypair_from_primes_async_finalize(
+    otcrypto_unblinded_key_t *public_key, otcrypto_blinded_key_t *private_key);
+
 /**
  * Starts the asynchronous digital signature generation function.
  *
@@ -94,3 +94,36 @@ void base_log_internal_dv(const log_fields_t *log, uint32_t nargs, ...) {
   }
   va_end(args);
 }
+
+/**
+ * Logs `log` and the values that follow as a binary frame on stdout.
+ *
+ * The frame is `kLogTokenizedFrameMagic`, the number of arguments as one byte,
+ * the address of `log` and then each argument, all 32-bit values in
+ * little-endian order. The message is rebuilt on the host by
+ * util/device_sw_utils/decode_tokenized_logs.py.
+ *
+ * @param log a pointer to log data to log. As in DV mode, this pointer is
+ *        likely to be invalid at runtime.
+ * @param nargs the number of arguments passed to the format string.
+ * @param ... format parameters matching the format string.
+ */
+void base_log_internal_tokenized(const log_fields_t *log, uint32_t nargs,
+                                 ...) {
+  // `OT_VA_ARGS_COUNT()` counts at most 31 arguments, so the whole frame fits
+  // in a small buffer and can be written with a single call to the sink.
+  uint32_t frame[2 + 31];
+  uint8_t *bytes = (uint8_t *)frame + 2;
+  bytes[0] = kLogTokenizedFrameMagic;
+  bytes[1] = (uint8_t)nargs;
+  frame[1] = (uintptr_t)log;
+
+  va_list args;
+  va_start(args, nargs);
+  for (uint32_t i = 0; i < nargs; ++i) {
+    frame[2 + i] = va_arg(args, uint32_t);
+  }
+  va_end(args);
+
+  base_printf("%!s", 2 + (nargs + 1) * sizeof(uint32_t), bytes);
+}
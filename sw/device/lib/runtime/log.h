@@ -35,7 +35,15 @@
  * devices, like Verilator, logs are printed using whatever `stdout` is set to
  * in print.h. DV testbenches may use an alternative, more efficient mechanism.
  *
- * In DV mode, some format specifiers may be unsupported, such as %s.
+ * When built with `OT_LOG_TOKENIZED` defined (`--define ot_log_tokenized=true`),
+ * logs are not formatted on the device either. Instead, a compact binary frame
+ * holding the address of the log's `log_fields_t` record and its raw arguments
+ * is written to `stdout`, and the message is rebuilt on the host from the ELF
+ * file by util/device_sw_utils/decode_tokenized_logs.py. Lines that test
+ * harnesses wait for on the console use `LOG_UNTOKENIZED` and stay plain text.
+ *
+ * In DV and tokenized mode, some format specifiers may be unsupported, such as
+ * %s with a string that is not a constant in the ELF file.
  */
 
 /**
@@ -57,8 +65,9 @@ typedef enum log_severity {
  * assumptions. A post-processing script parses the ELF file and extracts the
  * log fields. The said script uses 20-byte size as the delimiter to collect the
  * log fields. Any changes to this struct must be accompanied with the updates
- * to the script, located here:
- * util/device_sw_utils/extract_sw_logs.py.
+ * to the scripts, located here:
+ * util/device_sw_utils/extract_sw_logs.py and
+ * util/device_sw_utils/decode_tokenized_logs.py.
  */
 typedef struct log_fields {
   /**
@@ -97,6 +106,20 @@ void base_log_internal_core(const log_fields_t *log, ...);
  * Implementation detail.
  */
 void base_log_internal_dv(const log_fields_t *log, uint32_t nargs, ...);
+/**
+ * Implementation detail.
+ */
+void base_log_internal_tokenized(const log_fields_t *log, uint32_t nargs, ...);
+
+enum {
+  /**
+   * First byte of a tokenized log frame.
+   *
+   * This is not an ASCII character, so frames can be told apart from plain
+   * text written to the same console.
+   */
+  kLogTokenizedFrameMagic = 0xa5,
+};
 
 extern char _dv_log_offset[];
 
@@ -119,6 +142,22 @@ extern char _dv_log_offset[];
 #define OT_CHECK_VALID_LOG_ARGS(...) \
   OT_VA_FOR_EACH(OT_FAIL_IF_64_BIT_LOG, ##__VA_ARGS__)
 
+/**
+ * Implementation details of `LOG`.
+ *
+ * These select whether a log line uses a record in `.logs.fields`, and which
+ * function emits it.
+ */
+#ifdef OT_LOG_TOKENIZED
+#define LOG_USE_FIELDS_SECTION_() true
+#define LOG_FIELDS_SECTION_FN_()                               \
+  (device_log_bypass_uart_address() != 0 ? base_log_internal_dv \
+                                         : base_log_internal_tokenized)
+#else
+#define LOG_USE_FIELDS_SECTION_() (device_log_bypass_uart_address() != 0)
+#define LOG_FIELDS_SECTION_FN_() base_log_internal_dv
+#endif
+
 /**
  * Basic logging macro that all other logging macros delegate to.
  *
@@ -129,21 +168,44 @@ extern char _dv_log_offset[];
  *               string literal.
  * @param ... format parameters matching the format string.
  */
-#define LOG(severity, format, ...)                               \
+#define LOG(severity, format, ...)                                         \
+  LOG_IMPL_(LOG_USE_FIELDS_SECTION_(), LOG_FIELDS_SECTION_FN_(), severity, \
+            format, ##__VA_ARGS__)
+
+/**
+ * Like `LOG`, but never tokenized.
+ *
+ * This is meant for the few lines that test harnesses match on the console,
+ * such as the PASS/FAIL status lines of the test framework, which must stay
+ * readable when the rest of the log is tokenized.
+ *
+ * @param severity a severity of type `log_severity_t`.
+ * @param format a format string, as described in print.h. This must be a
+ *               string literal.
+ * @param ... format parameters matching the format string.
+ */
+#define LOG_UNTOKENIZED(severity, format, ...)                           \
+  LOG_IMPL_(device_log_bypass_uart_address() != 0, base_log_internal_dv, \
+            severity, format, ##__VA_ARGS__)
+
+/**
+ * Implementation detail of `LOG` and `LOG_UNTOKENIZED`.
+ */
+#define LOG_IMPL_(use_fields, fields_fn, severity, format, ...)  \
   do {                                                           \
     OT_CHECK_VALID_LOG_ARGS(__VA_ARGS__);                        \
-    if (device_log_bypass_uart_address() != 0) {                 \
+    if (use_fields) {                                            \
       /* clang-format off */                                     \
-      /* Put DV-only log constants in .logs.* sections, which
-       * the linker will dutifully discard.
+      /* Put DV and tokenized log constants in .logs.* sections,
+       * which the linker will dutifully discard.
        * Unfortunately, clang-format really mangles these
        * declarations, so we format them manually. */            \
       __attribute__((section(".logs.fields")))                   \
       static const log_fields_t kLogFields =                     \
           LOG_MAKE_FIELDS_(severity, format, ##__VA_ARGS__);     \
-      base_log_internal_dv((const log_fields_t*)((char*)&kLogFields + (uintptr_t)&_dv_log_offset), \
-                           OT_VA_ARGS_COUNT(format, ##__VA_ARGS__), \
-                           ##__VA_ARGS__); /* clang-format on */ \
+      fields_fn((const log_fields_t*)((char*)&kLogFields + (uintptr_t)&_dv_log_offset), \
+                OT_VA_ARGS_COUNT(format, ##__VA_ARGS__),         \
+                ##__VA_ARGS__); /* clang-format on */            \
     } else {                                                     \
       static const log_fields_t log_fields =                     \
           LOG_MAKE_FIELDS_(severity, format, ##__VA_ARGS__);     \
@@ -152,7 +214,7 @@ extern char _dv_log_offset[];
   } while (false)
 
 /**
- * Implementation detail of `LOG`.
+ * Implementation detail of `LOG` and `LOG_UNTOKENIZED`.
  */
 #define LOG_MAKE_FIELDS_(_severity, _format, ...)                         \
   {                                                                       \
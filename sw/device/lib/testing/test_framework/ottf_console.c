@@ -11,6 +11,7 @@
 #include "sw/device/lib/base/status.h"
 #include "sw/device/lib/runtime/ibex.h"
 #include "sw/device/lib/testing/test_framework/check.h"
+#include "sw/device/lib/testing/test_framework/status.h"
 
 #define MODULE_ID MAKE_MODULE_ID('o', 't', 'c')
 
@@ -19,6 +20,18 @@ static ottf_console_t main_console;
 
 static volatile uint32_t flow_control_irqs;
 
+#ifdef OTTF_CONSOLE_HAS_UART
+enum {
+  /**
+   * Size of the TX ring buffer of the main console UART.
+   */
+  kMainUartTxBufSize = 1024,
+};
+
+// TX ring buffer of the main console UART.
+static uint8_t main_uart_tx_buf[kMainUartTxBufSize];
+#endif
+
 ottf_console_t *ottf_console_get(void) { return &main_console; }
 
 static status_t ottf_console_null_getc(void *io) {
@@ -55,6 +68,14 @@ void ottf_console_init(void) {
       if (kOttfTestConfig.enable_uart_flow_control) {
         ottf_console_uart_flow_control_enable(&main_console);
       }
+      // Initialize/Configure the interrupt-driven TX path (if requested). Tests
+      // that may clobber the console own its interrupts, so they keep the
+      // polled TX path.
+      if (kOttfTestConfig.enable_uart_tx_irq &&
+          !kOttfTestConfig.console.test_may_clobber) {
+        ottf_console_uart_tx_irq_enable(&main_console, main_uart_tx_buf,
+                                        sizeof(main_uart_tx_buf));
+      }
       break;
 #endif
 #ifdef OTTF_CONSOLE_HAS_SPI_DEVICE
@@ -85,6 +106,12 @@ void ottf_console_init(void) {
 uint32_t ottf_console_get_flow_control_irqs(void) { return flow_control_irqs; }
 
 bool ottf_console_flow_control_isr(uint32_t *exc_info) {
+#ifdef OTTF_CONSOLE_HAS_UART
+  if (main_console.type == kOttfConsoleUart &&
+      ottf_console_uart_tx_isr(exc_info, &main_console)) {
+    return true;
+  }
+#endif
   flow_control_irqs += 1;
 #ifdef OTTF_CONSOLE_HAS_UART
   return ottf_console_uart_flow_control_isr(exc_info, &main_console);
@@ -117,17 +144,26 @@ void ottf_console_set_buffering(ottf_console_t *console, bool enabled,
 }
 
 status_t ottf_console_flush(ottf_console_t *console) {
+  size_t written_len = 0;
   if (console->buffered && console->buf_end > 0) {
-    size_t written_len = console->sink(console, console->buf, console->buf_end);
+    written_len = console->sink(console, console->buf, console->buf_end);
     size_t lost = console->buf_end - written_len;
     console->buf_end = 0;
     if (lost > 0) {
       return DATA_LOSS((int32_t)lost);
-    } else {
-      return OK_STATUS((int32_t)written_len);
     }
   }
-  return OK_STATUS(0);
+#ifdef OTTF_CONSOLE_HAS_UART
+  if (console->type == kOttfConsoleUart) {
+    TRY(ottf_console_uart_tx_flush(console));
+  }
+#endif
+  return OK_STATUS((int32_t)written_len);
+}
+
+void test_status_flush_console(void) {
+  // Nothing useful can be done about a failure at this point.
+  OT_DISCARD(ottf_console_flush(&main_console));
 }
 
 static status_t ottf_console_write_unbuffered(ottf_console_t *console,
@@ -89,10 +89,11 @@ status_t ottf_console_flow_control(ottf_console_t *console,
 /**
  * Manage console flow control *for the main console* from interrupt context.
  *
- * Call this when a console UART interrupt triggers.
+ * Call this when a console UART interrupt triggers. This also services the
+ * TX watermark IRQ of the interrupt-driven TX path, if it is enabled.
  *
  * @param exc_info The OTTF execution info passed to all ISRs.
- * @return True if an RX Watermark IRQ was detected and handled. False
+ * @return True if an RX or TX Watermark IRQ was detected and handled. False
  * otherwise.
  */
 bool ottf_console_flow_control_isr(uint32_t *exc_info);
@@ -5,6 +5,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "hw/top/uart_regs.h"  // Generated.
+#include "sw/device/lib/base/bitfield.h"
+#include "sw/device/lib/base/csr.h"
 #include "sw/device/lib/base/mmio.h"
 #include "sw/device/lib/base/status.h"
 #include "sw/device/lib/dif/dif_pinmux.h"
@@ -27,6 +30,14 @@ enum {
   kFlowControlLowWatermark = 4,   // bytes
   kFlowControlHighWatermark = 8,  // bytes
   kFlowControlRxWatermark = kDifUartWatermarkByte8,
+  /**
+   * Refill the TX FIFO from the TX ring buffer when it drops below half full.
+   */
+  kTxRingWatermark = kDifUartWatermarkByte16,
+  /**
+   * Global interrupt enable bit in `mstatus`.
+   */
+  kMstatusMie = 0x8,
   /**
    * HART PLIC Target.
    */
@@ -35,10 +46,20 @@ enum {
 
 static status_t ottf_console_uart_getc(void *io) {
   ottf_console_t *console = io;
-  uint8_t byte;
-  TRY(dif_uart_byte_receive_polled(&console->data.uart.dif, &byte));
-  TRY(ottf_console_flow_control(io, kOttfConsoleFlowControlAuto));
-  return OK_STATUS(byte);
+  ottf_console_uart_t *uart = &console->data.uart;
+  if (uart->rx_start == uart->rx_end) {
+    // Wait for a byte, then take everything else the RX FIFO holds, so that
+    // the FIFO and flow control are handled once per burst of input rather
+    // than once per byte.
+    size_t read = 0;
+    TRY(dif_uart_byte_receive_polled(&uart->dif, &uart->rx_buf[0]));
+    TRY(dif_uart_bytes_receive(&uart->dif, sizeof(uart->rx_buf) - 1,
+                               &uart->rx_buf[1], &read));
+    uart->rx_start = 0;
+    uart->rx_end = 1 + read;
+    TRY(ottf_console_flow_control(io, kOttfConsoleFlowControlAuto));
+  }
+  return OK_STATUS(uart->rx_buf[uart->rx_start++]);
 }
 
 static size_t ottf_console_uart_sink(void *io, const char *buf, size_t len) {
@@ -52,6 +73,83 @@ static size_t ottf_console_uart_sink(void *io, const char *buf, size_t len) {
   return len;
 }
 
+/**
+ * Moves as many bytes as fit from the TX ring buffer into the TX FIFO.
+ *
+ * Must be called with interrupts disabled or from the ISR.
+ */
+static dif_result_t tx_ring_fill_fifo(ottf_console_uart_t *uart) {
+  while (uart->tx_tail != uart->tx_head) {
+    size_t idx = uart->tx_tail & (uart->tx_buf_size - 1);
+    size_t len = uart->tx_head - uart->tx_tail;
+    if (len > uart->tx_buf_size - idx) {
+      len = uart->tx_buf_size - idx;
+    }
+    size_t written;
+    dif_result_t res =
+        dif_uart_bytes_send(&uart->dif, &uart->tx_buf[idx], len, &written);
+    if (res != kDifOk) {
+      return res;
+    }
+    uart->tx_tail += written;
+    if (written < len) {
+      // The TX FIFO is full.
+      break;
+    }
+  }
+  return kDifOk;
+}
+
+static bool irq_global_enabled(void) {
+  uint32_t mstatus;
+  CSR_READ(CSR_REG_MSTATUS, &mstatus);
+  return (mstatus & kMstatusMie) != 0;
+}
+
+static size_t ottf_console_uart_ring_sink(void *io, const char *buf,
+                                          size_t len) {
+  ottf_console_t *console = io;
+  ottf_console_uart_t *uart = &console->data.uart;
+  // The ring buffer is shared with the ISR, so it is only touched with
+  // interrupts disabled.
+  bool irq_enabled = irq_global_enabled();
+  irq_global_ctrl(false);
+
+  dif_result_t res = kDifOk;
+  size_t i = 0;
+  while (i < len) {
+    if (uart->tx_head - uart->tx_tail == uart->tx_buf_size) {
+      // The ring buffer is full: make room by moving bytes into the FIFO.
+      res = tx_ring_fill_fifo(uart);
+      if (res != kDifOk) {
+        break;
+      }
+      continue;
+    }
+    uart->tx_buf[uart->tx_head & (uart->tx_buf_size - 1)] = (uint8_t)buf[i++];
+    uart->tx_head += 1;
+  }
+
+  if (res == kDifOk && irq_enabled) {
+    // Start sending right away and let the ISR send the rest.
+    res = tx_ring_fill_fifo(uart);
+    if (res == kDifOk && uart->tx_tail != uart->tx_head) {
+      OT_DISCARD(dif_uart_irq_set_enabled(&uart->dif, kDifUartIrqTxWatermark,
+                                          kDifToggleEnabled));
+    }
+  }
+  // In an ISR, a fault handler or a critical section the ISR won't run, so
+  // drain the ring buffer before returning.
+  while (res == kDifOk && !irq_enabled && uart->tx_tail != uart->tx_head) {
+    res = tx_ring_fill_fifo(uart);
+  }
+
+  if (irq_enabled) {
+    irq_global_ctrl(true);
+  }
+  return i;
+}
+
 void ottf_console_configure_uart(ottf_console_t *console, uintptr_t base_addr) {
   console->type = kOttfConsoleUart;
   CHECK_DIF_OK(
@@ -72,17 +170,21 @@ void ottf_console_configure_uart(ottf_console_t *console, uintptr_t base_addr) {
 
   console->getc = ottf_console_uart_getc;
   console->sink = ottf_console_uart_sink;
+  console->data.uart.tx_buf = NULL;
+  console->data.uart.tx_buf_size = 0;
+  console->data.uart.rx_start = 0;
+  console->data.uart.rx_end = 0;
 }
 
-static uint32_t get_flow_control_watermark_plic_id(ottf_console_t *console) {
+static uint32_t get_plic_id(ottf_console_t *console, dt_uart_irq_t irq) {
   for (size_t i = 0; i < kDtUartCount; i++) {
     dt_uart_t uart = (dt_uart_t)i;
     if (console->data.uart.dif.base_addr.base ==
         (void *)dt_uart_primary_reg_block(uart)) {
-      return dt_uart_irq_to_plic_id(uart, kDtUartIrqRxWatermark);
+      return dt_uart_irq_to_plic_id(uart, irq);
     }
   }
-  return dt_uart_irq_to_plic_id(kDtUart0, kDtUartIrqRxWatermark);
+  return dt_uart_irq_to_plic_id(kDtUart0, irq);
 }
 
 void ottf_console_uart_flow_control_enable(ottf_console_t *console) {
@@ -94,14 +196,14 @@ void ottf_console_uart_flow_control_enable(ottf_console_t *console) {
 
   // Set IRQ priorities to MAX
   CHECK_DIF_OK(dif_rv_plic_irq_set_priority(
-      &ottf_plic, get_flow_control_watermark_plic_id(console),
+      &ottf_plic, get_plic_id(console, kDtUartIrqRxWatermark),
       kDifRvPlicMaxPriority));
   // Set Ibex IRQ priority threshold level
   CHECK_DIF_OK(dif_rv_plic_target_set_threshold(&ottf_plic, kPlicTarget,
                                                 kDifRvPlicMinPriority));
   // Enable IRQs in PLIC
   CHECK_DIF_OK(dif_rv_plic_irq_set_enabled(
-      &ottf_plic, get_flow_control_watermark_plic_id(console), kPlicTarget,
+      &ottf_plic, get_plic_id(console, kDtUartIrqRxWatermark), kPlicTarget,
       kDifToggleEnabled));
 
   console->data.uart.flow_control_state = kOttfConsoleFlowControlAuto;
@@ -111,6 +213,84 @@ void ottf_console_uart_flow_control_enable(ottf_console_t *console) {
   ottf_console_flow_control(console, kOttfConsoleFlowControlResume);
 }
 
+void ottf_console_uart_tx_irq_enable(ottf_console_t *console, uint8_t *buf,
+                                     size_t size) {
+  CHECK(console->type == kOttfConsoleUart);
+  CHECK(size > 0 && (size & (size - 1)) == 0,
+        "TX buffer size must be a power of two");
+  ottf_console_uart_t *uart = &console->data.uart;
+  CHECK_DIF_OK(dif_uart_watermark_tx_set(&uart->dif, kTxRingWatermark));
+  // The TX watermark interrupt is status type, so it stays disabled until
+  // there is something to send.
+  CHECK_DIF_OK(dif_uart_irq_set_enabled(&uart->dif, kDifUartIrqTxWatermark,
+                                        kDifToggleDisabled));
+  uart->tx_buf = buf;
+  uart->tx_buf_size = size;
+  uart->tx_head = 0;
+  uart->tx_tail = 0;
+
+  CHECK_DIF_OK(dif_rv_plic_irq_set_priority(
+      &ottf_plic, get_plic_id(console, kDtUartIrqTxWatermark),
+      kDifRvPlicMaxPriority));
+  CHECK_DIF_OK(dif_rv_plic_target_set_threshold(&ottf_plic, kPlicTarget,
+                                                kDifRvPlicMinPriority));
+  CHECK_DIF_OK(dif_rv_plic_irq_set_enabled(
+      &ottf_plic, get_plic_id(console, kDtUartIrqTxWatermark), kPlicTarget,
+      kDifToggleEnabled));
+
+  console->sink = ottf_console_uart_ring_sink;
+  irq_global_ctrl(true);
+  irq_external_ctrl(true);
+}
+
+bool ottf_console_uart_tx_isr(uint32_t *exc_info, ottf_console_t *console) {
+  CHECK(console->type == kOttfConsoleUart);
+  ottf_console_uart_t *uart = &console->data.uart;
+  if (uart->tx_buf == NULL) {
+    return false;
+  }
+  bool tx;
+  CHECK_DIF_OK(
+      dif_uart_irq_is_pending(&uart->dif, kDifUartIrqTxWatermark, &tx));
+  if (!tx) {
+    return false;
+  }
+  CHECK_DIF_OK(tx_ring_fill_fifo(uart));
+  if (uart->tx_tail == uart->tx_head) {
+    // Nothing left to send: disable the interrupt to avoid an infinite loop
+    // of ISRs while the TX FIFO is below the watermark.
+    CHECK_DIF_OK(dif_uart_irq_set_enabled(&uart->dif, kDifUartIrqTxWatermark,
+                                          kDifToggleDisabled));
+  }
+  CHECK_DIF_OK(dif_uart_irq_acknowledge(&uart->dif, kDifUartIrqTxWatermark));
+  return true;
+}
+
+status_t ottf_console_uart_tx_flush(ottf_console_t *console) {
+  CHECK(console->type == kOttfConsoleUart);
+  ottf_console_uart_t *uart = &console->data.uart;
+  if (uart->tx_buf == NULL) {
+    // The polled sink waits for every byte to be sent.
+    return OK_STATUS();
+  }
+  bool irq_enabled = irq_global_enabled();
+  irq_global_ctrl(false);
+  dif_result_t res = kDifOk;
+  while (res == kDifOk && uart->tx_tail != uart->tx_head) {
+    res = tx_ring_fill_fifo(uart);
+  }
+  if (irq_enabled) {
+    irq_global_ctrl(true);
+  }
+  TRY(res);
+  // Wait for the TX FIFO and the shift register to drain.
+  while (!bitfield_bit32_read(
+      mmio_region_read32(uart->dif.base_addr, UART_STATUS_REG_OFFSET),
+      UART_STATUS_TXIDLE_BIT)) {
+  }
+  return OK_STATUS();
+}
+
 // This version of the function is safe to call from within the ISR.
 static status_t manage_flow_control(ottf_console_t *console,
                                     ottf_console_flow_control_t ctrl) {
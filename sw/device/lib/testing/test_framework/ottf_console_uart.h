@@ -8,12 +8,31 @@
 #include "sw/device/lib/dif/dif_uart.h"
 #include "sw/device/lib/testing/test_framework/ottf_console_types.h"
 
+enum {
+  /**
+   * Size of the console RX buffer, the depth of the UART RX FIFO.
+   */
+  kOttfConsoleUartRxBufSize = 32,
+};
+
 typedef struct ottf_console_uart {
   // DIF handle.
   dif_uart_t dif;
   // This variable is shared between the interrupt service handler and user
   // code.
   volatile ottf_console_flow_control_t flow_control_state;
+  // TX ring buffer drained by the TX watermark ISR, or NULL if bytes are sent
+  // with polling. The size is a power of two.
+  uint8_t *tx_buf;
+  size_t tx_buf_size;
+  // Free-running write and read positions in `tx_buf`. Both are only updated
+  // with interrupts disabled or from the ISR.
+  volatile size_t tx_head;
+  volatile size_t tx_tail;
+  // Bytes read from the RX FIFO in bulk that `getc` has not returned yet.
+  uint8_t rx_buf[kOttfConsoleUartRxBufSize];
+  size_t rx_start;
+  size_t rx_end;
 } ottf_console_uart_t;
 
 /**
@@ -58,6 +77,52 @@ void ottf_console_uart_flow_control_enable(ottf_console_t *console);
 bool ottf_console_uart_flow_control_isr(uint32_t *exc_info,
                                         ottf_console_t *console);
 
+/**
+ * Enable the interrupt-driven TX path for the OTTF console.
+ *
+ * Console output is queued in `buf` and moved into the UART TX FIFO by the TX
+ * watermark ISR, so the caller does not wait for the UART to send each byte.
+ * If interrupts are disabled when output is written (e.g. in an ISR or a
+ * fault handler), the queue is drained by polling before the write returns.
+ *
+ * This function configures UART interrupts at the PLIC and enables interrupts
+ * at the CPU.
+ *
+ * WARNING The TX path requires IRQ dispatching, see
+ * `ottf_console_uart_flow_control_enable`. For non-main consoles you must call
+ * `ottf_console_uart_tx_isr` from your IRQ handler.
+ *
+ * @param console Pointer to the console.
+ * @param buf Buffer to queue output in.
+ * @param size Size of `buf`, must be a power of two.
+ */
+void ottf_console_uart_tx_irq_enable(ottf_console_t *console, uint8_t *buf,
+                                     size_t size);
+
+/**
+ * Move queued console output into the UART TX FIFO from interrupt context.
+ *
+ * You should only call this function directly for *non-main* consoles.
+ *
+ * @param exc_info The OTTF execution info passed to all ISRs.
+ * @param console Pointer to the console.
+ * @return True if a TX Watermark IRQ was detected and handled. False
+ * otherwise.
+ */
+bool ottf_console_uart_tx_isr(uint32_t *exc_info, ottf_console_t *console);
+
+/**
+ * Wait until all console output has left the UART.
+ *
+ * If the interrupt-driven TX path is enabled, drains the TX queue and waits
+ * for the UART transmitter to become idle. Otherwise there is nothing to do,
+ * as the polled TX path returns only once each byte has been sent.
+ *
+ * @param console Pointer to the console.
+ * @return OK or an error.
+ */
+status_t ottf_console_uart_tx_flush(ottf_console_t *console);
+
 /**
  * Manage flow control for UART.
  *
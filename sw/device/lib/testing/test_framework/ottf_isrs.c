@@ -96,8 +96,9 @@ void ottf_generic_fault_print(uint32_t *exc_info, const char *reason,
       }
     }
   }
-  LOG_ERROR("FAULT: %s. MCAUSE=%08x MEPC=%08x MTVAL=%08x", reason, mcause, mepc,
-            mtval);
+  LOG_UNTOKENIZED(kLogSeverityError,
+                  "FAULT: %s. MCAUSE=%08x MEPC=%08x MTVAL=%08x", reason, mcause,
+                  mepc, mtval);
 }
 
 static void generic_fault_handler(uint32_t *exc_info) {
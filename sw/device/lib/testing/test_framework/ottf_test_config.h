@@ -110,6 +110,16 @@ typedef struct ottf_test_config {
    */
   bool enable_uart_flow_control;
 
+  /**
+   * Indicates that console output to the UART should be queued in a ring
+   * buffer and sent from the TX watermark interrupt, rather than by polling
+   * the UART for each byte. The queue is flushed when the test ends. Note that
+   * this will unmask the external interrupt and enable interrupt handling
+   * before `test_main` begins. It has no effect if the test may clobber the
+   * console.
+   */
+  bool enable_uart_tx_irq;
+
   /**
    * Indicates that this test needs an explicit clear of the RSTMGR reset_reason
    * register.  This may be necessary for tests that execute with the OTP
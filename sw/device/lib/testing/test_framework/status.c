@@ -7,6 +7,7 @@
 #include <stdatomic.h>
 
 #include "sw/device/lib/arch/device.h"
+#include "sw/device/lib/base/macros.h"
 #include "sw/device/lib/base/mmio.h"
 #include "sw/device/lib/runtime/hart.h"
 #include "sw/device/lib/runtime/log.h"
@@ -24,6 +25,9 @@ static void test_status_device_write(test_status_t test_status) {
   }
 }
 
+OT_WEAK
+void test_status_flush_console(void) {}
+
 void test_status_set(test_status_t test_status) {
   // This function is used to convey info to test harness, which may poke at
   // backdoor variables. Add a fence to provide corrrect synchronization.
@@ -34,13 +38,15 @@ void test_status_set(test_status_t test_status) {
 
   switch (test_status) {
     case kTestStatusPassed: {
-      LOG_INFO("PASS!");
+      LOG_UNTOKENIZED(kLogSeverityInfo, "PASS!");
+      test_status_flush_console();
       test_status_device_write(test_status);
       abort();
       break;
     }
     case kTestStatusFailed: {
-      LOG_INFO("FAIL!");
+      LOG_UNTOKENIZED(kLogSeverityInfo, "FAIL!");
+      test_status_flush_console();
       test_status_device_write(test_status);
       abort();
       break;
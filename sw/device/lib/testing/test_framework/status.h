@@ -86,4 +86,13 @@ typedef enum test_status {
  */
 void test_status_set(test_status_t test_status);
 
+/**
+ * Waits until all pending console output has been sent.
+ *
+ * Called by `test_status_set()` before it reports a terminal state, so that
+ * output queued by the console is not cut off when the simulation ends. The
+ * default implementation does nothing; the OTTF console overrides it.
+ */
+void test_status_flush_console(void);
+
 #endif  // OPENTITAN_SW_DEVICE_LIB_TESTING_TEST_FRAMEWORK_STATUS_H_
@@ -107,6 +107,21 @@ C_ONLY(UJSON_SERDE_ENUM(FuzzyBool, fuzzy_bool, ENUM_FUZZY_BOOL, WITH_UNKNOWN));
     field(status, status_t)
 UJSON_SERDE_STRUCT(Misc, misc_t, STRUCT_MISC);
 
+/////////////////////////////////////////////////////////////////////////////
+// Byte arrays with the `ujson_blob_t` element type are sent as a base64
+// encoded string instead of a list of integers:
+//
+// typedef struct Blob {
+//     uint32_t len;
+//     ujson_blob_t data[12];
+// } blob_t;
+// status_t ujson_serialize_blob_t(ujson_t *context, const blob_t *self);
+// status_t ujson_deserialize_blob_t(ujson_t *context, blob_t *self);
+#define STRUCT_BLOB(field, string) \
+    field(len, uint32_t) \
+    field(data, ujson_blob_t, 12)
+UJSON_SERDE_STRUCT(Blob, blob_t, STRUCT_BLOB);
+
 #undef MODULE_ID
 
 // clang-format on
@@ -81,6 +81,13 @@ status_t roundtrip(const char *name) {
     ujson_crc32_reset(&uj);
     TRY(ujson_serialize_misc_t(&uj, &x));
     printf("\n%x", ujson_crc32_finish(&uj));
+  } else if (!strcmp(name, "blob")) {
+    blob_t x = {0};
+    TRY(ujson_deserialize_blob_t(&uj, &x));
+    TRY(check_crc32(&uj));
+    ujson_crc32_reset(&uj);
+    TRY(ujson_serialize_blob_t(&uj, &x));
+    printf("\n%x", ujson_crc32_finish(&uj));
   } else {
     return INVALID_ARGUMENT();
   }
@@ -213,4 +213,32 @@ TEST(Derive, FuzzyBoolDeserialize) {
   EXPECT_EQ(ujson_crc32_finish(&uj), 0xe301b3ec);
 }
 
+TEST(Derive, BlobSerialize) {
+  blob_t blob = {12, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}};
+  SourceSink ss;
+  ujson_t uj = ss.UJson();
+  EXPECT_TRUE(status_ok(ujson_serialize_blob_t(&uj, &blob)));
+  EXPECT_EQ(ss.Sink(), R"json({"len":12,"data":"AAECAwQFBgcICQoL"})json");
+}
+
+TEST(Derive, BlobDeserialize) {
+  blob_t expected = {12, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}};
+  blob_t blob{};
+  SourceSink ss(R"json({"len":12,"data":"AAECAwQFBgcICQoL"})json");
+  ujson_t uj = ss.UJson();
+  EXPECT_TRUE(status_ok(ujson_deserialize_blob_t(&uj, &blob)));
+  EXPECT_EQ(memcmp(&blob, &expected, sizeof(blob)), 0);
+
+  // Like other arrays, absent elements are not initialized.
+  blob_t short_expected = {3, {0, 1, 2}};
+  blob = {};
+  ss.Reset(R"json({"len":3,"data":"AAEC"})json");
+  EXPECT_TRUE(status_ok(ujson_deserialize_blob_t(&uj, &blob)));
+  EXPECT_EQ(memcmp(&blob, &short_expected, sizeof(blob)), 0);
+
+  // Too much data is an error.
+  ss.Reset(R"json({"len":13,"data":"AAECAwQFBgcICQoLDA=="})json");
+  EXPECT_EQ(status_err(ujson_deserialize_blob_t(&uj, &blob)), kOutOfRange);
+}
+
 }  // namespace
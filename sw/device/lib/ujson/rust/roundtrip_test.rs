@@ -165,4 +165,18 @@ mod test {
         assert_eq!(before, after);
         Ok(())
     }
+
+    #[test]
+    fn test_blob() -> Result<()> {
+        let before = example::Blob {
+            len: 12,
+            data: [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11].into(),
+        };
+        let json = serde_json::to_string(&before)?;
+        assert_eq!(json, r#"{"len":12,"data":"AAECAwQFBgcICQoL"}"#);
+        let after = roundtrip("blob", &json, true)?;
+        let after = serde_json::from_str::<example::Blob>(&after)?;
+        assert_eq!(before, after);
+        Ok(())
+    }
 }
@@ -231,6 +231,57 @@ status_t ujson_deserialize_bool(ujson_t *uj, bool *value) {
   return OK_STATUS();
 }
 
+static const char kBase64Alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static int base64_value(char ch) {
+  if (ch >= 'A' && ch <= 'Z') {
+    return ch - 'A';
+  } else if (ch >= 'a' && ch <= 'z') {
+    return ch - 'a' + 26;
+  } else if (ch >= '0' && ch <= '9') {
+    return ch - '0' + 52;
+  } else if (ch == '+') {
+    return 62;
+  } else if (ch == '/') {
+    return 63;
+  }
+  return -1;
+}
+
+status_t ujson_deserialize_blob(ujson_t *uj, uint8_t *buf, size_t len) {
+  size_t n = 0;
+  uint32_t acc = 0;
+  uint32_t bits = 0;
+  bool padding = false;
+  TRY(ujson_consume(uj, '"'));
+  while (true) {
+    char ch = (char)TRY(ujson_getc(uj));
+    if (ch == '"') {
+      break;
+    }
+    if (ch == '=') {
+      padding = true;
+      continue;
+    }
+    int value = base64_value(ch);
+    if (value < 0 || padding) {
+      return OUT_OF_RANGE();
+    }
+    acc = (acc << 6) | (uint32_t)value;
+    bits += 6;
+    if (bits >= 8) {
+      bits -= 8;
+      if (n >= len) {
+        return OUT_OF_RANGE();
+      }
+      buf[n++] = (uint8_t)(acc >> bits);
+      acc &= (1u << bits) - 1;
+    }
+  }
+  return OK_STATUS((int32_t)n);
+}
+
 status_t ujson_deserialize_uint64_t(ujson_t *uj, uint64_t *value) {
   return ujson_parse_integer(uj, (void *)value, sizeof(*value));
 }
@@ -350,6 +401,35 @@ static status_t ujson_serialize_integer32(ujson_t *uj, uint32_t value,
   return OK_STATUS();
 }
 
+status_t ujson_serialize_blob(ujson_t *uj, const uint8_t *buf, size_t len) {
+  // Encode into a staging buffer to limit the number of `putbuf` calls.
+  char out[64];
+  size_t n = 0;
+  TRY(ujson_putbuf(uj, "\"", 1));
+  for (size_t i = 0; i < len; i += 3) {
+    uint32_t value = (uint32_t)buf[i] << 16;
+    if (i + 1 < len) {
+      value |= (uint32_t)buf[i + 1] << 8;
+    }
+    if (i + 2 < len) {
+      value |= buf[i + 2];
+    }
+    out[n++] = kBase64Alphabet[(value >> 18) & 0x3f];
+    out[n++] = kBase64Alphabet[(value >> 12) & 0x3f];
+    out[n++] = i + 1 < len ? kBase64Alphabet[(value >> 6) & 0x3f] : '=';
+    out[n++] = i + 2 < len ? kBase64Alphabet[value & 0x3f] : '=';
+    if (n == sizeof(out)) {
+      TRY(ujson_putbuf(uj, out, n));
+      n = 0;
+    }
+  }
+  if (n > 0) {
+    TRY(ujson_putbuf(uj, out, n));
+  }
+  TRY(ujson_putbuf(uj, "\"", 1));
+  return OK_STATUS();
+}
+
 status_t ujson_serialize_bool(ujson_t *uj, const bool *value) {
   if (*value) {
     TRY(ujson_putbuf(uj, "true", 4));
@@ -29,6 +29,18 @@ typedef struct ujson {
   uint32_t crc32;
 } ujson_t;
 
+/**
+ * Element type of byte array fields that are sent as a base64 string.
+ *
+ * A `field(name, ujson_blob_t, size)` in a `UJSON_SERDE_STRUCT` declaration
+ * declares a `uint8_t name[size]` array like `field(name, uint8_t, size)`
+ * does, but the array is sent as a base64 encoded JSON string rather than a
+ * list of decimal integers. This is about four times shorter and much cheaper
+ * to parse, which matters for large test vectors. Blob fields must have
+ * exactly one dimension.
+ */
+typedef uint8_t ujson_blob_t;
+
 // clang-format off
 #define UJSON_INIT(context_, getc_, putbuf_, flushbuf_) \
   {                                                     \
@@ -202,6 +214,20 @@ status_t ujson_deserialize_bool(ujson_t *uj, bool *value);
  */
 status_t ujson_deserialize_status_t(ujson_t *uj, status_t *value);
 
+/**
+ * Deserialize a base64 encoded byte array.
+ *
+ * Consume whitespace until finding a double-quote, then decode base64 data
+ * until the next double-quote.
+ *
+ * @param uj A ujson IO context.
+ * @param buf A buffer to write the decoded bytes into.
+ * @param len The length of the target buffer.
+ * @return The number of decoded bytes or an error. Input that decodes to more
+ * than `len` bytes is an error.
+ */
+status_t ujson_deserialize_blob(ujson_t *uj, uint8_t *buf, size_t len);
+
 /**
  * Serialize a string.
  *
@@ -228,6 +254,16 @@ status_t ujson_serialize_int32_t(ujson_t *uj, const int32_t *value);
 status_t ujson_serialize_int16_t(ujson_t *uj, const int16_t *value);
 status_t ujson_serialize_int8_t(ujson_t *uj, const int8_t *value);
 
+/**
+ * Serialize a byte array as a base64 encoded string.
+ *
+ * @param uj A ujson IO context.
+ * @param buf The bytes to serialize.
+ * @param len The length of the buffer.
+ * @return OK or an error.
+ */
+status_t ujson_serialize_blob(ujson_t *uj, const uint8_t *buf, size_t len);
+
 /**
  * Serialize a boolean.
  *
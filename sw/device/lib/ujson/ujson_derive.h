@@ -8,6 +8,11 @@
 // that do not have a symbolic name.
 #define RUST_ENUM_INTVALUE IntValue
 
+// Evaluates to 1 if `type_` is `ujson_blob_t` and 0 otherwise.
+#define ujson_is_blob(type_) \
+  OT_CHECK(OT_PRIMITIVE_CAT(ujson_blob_probe_, type_))
+#define ujson_blob_probe_ujson_blob_t OT_PROBE(~)
+
 #ifndef RUST_PREPROCESSOR_EMIT
 #include <stdint.h>
 
@@ -98,9 +103,14 @@
         ( /*then*/ \
             TRY(ujson_serialize_##type_(uj, &self->name_)); \
         , /*else*/ \
-            const type_ *p = (const type_*)self->name_; \
-            OT_EVAL(ujson_ser_loop( \
-                    TRY(ujson_serialize_##type_(uj, p++)), __VA_ARGS__)) \
+            OT_IIF(ujson_is_blob(type_)) \
+            ( /*then*/ \
+                TRY(ujson_serialize_blob(uj, self->name_, sizeof(self->name_))); \
+            , /*else*/ \
+                const type_ *p = (const type_*)self->name_; \
+                OT_EVAL(ujson_ser_loop( \
+                        TRY(ujson_serialize_##type_(uj, p++)), __VA_ARGS__)) \
+            ) /*endif*/ \
         ) /*endif*/ \
         if (--nfield) TRY(ujson_putbuf(uj, ",", 1)); \
     }
@@ -183,9 +193,14 @@
         ( /*then*/ \
             TRY(ujson_deserialize_##type_(uj, &self->name_)); \
         , /*else*/ \
-            type_ *p = (type_*)self->name_; \
-            OT_EVAL(ujson_de_loop(1, \
-                TRY(ujson_deserialize_##type_(uj, p++)), __VA_ARGS__)) \
+            OT_IIF(ujson_is_blob(type_)) \
+            ( /*then*/ \
+                TRY(ujson_deserialize_blob(uj, self->name_, sizeof(self->name_))); \
+            , /*else*/ \
+                type_ *p = (type_*)self->name_; \
+                OT_EVAL(ujson_de_loop(1, \
+                    TRY(ujson_deserialize_##type_(uj, p++)), __VA_ARGS__)) \
+            ) /*endif*/ \
         ) /*endif*/ \
     }
 
@@ -49,12 +49,20 @@ use opentitanlib::test_utils::status::status_t;
         arrayvec::ArrayVec<OT_OBSTRUCT(ujson_struct_field_array_indirect)()(t_, __VA_ARGS__), sz_> \
     ) /*endif*/
 
+// Blob fields are `ArrayVec<u8, N>` like `uint8_t` arrays, but use the base64
+// representation of the C side.
 #define ujson_struct_field(name_, type_, ...) \
-    pub OT_IIF(OT_NOT(OT_VA_ARGS_COUNT(dummy, ##__VA_ARGS__))) \
+    OT_IIF(ujson_is_blob(type_)) \
     ( /*then*/ \
-        name_: type_ \
+        rust_attr[serde(with = "opentitanlib::util::serde::base64_arrayvec")] \
+        pub name_: arrayvec::ArrayVec<OT_EXPAND(u8, __VA_ARGS__)> \
     , /*else*/ \
-        name_: OT_EVAL(ujson_struct_field_array(type_, __VA_ARGS__)) \
+        pub OT_IIF(OT_NOT(OT_VA_ARGS_COUNT(dummy, ##__VA_ARGS__))) \
+        ( /*then*/ \
+            name_: type_ \
+        , /*else*/ \
+            name_: OT_EVAL(ujson_struct_field_array(type_, __VA_ARGS__)) \
+        ) /*endif*/ \
     ) /*endif*/,
 
 #define ujson_struct_string(name_, size_, ...) \
@@ -209,6 +209,63 @@ TEST(UJson, SerializeBool) {
   EXPECT_EQ(ss.Sink(), R"json(false)json");
 }
 
+TEST(UJson, SerializeBlob) {
+  SourceSink ss;
+  ujson uj = ss.UJson();
+  const uint8_t data[] = {'f', 'o', 'o', 'b', 'a', 'r'};
+
+  EXPECT_TRUE(status_ok(ujson_serialize_blob(&uj, data, 0)));
+  EXPECT_EQ(ss.Sink(), R"json("")json");
+
+  ss.Reset();
+  EXPECT_TRUE(status_ok(ujson_serialize_blob(&uj, data, 1)));
+  EXPECT_EQ(ss.Sink(), R"json("Zg==")json");
+
+  ss.Reset();
+  EXPECT_TRUE(status_ok(ujson_serialize_blob(&uj, data, 2)));
+  EXPECT_EQ(ss.Sink(), R"json("Zm8=")json");
+
+  ss.Reset();
+  EXPECT_TRUE(status_ok(ujson_serialize_blob(&uj, data, 6)));
+  EXPECT_EQ(ss.Sink(), R"json("Zm9vYmFy")json");
+
+  // Longer than the internal staging buffer.
+  uint8_t zeros[100] = {0};
+  ss.Reset();
+  EXPECT_TRUE(status_ok(ujson_serialize_blob(&uj, zeros, sizeof(zeros))));
+  EXPECT_EQ(ss.Sink(), "\"" + std::string(132, 'A') + "AA==\"");
+}
+
+TEST(UJson, DeserializeBlob) {
+  SourceSink ss(R"json(  "Zm9vYmFy")json");
+  ujson uj = ss.UJson();
+  uint8_t buf[8] = {0};
+  status_t s;
+
+  s = ujson_deserialize_blob(&uj, buf, sizeof(buf));
+  EXPECT_TRUE(status_ok(s));
+  EXPECT_EQ(s.value, 6);
+  EXPECT_EQ(std::string(reinterpret_cast<char *>(buf)), "foobar");
+
+  ss.Reset(R"json("Zm8=")json");
+  s = ujson_deserialize_blob(&uj, buf, sizeof(buf));
+  EXPECT_TRUE(status_ok(s));
+  EXPECT_EQ(s.value, 2);
+
+  // More data than fits the buffer.
+  ss.Reset(R"json("Zm9vYmFy")json");
+  s = ujson_deserialize_blob(&uj, buf, 4);
+  EXPECT_EQ(status_err(s), kOutOfRange);
+
+  // Invalid characters and data after padding.
+  ss.Reset(R"json("Zm9v!")json");
+  EXPECT_EQ(status_err(ujson_deserialize_blob(&uj, buf, sizeof(buf))),
+            kOutOfRange);
+  ss.Reset(R"json("Zg==Zg==")json");
+  EXPECT_EQ(status_err(ujson_deserialize_blob(&uj, buf, sizeof(buf))),
+            kOutOfRange);
+}
+
 #define INT(type_, str_, value_)                   \
   do {                                             \
     SourceSink ss;                                 \
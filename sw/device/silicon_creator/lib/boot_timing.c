@@ -0,0 +1,37 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/silicon_creator/lib/boot_timing.h"
+
+#include "sw/device/lib/base/macros.h"
+#include "sw/device/silicon_creator/lib/drivers/ibex.h"
+
+void boot_timing_init(boot_timing_t *boot_timing) {
+  boot_timing->identifier = kBootTimingIdentifier;
+  boot_timing->count = kBootTimingStageCount;
+  for (size_t i = 0; i < ARRAYSIZE(boot_timing->cycles); ++i) {
+    boot_timing->cycles[i] = 0;
+  }
+}
+
+void boot_timing_check_or_init(boot_timing_t *boot_timing) {
+  if (boot_timing->identifier == kBootTimingIdentifier &&
+      boot_timing->count == kBootTimingStageCount) {
+    return;
+  }
+  boot_timing_init(boot_timing);
+}
+
+void boot_timing_record_cycles(boot_timing_t *boot_timing,
+                               boot_timing_stage_t stage, uint32_t cycles) {
+  // The ledger is informational only, so out-of-range stages are ignored
+  // rather than treated as a fault.
+  if (stage < kBootTimingStageCount) {
+    boot_timing->cycles[stage] = cycles;
+  }
+}
+
+void boot_timing_record(boot_timing_t *boot_timing, boot_timing_stage_t stage) {
+  boot_timing_record_cycles(boot_timing, stage, ibex_mcycle32());
+}
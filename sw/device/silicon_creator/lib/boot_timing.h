@@ -0,0 +1,123 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OPENTITAN_SW_DEVICE_SILICON_CREATOR_LIB_BOOT_TIMING_H_
+#define OPENTITAN_SW_DEVICE_SILICON_CREATOR_LIB_BOOT_TIMING_H_
+
+#include <stdint.h>
+
+#include "sw/device/lib/base/macros.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Boot stages recorded in the boot timing ledger.
+ *
+ * Each value is the index of the ledger entry that holds the cycle count at
+ * which the stage completed. The values are part of the retention SRAM layout
+ * and must not be reordered.
+ */
+typedef enum boot_timing_stage {
+  /** ROM: entry into `rom_init`. */
+  kBootTimingStageRomStart = 0,
+  /** ROM: flash controller initialized. */
+  kBootTimingStageRomFlashCtrlInit = 1,
+  /** ROM: `rom_init` done (OTP reads, AST/sensor setup, RET-RAM init). */
+  kBootTimingStageRomInit = 2,
+  /** ROM: boot data read from flash. */
+  kBootTimingStageRomBootDataRead = 3,
+  /** ROM: ROM_EXT manifests ordered by the boot policy. */
+  kBootTimingStageRomBootPolicy = 4,
+  /** ROM: ROM_EXT manifest checked and signature verified. */
+  kBootTimingStageRomVerify = 5,
+  /** ROM: OTP measurement and keymgr bindings done. */
+  kBootTimingStageRomKeymgr = 6,
+  /** ROM: about to jump to the ROM_EXT. */
+  kBootTimingStageRomHandoff = 7,
+  /** ROM_EXT: entry into `rom_ext_start`. */
+  kBootTimingStageRomExtStart = 8,
+  /** ROM_EXT: `rom_ext_init` and DICE chain initialization done. */
+  kBootTimingStageRomExtInit = 9,
+  /** ROM_EXT: ownership initialization and boot services done. */
+  kBootTimingStageRomExtOwnership = 10,
+  /** ROM_EXT: owner firmware manifest checked and signature verified. */
+  kBootTimingStageRomExtVerify = 11,
+  /** ROM_EXT: owner attestation keys and certificates generated. */
+  kBootTimingStageRomExtDice = 12,
+  /** ROM_EXT: about to jump to the owner firmware. */
+  kBootTimingStageRomExtHandoff = 13,
+  /** Number of recorded stages. */
+  kBootTimingStageCount = 14,
+} boot_timing_stage_t;
+
+/**
+ * The boot timing ledger records when each boot stage completed.
+ *
+ * Entries hold the low 32 bits of `mcycle`, which counts from reset, so the
+ * difference between two entries is the time spent in between. An entry of
+ * zero means the stage was not reached on this boot.
+ */
+typedef struct boot_timing {
+  /** Identifier (`BTIM`). */
+  uint32_t identifier;
+  /** Number of valid entries in `cycles`. */
+  uint32_t count;
+  /** Cycle counts indexed by `boot_timing_stage_t`. */
+  uint32_t cycles[kBootTimingStageCount];
+} boot_timing_t;
+
+OT_ASSERT_MEMBER_OFFSET(boot_timing_t, identifier, 0);
+OT_ASSERT_MEMBER_OFFSET(boot_timing_t, count, 4);
+OT_ASSERT_MEMBER_OFFSET(boot_timing_t, cycles, 8);
+OT_ASSERT_SIZE(boot_timing_t, 64);
+
+enum {
+  /**
+   * Boot timing identifier value (ASCII "BTIM").
+   */
+  kBootTimingIdentifier = 0x4d495442,
+};
+
+/**
+ * Clears the boot timing ledger.
+ *
+ * @param boot_timing A buffer that holds the boot timing ledger.
+ */
+void boot_timing_init(boot_timing_t *boot_timing);
+
+/**
+ * Clears the boot timing ledger unless it has already been initialized.
+ *
+ * Used by later boot stages, which may run after a ROM that does not maintain
+ * the ledger.
+ *
+ * @param boot_timing A buffer that holds the boot timing ledger.
+ */
+void boot_timing_check_or_init(boot_timing_t *boot_timing);
+
+/**
+ * Records the current cycle count as the completion time of `stage`.
+ *
+ * @param boot_timing A buffer that holds the boot timing ledger.
+ * @param stage The stage that just completed.
+ */
+void boot_timing_record(boot_timing_t *boot_timing, boot_timing_stage_t stage);
+
+/**
+ * Records a previously sampled cycle count for `stage`.
+ *
+ * @param boot_timing A buffer that holds the boot timing ledger.
+ * @param stage The stage the sample belongs to.
+ * @param cycles The sampled cycle count.
+ */
+void boot_timing_record_cycles(boot_timing_t *boot_timing,
+                               boot_timing_stage_t stage, uint32_t cycles);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // OPENTITAN_SW_DEVICE_SILICON_CREATOR_LIB_BOOT_TIMING_H_
@@ -0,0 +1,55 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/silicon_creator/lib/boot_timing.h"
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+namespace boot_timing_unittest {
+namespace {
+
+class BootTimingTest : public testing::Test {
+ protected:
+  void SetUp() override { std::memset(&ledger_, 0xa5, sizeof(ledger_)); }
+
+  boot_timing_t ledger_;
+};
+
+TEST_F(BootTimingTest, Init) {
+  boot_timing_init(&ledger_);
+  EXPECT_EQ(ledger_.identifier, kBootTimingIdentifier);
+  EXPECT_EQ(ledger_.count, kBootTimingStageCount);
+  for (uint32_t cycles : ledger_.cycles) {
+    EXPECT_EQ(cycles, 0);
+  }
+}
+
+TEST_F(BootTimingTest, CheckOrInitKeepsValidLedger) {
+  boot_timing_init(&ledger_);
+  boot_timing_record_cycles(&ledger_, kBootTimingStageRomInit, 1234);
+  boot_timing_check_or_init(&ledger_);
+  EXPECT_EQ(ledger_.cycles[kBootTimingStageRomInit], 1234);
+}
+
+TEST_F(BootTimingTest, CheckOrInitClearsInvalidLedger) {
+  boot_timing_check_or_init(&ledger_);
+  EXPECT_EQ(ledger_.identifier, kBootTimingIdentifier);
+  EXPECT_EQ(ledger_.cycles[kBootTimingStageRomStart], 0);
+}
+
+TEST_F(BootTimingTest, RecordCycles) {
+  boot_timing_init(&ledger_);
+  boot_timing_record_cycles(&ledger_, kBootTimingStageRomExtHandoff, 42);
+  EXPECT_EQ(ledger_.cycles[kBootTimingStageRomExtHandoff], 42);
+
+  // Out-of-range stages are ignored.
+  boot_timing_t before = ledger_;
+  boot_timing_record_cycles(&ledger_, kBootTimingStageCount, 7);
+  EXPECT_EQ(std::memcmp(&before, &ledger_, sizeof(ledger_)), 0);
+}
+
+}  // namespace
+}  // namespace boot_timing_unittest
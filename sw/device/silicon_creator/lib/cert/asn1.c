@@ -71,7 +71,30 @@ void asn1_push_bytes(asn1_state_t *state, const uint8_t *bytes, size_t size) {
   state->offset += size;
 }
 
+/**
+ * Return the number of length octets in the minimal encoding of `length`.
+ *
+ * Lengths larger than 0xffff are not supported and must be rejected by the
+ * caller.
+ *
+ * @param length Length of the contents of a tag.
+ */
+static size_t asn1_length_size(size_t length) {
+  if (length <= 0x7f) {
+    return 1;
+  } else if (length <= 0xff) {
+    return 2;
+  }
+  return 3;
+}
+
 void asn1_start_tag(asn1_state_t *state, asn1_tag_t *new_tag, uint8_t id) {
+  asn1_start_tag_hint(state, new_tag, id, 0);
+}
+
+void asn1_start_tag_hint(asn1_state_t *state, asn1_tag_t *new_tag, uint8_t id,
+                         size_t size_hint) {
+  static const uint8_t kZeroLength[3] = {0};
   new_tag->state = NULL;
   RETURN_IF_ASN1_ERROR(state);
 
@@ -79,45 +102,34 @@ void asn1_start_tag(asn1_state_t *state, asn1_tag_t *new_tag, uint8_t id) {
   asn1_push_byte(state, id);
   RETURN_IF_ASN1_ERROR(state);
   new_tag->len_offset = state->offset;
-  // We do not yet known how many bytes we need to encode the length. For now
-  // reserve one byte which is the minimum. This is then fixed in
-  // asn1_finish_tag by moving the data if necessary.
-
-  asn1_push_byte(state, 0);
+  // Reserve the length octets for the hinted size. If the hint turns out to be
+  // wrong, this is fixed in asn1_finish_tag by moving the data.
+  size_t len_size = asn1_length_size(size_hint);
+  asn1_push_bytes(state, kZeroLength, len_size);
   RETURN_IF_ASN1_ERROR(state);
-  new_tag->len_size = 1;
+  new_tag->len_size = len_size;
 }
 
 void asn1_finish_tag(asn1_tag_t *tag) {
   if (tag->state == NULL)
     return;
   RETURN_IF_ASN1_ERROR(tag->state);
-  // Sanity check: asn1_start_tag should have output one byte.
-  if (tag->len_size != 1) {
+  // Sanity check: asn1_start_tag_hint should have output one to three bytes.
+  if (tag->len_size == 0 || tag->len_size > 3) {
     RAISE_ASN1_ERROR(tag->state, kErrorAsn1Internal);
   }
   // Compute actually used length.
   size_t length = tag->state->offset - tag->len_offset - tag->len_size;
-  // Compute the size of the minimal encoding.
-  size_t final_len_size;
-  if (length <= 0x7f) {
-    // We only need one byte to hold the length.
-    final_len_size = 1;
-  } else if (length <= 0xff) {
-    // We need two bytes to hold the length: we need to move the data before
-    // we can write the second byte.
-    final_len_size = 2;
-  } else if (length <= 0xffff) {
-    // We need three bytes to hold the length: we need to move the data before
-    // we can write the second and third bytes.
-    final_len_size = 3;
-  } else {
+  if (length > 0xffff) {
     // Length too large.
     RAISE_ASN1_ERROR(tag->state, kErrorAsn1Internal);
   }
-  // If the final length uses more bytes than we initially allocated, we
-  // need to shift all the tag data backwards.
-  if (tag->len_size != final_len_size) {
+  // Compute the size of the minimal encoding.
+  size_t final_len_size = asn1_length_size(length);
+  // If the final length uses a different number of bytes than we initially
+  // allocated, we need to shift all the tag data.
+  uint8_t *data = tag->state->buffer + tag->len_offset;
+  if (final_len_size > tag->len_size) {
     // Make sure that the data actually fits into the buffer.
     size_t new_buffer_size =
         tag->state->offset + final_len_size - tag->len_size;
@@ -126,26 +138,28 @@ void asn1_finish_tag(asn1_tag_t *tag) {
     }
     // Copy backwards.
     for (size_t i = 0; i < length; i++) {
-      tag->state->buffer[tag->len_offset + final_len_size + length - 1 - i] =
-          tag->state->buffer[tag->len_offset + tag->len_size + length - 1 - i];
+      data[final_len_size + length - 1 - i] =
+          data[tag->len_size + length - 1 - i];
+    }
+  } else if (final_len_size < tag->len_size) {
+    // Copy forwards.
+    for (size_t i = 0; i < length; i++) {
+      data[final_len_size + i] = data[tag->len_size + i];
     }
   }
   // Write the length in the buffer.
-  if (length <= 0x7f) {
-    tag->state->buffer[tag->len_offset] = (uint8_t)length;
-  } else if (length <= 0xff) {
-    tag->state->buffer[tag->len_offset + 0] = 0x81;
-    tag->state->buffer[tag->len_offset + 1] = (uint8_t)length;
-  } else if (length <= 0xffff) {
-    tag->state->buffer[tag->len_offset + 0] = 0x82;
-    tag->state->buffer[tag->len_offset + 1] = (uint8_t)(length >> 8);
-    tag->state->buffer[tag->len_offset + 2] = (uint8_t)(length & 0xff);
+  if (final_len_size == 1) {
+    data[0] = (uint8_t)length;
+  } else if (final_len_size == 2) {
+    data[0] = 0x81;
+    data[1] = (uint8_t)length;
   } else {
-    // Length too large.
-    RAISE_ASN1_ERROR(tag->state, kErrorAsn1Internal);
+    data[0] = 0x82;
+    data[1] = (uint8_t)(length >> 8);
+    data[2] = (uint8_t)(length & 0xff);
   }
   // Fix up state offset.
-  tag->state->offset += final_len_size - tag->len_size;
+  tag->state->offset = tag->len_offset + final_len_size + length;
   // Hardening: clear out the tag structure to prevent accidental reuse.
   tag->state = NULL;
   tag->len_offset = 0;
@@ -162,12 +162,34 @@ typedef enum asn1_tag_number {
  */
 void asn1_start_tag(asn1_state_t *state, asn1_tag_t *new_tag, uint8_t id);
 
+/**
+ * Start an ASN1 tag with a hint for the size of its contents.
+ *
+ * The length octets are reserved for a content of `size_hint` bytes. When the
+ * actual content needs the same number of length octets, `asn1_finish_tag`
+ * writes the length in place instead of moving the content. `asn1_start_tag`
+ * is equivalent to a hint of zero, which is only exact for contents of up to
+ * 127 bytes.
+ *
+ * Note: This function tracks its error in the asn1 state, and the error will
+ * be returned by `asn1_finish` in the end. This function will be no-op when
+ * the state has an active error.
+ *
+ * @param state Pointer to the state initialized by asn1_start.
+ * @param[out] new_tag Pointer to a user-allocated tag to be initialized.
+ * @param id Identifier byte of the tag (see ASN1_CLASS_*, ASN1_FORM_* and
+ * ASN1_TAG_*).
+ * @param size_hint Expected size of the contents of the tag in bytes.
+ */
+void asn1_start_tag_hint(asn1_state_t *state, asn1_tag_t *new_tag, uint8_t id,
+                         size_t size_hint);
+
 /**
  * Finish an ASN1 tag.
  *
- * If size hint provided to asn1_start_tag does not match the actual size
- * of the data, this function will fix it up, potentially at the cost of moving
- * bytes within the buffer.
+ * If the size hint provided to asn1_start_tag_hint does not match the actual
+ * size of the data, this function will fix it up, potentially at the cost of
+ * moving bytes within the buffer.
  *
  * Note: the `tag` will be cleared out after this call.
  *
@@ -56,21 +56,24 @@ void pwrmgr_cdc_sync(uint32_t n) {
   uint32_t cpu_cycle_timeout =
       (uint32_t)kClockFreqCpuHz / (uint32_t)kClockFreqAonHz * 5;
 
+  // Timeouts are measured relative to a start value rather than by zeroing
+  // `mcycle`, which is also used to timestamp the boot stages.
+  //
   // Ensure the bit is clear before requesting another sync.
-  ibex_mcycle_zero();
+  uint32_t start = ibex_mcycle32();
   while (abs_mmio_read32(pwrmgr_base() + PWRMGR_CFG_CDC_SYNC_REG_OFFSET)) {
-    if (ibex_mcycle32() > cpu_cycle_timeout) {
+    if (ibex_mcycle32() - start > cpu_cycle_timeout) {
       // If the sync bit isn't clear, we shouldn't set it again.  Abort.
       return;
     }
   }
   // Perform the sync procedure the requested number of times.
   while (n--) {
-    ibex_mcycle_zero();
+    start = ibex_mcycle32();
     abs_mmio_write32(pwrmgr_base() + PWRMGR_CFG_CDC_SYNC_REG_OFFSET,
                      kSyncConfig);
     while (abs_mmio_read32(pwrmgr_base() + PWRMGR_CFG_CDC_SYNC_REG_OFFSET)) {
-      if (ibex_mcycle32() > cpu_cycle_timeout)
+      if (ibex_mcycle32() - start > cpu_cycle_timeout)
         // If the sync bit isn't clear, we shouldn't set it again.  Abort.
         return;
     }
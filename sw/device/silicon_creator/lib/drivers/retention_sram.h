@@ -10,6 +10,7 @@
 #include "hw/top/dt/dt_sram_ctrl.h"
 #include "sw/device/lib/base/macros.h"
 #include "sw/device/silicon_creator/lib/boot_log.h"
+#include "sw/device/silicon_creator/lib/boot_timing.h"
 #include "sw/device/silicon_creator/lib/boot_svc/boot_svc_msg.h"
 #include "sw/device/silicon_creator/lib/error.h"
 
@@ -51,10 +52,17 @@ typedef struct retention_sram_creator {
    */
   uint32_t reserved[(2044 - (sizeof(uint32_t)          // reset_reason
                              + sizeof(boot_svc_msg_t)  // boot services message
+                             + sizeof(boot_timing_t)   // boot_timing
                              + sizeof(boot_log_t)      // boot_log
                              + sizeof(rom_error_t)     // last_shutdown_reason
                              )) /
                     sizeof(uint32_t)];
+  /**
+   * Boot timing ledger.
+   *
+   * Cycle counts at which the ROM and ROM_EXT boot stages completed.
+   */
+  boot_timing_t boot_timing;
   /**
    * Boot log area.
    *
@@ -73,6 +81,7 @@ typedef struct retention_sram_creator {
 OT_ASSERT_MEMBER_OFFSET(retention_sram_creator_t, reset_reasons, 0);
 OT_ASSERT_MEMBER_OFFSET(retention_sram_creator_t, boot_svc_msg, 4);
 OT_ASSERT_MEMBER_OFFSET(retention_sram_creator_t, reserved, 260);
+OT_ASSERT_MEMBER_OFFSET(retention_sram_creator_t, boot_timing, 1848);
 OT_ASSERT_MEMBER_OFFSET(retention_sram_creator_t, boot_log, 1912);
 OT_ASSERT_MEMBER_OFFSET(retention_sram_creator_t, last_shutdown_reason, 2040);
 OT_ASSERT_SIZE(boot_svc_msg_t, 256);
@@ -4,6 +4,7 @@
 
 #include "sw/device/silicon_creator/lib/otbn_boot_services.h"
 
+#include "sw/device/lib/base/hardened_memory.h"
 #include "sw/device/lib/base/memory.h"
 #include "sw/device/silicon_creator/lib/attestation.h"
 #include "sw/device/silicon_creator/lib/base/sec_mmio.h"
@@ -28,6 +29,9 @@ OTBN_DECLARE_SYMBOL_ADDR(boot, r);     // ECDSA signature component r.
 OTBN_DECLARE_SYMBOL_ADDR(boot, s);     // ECDSA signature component s.
 OTBN_DECLARE_SYMBOL_ADDR(boot, x_r);   // ECDSA verification result.
 OTBN_DECLARE_SYMBOL_ADDR(boot, ok);    // ECDSA verification status.
+OTBN_DECLARE_SYMBOL_ADDR(boot, batch_num);     // Number of batch entries.
+OTBN_DECLARE_SYMBOL_ADDR(boot, batch_next);    // Next batch entry.
+OTBN_DECLARE_SYMBOL_ADDR(boot, batch);         // ECDSA batch entries.
 OTBN_DECLARE_SYMBOL_ADDR(
     boot, attestation_additional_seed);  // Additional seed for ECDSA keygen.
 
@@ -40,6 +44,11 @@ static const sc_otbn_addr_t kOtbnVarBootR = OTBN_ADDR_T_INIT(boot, r);
 static const sc_otbn_addr_t kOtbnVarBootS = OTBN_ADDR_T_INIT(boot, s);
 static const sc_otbn_addr_t kOtbnVarBootXr = OTBN_ADDR_T_INIT(boot, x_r);
 static const sc_otbn_addr_t kOtbnVarBootOk = OTBN_ADDR_T_INIT(boot, ok);
+static const sc_otbn_addr_t kOtbnVarBootBatchNum =
+    OTBN_ADDR_T_INIT(boot, batch_num);
+static const sc_otbn_addr_t kOtbnVarBootBatchNext =
+    OTBN_ADDR_T_INIT(boot, batch_next);
+static const sc_otbn_addr_t kOtbnVarBootBatch = OTBN_ADDR_T_INIT(boot, batch);
 static const sc_otbn_addr_t kOtbnVarBootAttestationAdditionalSeed =
     OTBN_ADDR_T_INIT(boot, attestation_additional_seed);
 
@@ -72,6 +81,26 @@ enum {
    * Value taken from `boot.s`.
    */
   kOtbnBootModeAttestationKeySave = 0x64d,
+  /*
+   * Mode to run batched signature verification.
+   *
+   * Value taken from `boot.s`.
+   */
+  kOtbnBootModeSigverifyBatch = 0x176,
+  /*
+   * Offsets of the fields of a batch entry in bytes.
+   *
+   * Each field occupies one OTBN wide word; see `boot.s`.
+   */
+  kOtbnBootBatchMsgOffset = 0,
+  kOtbnBootBatchROffset = 32,
+  kOtbnBootBatchSOffset = 64,
+  kOtbnBootBatchXOffset = 96,
+  kOtbnBootBatchYOffset = 128,
+  /*
+   * Size of a batch entry in bytes.
+   */
+  kOtbnBootBatchEntryBytes = 160,
   /* Size of the OTBN attestation seed buffer in 32-bit words (rounding the
      attestation seed size up to the next OTBN wide word). */
   kOtbnAttestationSeedBufferWords =
@@ -316,3 +345,90 @@ rom_error_t otbn_boot_sigverify(const ecdsa_p256_public_key_t *key,
   return sc_otbn_dmem_read(kEcdsaP256SignatureComponentWords, kOtbnVarBootXr,
                            recovered_r);
 }
+
+rom_error_t otbn_boot_sigverify_batch(
+    const otbn_boot_sigverify_batch_entry_t *entries, size_t num_entries,
+    uint32_t *recovered_r) {
+  if (num_entries > kOtbnBootSigverifyBatchMaxEntries) {
+    return kErrorOtbnInvalidArgument;
+  }
+
+  // Write the mode.
+  uint32_t mode = kOtbnBootModeSigverifyBatch;
+  HARDENED_RETURN_IF_ERROR(
+      sc_otbn_dmem_write(kOtbnBootModeWords, &mode, kOtbnVarBootMode));
+
+  // Write the number of entries.
+  uint32_t num = num_entries;
+  HARDENED_RETURN_IF_ERROR(sc_otbn_dmem_write(1, &num, kOtbnVarBootBatchNum));
+
+  // Write the message digests, signatures and public keys.
+  for (size_t i = 0; i < num_entries; ++i) {
+    sc_otbn_addr_t entry = kOtbnVarBootBatch + i * kOtbnBootBatchEntryBytes;
+    HARDENED_RETURN_IF_ERROR(
+        sc_otbn_dmem_write(kHmacDigestNumWords, entries[i].digest->digest,
+                           entry + kOtbnBootBatchMsgOffset));
+    HARDENED_RETURN_IF_ERROR(
+        sc_otbn_dmem_write(kEcdsaP256SignatureComponentWords,
+                           entries[i].sig->r, entry + kOtbnBootBatchROffset));
+    HARDENED_RETURN_IF_ERROR(
+        sc_otbn_dmem_write(kEcdsaP256SignatureComponentWords,
+                           entries[i].sig->s, entry + kOtbnBootBatchSOffset));
+    HARDENED_RETURN_IF_ERROR(
+        sc_otbn_dmem_write(kEcdsaP256PublicKeyCoordWords, entries[i].key->x,
+                           entry + kOtbnBootBatchXOffset));
+    HARDENED_RETURN_IF_ERROR(
+        sc_otbn_dmem_write(kEcdsaP256PublicKeyCoordWords, entries[i].key->y,
+                           entry + kOtbnBootBatchYOffset));
+  }
+
+  // Run OTBN until all entries are processed. An entry that fails the basic
+  // checks ends the run early; the next run resumes with the following entry.
+  uint32_t next = 0;
+  while (launder32(next) < num) {
+    HARDENED_RETURN_IF_ERROR(
+        sc_otbn_dmem_write(1, &next, kOtbnVarBootBatchNext));
+
+    // Start the OTBN routine.
+    HARDENED_RETURN_IF_ERROR(sc_otbn_execute());
+    SEC_MMIO_WRITE_INCREMENT(kScOtbnSecMmioExecute);
+
+    // TODO(#20023): Check the instruction count register (see `mod_exp_otbn`).
+
+    uint32_t ok;
+    HARDENED_RETURN_IF_ERROR(sc_otbn_dmem_read(1, kOtbnVarBootOk, &ok));
+    HARDENED_RETURN_IF_ERROR(
+        sc_otbn_dmem_read(1, kOtbnVarBootBatchNext, &next));
+    if (launder32(ok) == kHardenedBoolTrue) {
+      HARDENED_CHECK_EQ(ok, kHardenedBoolTrue);
+      HARDENED_CHECK_EQ(next, num);
+      break;
+    }
+    if (next >= num) {
+      return kErrorOtbnExecutionFailed;
+    }
+    ++next;
+  }
+
+  // Read the recovered `r` values from DMEM. OTBN overwrites the digest of an
+  // entry with its `x_r` only after the entry passes the basic checks. A
+  // digest that is still in place (an entry that failed the checks, or a
+  // skipped store) is replaced by a value that never matches `r`, since the
+  // digest itself could be chosen to equal `r`.
+  for (size_t i = 0; i < num_entries; ++i) {
+    uint32_t *entry_r = recovered_r + i * kEcdsaP256SignatureComponentWords;
+    HARDENED_RETURN_IF_ERROR(sc_otbn_dmem_read(
+        kEcdsaP256SignatureComponentWords,
+        kOtbnVarBootBatch + i * kOtbnBootBatchEntryBytes +
+            kOtbnBootBatchMsgOffset,
+        entry_r));
+    hardened_bool_t stale = hardened_memeq(
+        entry_r, entries[i].digest->digest, kEcdsaP256SignatureComponentWords);
+    if (launder32(stale) != kHardenedBoolFalse) {
+      for (size_t j = 0; j < kEcdsaP256SignatureComponentWords; ++j) {
+        entry_r[j] = ~entries[i].sig->r[j];
+      }
+    }
+  }
+  return kErrorOk;
+}
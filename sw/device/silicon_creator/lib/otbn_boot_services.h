@@ -200,6 +200,57 @@ rom_error_t otbn_boot_sigverify(const ecdsa_p256_public_key_t *key,
                                 const hmac_digest_t *digest,
                                 uint32_t *recovered_r);
 
+enum {
+  /**
+   * Maximum number of signatures in a batch for `otbn_boot_sigverify_batch`.
+   */
+  kOtbnBootSigverifyBatchMaxEntries = 3,
+};
+
+/**
+ * A single (key, signature, digest) tuple for batched signature verification.
+ */
+typedef struct otbn_boot_sigverify_batch_entry {
+  /**
+   * An ECDSA-P256 public key.
+   */
+  const ecdsa_p256_public_key_t *key;
+  /**
+   * An ECDSA-P256 signature.
+   */
+  const ecdsa_p256_signature_t *sig;
+  /**
+   * Message digest to check against.
+   */
+  const hmac_digest_t *digest;
+} otbn_boot_sigverify_batch_entry_t;
+
+/**
+ * Computes several ECDSA-P256 signature verifications in one OTBN run.
+ *
+ * Like `otbn_boot_sigverify`, this returns the recovered `r` value of each
+ * signature; the caller must compare `recovered_r` for `entries[i]` with the
+ * `r` component of its signature to decide whether it is valid. Entries that
+ * fail the basic validity checks (e.g. a public key that is not on the curve)
+ * end the OTBN run early and get a recovered `r` that never matches their
+ * signature; the remaining entries are verified in a follow-up run without
+ * reloading the program.
+ *
+ * Expects the OTBN boot-services program to already be loaded; see
+ * `otbn_boot_app_load`.
+ *
+ * @param entries Signatures to verify.
+ * @param num_entries Number of entries, at most
+ *                    `kOtbnBootSigverifyBatchMaxEntries`.
+ * @param[out] recovered_r Buffer for the recovered `r` values, with
+ *                         `kEcdsaP256SignatureComponentWords` words per entry.
+ * @return The result of the operation.
+ */
+OT_WARN_UNUSED_RESULT
+rom_error_t otbn_boot_sigverify_batch(
+    const otbn_boot_sigverify_batch_entry_t *entries, size_t num_entries,
+    uint32_t *recovered_r);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
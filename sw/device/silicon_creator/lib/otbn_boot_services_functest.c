@@ -2,6 +2,7 @@
 // Licensed under the Apache License, Version 2.0, see LICENSE for details.
 // SPDX-License-Identifier: Apache-2.0
 
+#include "sw/device/lib/base/memory.h"
 #include "sw/device/lib/crypto/drivers/entropy.h"
 #include "sw/device/lib/dif/dif_keymgr.h"
 #include "sw/device/lib/dif/dif_kmac.h"
@@ -73,6 +74,39 @@ rom_error_t sigverify_test(void) {
   return kErrorOk;
 }
 
+rom_error_t sigverify_batch_test(void) {
+  // Hash the test message.
+  hmac_digest_t digest;
+  hmac_sha256(kTestMessage, kTestMessageLen, &digest);
+
+  // Public key that is not on the curve (fails the basic checks).
+  ecdsa_p256_public_key_t bad_key = kEcdsaKey;
+  bad_key.y[0] ^= 1;
+
+  // Signature that passes the basic checks but does not verify.
+  ecdsa_p256_signature_t bad_sig = kEcdsaSignature;
+  bad_sig.s[0] ^= 1;
+
+  otbn_boot_sigverify_batch_entry_t entries[] = {
+      {.key = &bad_key, .sig = &kEcdsaSignature, .digest = &digest},
+      {.key = &kEcdsaKey, .sig = &kEcdsaSignature, .digest = &digest},
+      {.key = &kEcdsaKey, .sig = &bad_sig, .digest = &digest},
+  };
+  uint32_t recovered_r[ARRAYSIZE(entries)][kEcdsaP256SignatureComponentWords];
+  RETURN_IF_ERROR(otbn_boot_sigverify_batch(entries, ARRAYSIZE(entries),
+                                            &recovered_r[0][0]));
+
+  // Only the recovered `r` value of the valid entry should be equal to the
+  // signature `r` value.
+  CHECK(memcmp(recovered_r[0], kEcdsaSignature.r, sizeof(recovered_r[0])) != 0,
+        "Unexpected match for a key that is not on the curve");
+  CHECK_ARRAYS_EQ(recovered_r[1], kEcdsaSignature.r,
+                  ARRAYSIZE(kEcdsaSignature.r));
+  CHECK(memcmp(recovered_r[2], bad_sig.r, sizeof(recovered_r[2])) != 0,
+        "Unexpected match for an invalid signature");
+  return kErrorOk;
+}
+
 rom_error_t attestation_keygen_test(void) {
   // Check that key generations with different seeds result in different keys.
   ecdsa_p256_public_key_t pk_uds;
@@ -250,6 +284,7 @@ bool test_main(void) {
   CHECK(otbn_boot_app_load() == kErrorOk);
 
   EXECUTE_TEST(result, sigverify_test);
+  EXECUTE_TEST(result, sigverify_batch_test);
   EXECUTE_TEST(result, attestation_keygen_test);
   EXECUTE_TEST(result, attestation_advance_and_endorse_test);
   EXECUTE_TEST(result, attestation_keygen_test);
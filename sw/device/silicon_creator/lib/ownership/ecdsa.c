@@ -66,3 +66,49 @@ hardened_bool_t ecdsa_verify_message(const ecdsa_p256_public_key_t *pubkey,
   hmac_sha256(message, message_len, &digest);
   return ecdsa_verify_digest(pubkey, signature, &digest);
 }
+
+hardened_bool_t ecdsa_verify_message_any(
+    const ecdsa_p256_public_key_t *const *pubkeys, size_t num_pubkeys,
+    const ecdsa_p256_signature_t *signature, const void *message,
+    size_t message_len) {
+  hmac_digest_t digest;
+  hmac_sha256(message, message_len, &digest);
+#if USE_OTBN == 1
+  otbn_boot_sigverify_batch_entry_t entries[kOtbnBootSigverifyBatchMaxEntries];
+  uint32_t rr[kOtbnBootSigverifyBatchMaxEntries]
+             [kEcdsaP256SignatureComponentWords];
+  for (size_t i = 0; i < num_pubkeys; i += ARRAYSIZE(entries)) {
+    size_t num_entries = num_pubkeys - i;
+    if (num_entries > ARRAYSIZE(entries)) {
+      num_entries = ARRAYSIZE(entries);
+    }
+    for (size_t j = 0; j < num_entries; ++j) {
+      entries[j].key = pubkeys[i + j];
+      entries[j].sig = signature;
+      entries[j].digest = &digest;
+    }
+    rom_error_t error =
+        otbn_boot_sigverify_batch(entries, num_entries, &rr[0][0]);
+    if (error != kErrorOk) {
+      return kHardenedBoolFalse;
+    }
+    for (size_t j = 0; j < num_entries; ++j) {
+      hardened_bool_t result =
+          hardened_memeq(signature->r, rr[j], ARRAYSIZE(rr[j]));
+      if (launder32(result) == kHardenedBoolTrue) {
+        HARDENED_CHECK_EQ(result, kHardenedBoolTrue);
+        return result;
+      }
+    }
+  }
+  return kHardenedBoolFalse;
+#elif USE_CRYPTOC == 1
+  for (size_t i = 0; i < num_pubkeys; ++i) {
+    if (ecdsa_verify_digest(pubkeys[i], signature, &digest) ==
+        kHardenedBoolTrue) {
+      return kHardenedBoolTrue;
+    }
+  }
+  return kHardenedBoolFalse;
+#endif
+}
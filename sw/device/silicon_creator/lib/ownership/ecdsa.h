@@ -51,6 +51,26 @@ hardened_bool_t ecdsa_verify_message(const ecdsa_p256_public_key_t *pubkey,
                                      const ecdsa_p256_signature_t *signature,
                                      const void *message, size_t message_len);
 
+/**
+ * Verifies an ECDSA P-256 signature against several public keys.
+ *
+ * The message is hashed once. With OTBN, the keys are verified in batches of
+ * up to `kOtbnBootSigverifyBatchMaxEntries`, stopping after the first batch
+ * that contains a matching key.
+ *
+ * @param pubkeys The public keys to try, in order.
+ * @param num_pubkeys The number of public keys.
+ * @param signature The signature expressed as 32-bit little
+ * endian words: (le(R) || le(S))
+ * @param message The message to verify.
+ * @param message_len The length of the message to verify.
+ * @return kHardenedBoolTrue if the signature is valid for any of the keys.
+ */
+hardened_bool_t ecdsa_verify_message_any(
+    const ecdsa_p256_public_key_t *const *pubkeys, size_t num_pubkeys,
+    const ecdsa_p256_signature_t *signature, const void *message,
+    size_t message_len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "sw/device/lib/base/hardened.h"
+#include "sw/device/lib/base/macros.h"
 #include "sw/device/lib/base/status.h"
 #include "sw/device/lib/runtime/log.h"
 #include "sw/device/lib/testing/entropy_testutils.h"
@@ -89,6 +90,35 @@ status_t ecdsa_verify_message_test(void) {
   return OK_STATUS();
 }
 
+// Tests that we can verify an ECDSA signature of a message against several
+// keys, including a key that fails the basic checks.
+status_t ecdsa_verify_message_any_test(void) {
+  owner_signature_t signature;
+  TRY(hexstr_decode(&signature.ecdsa, sizeof(signature.ecdsa),
+                    kGettysburgSignature));
+
+  // Public key that is not on the curve.
+  ecdsa_p256_public_key_t bad_key = kNoOwnerRecoveryKey.ecdsa;
+  bad_key.y[0] ^= 1;
+
+  const ecdsa_p256_public_key_t *pubkeys[] = {
+      &bad_key,
+      &bad_key,
+      &bad_key,
+      &kNoOwnerRecoveryKey.ecdsa,
+  };
+  hardened_bool_t result = ecdsa_verify_message_any(
+      pubkeys, ARRAYSIZE(pubkeys), &signature.ecdsa, kGettysburgPrelude,
+      sizeof(kGettysburgPrelude) - 1);
+  TRY_CHECK(result == kHardenedBoolTrue);
+
+  result = ecdsa_verify_message_any(pubkeys, ARRAYSIZE(pubkeys) - 1,
+                                    &signature.ecdsa, kGettysburgPrelude,
+                                    sizeof(kGettysburgPrelude) - 1);
+  TRY_CHECK(result == kHardenedBoolFalse);
+  return OK_STATUS();
+}
+
 OTTF_DEFINE_TEST_CONFIG();
 
 bool test_main(void) {
@@ -96,5 +126,6 @@ bool test_main(void) {
   status_t result = initialize();
   EXECUTE_TEST(result, ecdsa_verify_digest_test);
   EXECUTE_TEST(result, ecdsa_verify_message_test);
+  EXECUTE_TEST(result, ecdsa_verify_message_any_test);
   return status_ok(result);
 }
@@ -19,29 +19,23 @@ OT_WEAK const owner_key_t *const kNoOwnerRecoveryKey;
 hardened_bool_t ownership_key_validate(size_t page, ownership_key_t key,
                                        const owner_signature_t *signature,
                                        const void *message, size_t len) {
+  // Collect the candidate keys so that the message is hashed once and the
+  // signatures are verified in as few OTBN runs as possible.
+  const ecdsa_p256_public_key_t *pubkeys[4];
+  size_t num_pubkeys = 0;
   if ((key & kOwnershipKeyUnlock) == kOwnershipKeyUnlock) {
-    if (ecdsa_verify_message(&owner_page[page].unlock_key.ecdsa,
-                             &signature->ecdsa, message,
-                             len) == kHardenedBoolTrue) {
-      return kHardenedBoolTrue;
-    }
+    pubkeys[num_pubkeys++] = &owner_page[page].unlock_key.ecdsa;
   }
   if ((key & kOwnershipKeyActivate) == kOwnershipKeyActivate) {
-    if (ecdsa_verify_message(&owner_page[page].activate_key.ecdsa,
-                             &signature->ecdsa, message,
-                             len) == kHardenedBoolTrue) {
-      return kHardenedBoolTrue;
-    }
+    pubkeys[num_pubkeys++] = &owner_page[page].activate_key.ecdsa;
   }
   if (kNoOwnerRecoveryKey &&
       (key & kOwnershipKeyRecovery) == kOwnershipKeyRecovery) {
-    if (ecdsa_verify_message(&kNoOwnerRecoveryKey->ecdsa, &signature->ecdsa,
-                             message, len) == kHardenedBoolTrue) {
-      return kHardenedBoolTrue;
-    }
+    pubkeys[num_pubkeys++] = &kNoOwnerRecoveryKey->ecdsa;
   }
-  return ecdsa_verify_message(&owner_page[page].owner_key.ecdsa,
-                              &signature->ecdsa, message, len);
+  pubkeys[num_pubkeys++] = &owner_page[page].owner_key.ecdsa;
+  return ecdsa_verify_message_any(pubkeys, num_pubkeys, &signature->ecdsa,
+                                  message, len);
 }
 
 rom_error_t ownership_seal_init(void) {
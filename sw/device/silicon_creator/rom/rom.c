@@ -20,6 +20,7 @@
 #include "sw/device/silicon_creator/lib/base/static_critical_version.h"
 #include "sw/device/silicon_creator/lib/boot_data.h"
 #include "sw/device/silicon_creator/lib/boot_log.h"
+#include "sw/device/silicon_creator/lib/boot_timing.h"
 #include "sw/device/silicon_creator/lib/cfi.h"
 #include "sw/device/silicon_creator/lib/chip_info.h"
 #include "sw/device/silicon_creator/lib/drivers/alert.h"
@@ -152,6 +153,9 @@ static void rom_bootstrap_message(void) {
 OT_WARN_UNUSED_RESULT
 static rom_error_t rom_init(void) {
   CFI_FUNC_COUNTER_INCREMENT(rom_counters, kCfiRomInit, 1);
+  // The retention RAM may only be initialized further down, so keep the early
+  // timestamps in locals until the boot timing ledger can be written.
+  uint32_t start_cycles = ibex_mcycle32();
   sec_mmio_init();
   uint32_t reset_reasons = rstmgr_reason_get();
   reset_reason_check =
@@ -219,6 +223,7 @@ static rom_error_t rom_init(void) {
 
   flash_ctrl_init();
   SEC_MMIO_WRITE_INCREMENT(kFlashCtrlSecMmioInit);
+  uint32_t flash_ctrl_init_cycles = ibex_mcycle32();
   flash_ecc_exc_handler_en = otp_read32(
       OTP_CTRL_PARAM_OWNER_SW_CFG_ROM_FLASH_ECC_EXC_HANDLER_EN_OFFSET);
 
@@ -250,6 +255,14 @@ static rom_error_t rom_init(void) {
   boot_log->retention_ram_initialized =
       reset_reasons & reset_mask ? kHardenedBoolTrue : kHardenedBoolFalse;
 
+  // Initialize the boot timing ledger.
+  boot_timing_t *boot_timing = &retention_sram_get()->creator.boot_timing;
+  boot_timing_init(boot_timing);
+  boot_timing_record_cycles(boot_timing, kBootTimingStageRomStart,
+                            start_cycles);
+  boot_timing_record_cycles(boot_timing, kBootTimingStageRomFlashCtrlInit,
+                            flash_ctrl_init_cycles);
+
   // Always store the retention RAM version so the ROM_EXT can depend on its
   // accuracy even after scrambling.
   retention_sram_get()->version = kRetentionSramVersion4;
@@ -293,6 +306,7 @@ static rom_error_t rom_init(void) {
   sec_mmio_check_values(rnd_uint32());
   sec_mmio_check_counters(/*expected_check_count=*/1);
 
+  boot_timing_record(boot_timing, kBootTimingStageRomInit);
   CFI_FUNC_COUNTER_INCREMENT(rom_counters, kCfiRomInit, 2);
   return kErrorOk;
 }
@@ -568,6 +582,8 @@ static rom_error_t rom_boot(const manifest_t *manifest, uint32_t flash_exec) {
   sc_keymgr_creator_max_ver_set(manifest->max_key_version);
   SEC_MMIO_WRITE_INCREMENT(kScKeymgrSecMmioSwBindingSet +
                            kScKeymgrSecMmioCreatorMaxVerSet);
+  boot_timing_t *boot_timing = &retention_sram_get()->creator.boot_timing;
+  boot_timing_record(boot_timing, kBootTimingStageRomKeymgr);
 
   sec_mmio_check_counters(/*expected_check_count=*/2);
 
@@ -668,6 +684,8 @@ static rom_error_t rom_boot(const manifest_t *manifest, uint32_t flash_exec) {
   // In a normal build, this function inlines to nothing.
   stack_utilization_print();
 
+  boot_timing_record(boot_timing, kBootTimingStageRomHandoff);
+
   // (Potentially) Execute the immutable ROM_EXT section.
   uint32_t rom_ext_immutable_section_enabled =
       otp_read32(OTP_CTRL_PARAM_CREATOR_SW_CFG_IMMUTABLE_ROM_EXT_EN_OFFSET);
@@ -729,11 +747,15 @@ OT_WARN_UNUSED_RESULT
 static rom_error_t rom_try_boot(void) {
   CFI_FUNC_COUNTER_INCREMENT(rom_counters, kCfiRomTryBoot, 1);
 
+  boot_timing_t *boot_timing = &retention_sram_get()->creator.boot_timing;
+
   // Read boot data from flash
   HARDENED_RETURN_IF_ERROR(boot_data_read(lc_state, &boot_data));
+  boot_timing_record(boot_timing, kBootTimingStageRomBootDataRead);
 
   boot_policy_manifests_t manifests = boot_policy_manifests_get();
   uint32_t flash_exec = 0;
+  boot_timing_record(boot_timing, kBootTimingStageRomBootPolicy);
 
   CFI_FUNC_COUNTER_PREPCALL(rom_counters, kCfiRomTryBoot, 2, kCfiRomVerify);
   rom_error_t error = rom_verify(manifests.ordered[0], &flash_exec);
@@ -742,6 +764,7 @@ static rom_error_t rom_try_boot(void) {
   if (launder32(error) == kErrorOk) {
     HARDENED_CHECK_EQ(error, kErrorOk);
     CFI_FUNC_COUNTER_CHECK(rom_counters, kCfiRomVerify, 3);
+    boot_timing_record(boot_timing, kBootTimingStageRomVerify);
     CFI_FUNC_COUNTER_INIT(rom_counters, kCfiRomTryBoot);
     CFI_FUNC_COUNTER_PREPCALL(rom_counters, kCfiRomTryBoot, 1, kCfiRomBoot);
     HARDENED_RETURN_IF_ERROR(rom_boot(manifests.ordered[0], flash_exec));
@@ -752,6 +775,7 @@ static rom_error_t rom_try_boot(void) {
   HARDENED_RETURN_IF_ERROR(rom_verify(manifests.ordered[1], &flash_exec));
   CFI_FUNC_COUNTER_INCREMENT(rom_counters, kCfiRomTryBoot, 7);
   CFI_FUNC_COUNTER_CHECK(rom_counters, kCfiRomVerify, 3);
+  boot_timing_record(boot_timing, kBootTimingStageRomVerify);
 
   CFI_FUNC_COUNTER_PREPCALL(rom_counters, kCfiRomTryBoot, 8, kCfiRomBoot);
   HARDENED_RETURN_IF_ERROR(rom_boot(manifests.ordered[1], flash_exec));
@@ -119,10 +119,29 @@ status_t boot_log_print(boot_log_t *boot_log) {
   return OK_STATUS();
 }
 
+void boot_timing_print(const boot_timing_t *boot_timing) {
+  if (boot_timing->identifier != kBootTimingIdentifier) {
+    LOG_INFO("boot_timing not present");
+    return;
+  }
+  uint32_t prev = 0;
+  for (size_t i = 0; i < boot_timing->count && i < kBootTimingStageCount;
+       ++i) {
+    uint32_t cycles = boot_timing->cycles[i];
+    if (cycles == 0) {
+      continue;
+    }
+    LOG_INFO("boot_timing stage %u = %u cycles (+%u)", i, cycles,
+             cycles - prev);
+    prev = cycles;
+  }
+}
+
 bool test_main(void) {
   status_t sts = boot_log_print(&retention_sram_get()->creator.boot_log);
   if (status_err(sts)) {
     LOG_ERROR("boot_log_print: %r", sts);
   }
+  boot_timing_print(&retention_sram_get()->creator.boot_timing);
   return status_ok(sts);
 }
@@ -166,6 +166,9 @@ static void validate_mode(uint32_t mode, rescue_state_t *state,
       case kRescueModeBootLog:
         dbg_printf("ok: receive boot_log via xmodem-crc\r\n");
         break;
+      case kRescueModeBootTiming:
+        dbg_printf("ok: receive boot_timing via xmodem-crc\r\n");
+        break;
       case kRescueModeBootSvcRsp:
         dbg_printf("ok: receive boot_svc response via xmodem-crc\r\n");
         break;
@@ -224,6 +227,10 @@ static rom_error_t handle_send_modes(rescue_state_t *state,
       HARDENED_RETURN_IF_ERROR(xmodem_send(iohandle, &rr->creator.boot_log,
                                            sizeof(rr->creator.boot_log)));
       break;
+    case kRescueModeBootTiming:
+      HARDENED_RETURN_IF_ERROR(xmodem_send(iohandle, &rr->creator.boot_timing,
+                                           sizeof(rr->creator.boot_timing)));
+      break;
     case kRescueModeBootSvcRsp:
       HARDENED_RETURN_IF_ERROR(xmodem_send(iohandle, &rr->creator.boot_svc_msg,
                                            sizeof(rr->creator.boot_svc_msg)));
@@ -274,6 +281,7 @@ static rom_error_t handle_recv_modes(rescue_state_t *state,
   retention_sram_t *rr = retention_sram_get();
   switch (state->mode) {
     case kRescueModeBootLog:
+    case kRescueModeBootTiming:
     case kRescueModeBootSvcRsp:
     case kRescueModeOpenTitanID:
     case kRescueModeOwnerPage0:
@@ -24,6 +24,8 @@ typedef enum {
   kRescueModeBaud = 0x42415544,
   /** `BLOG` */
   kRescueModeBootLog = 0x424c4f47,
+  /** `BTIM` */
+  kRescueModeBootTiming = 0x4254494d,
   /** `BRSP` */
   kRescueModeBootSvcRsp = 0x42525350,
   /** `BREQ` */
@@ -18,6 +18,7 @@
 #include "sw/device/silicon_creator/lib/boot_svc/boot_svc_empty.h"
 #include "sw/device/silicon_creator/lib/boot_svc/boot_svc_header.h"
 #include "sw/device/silicon_creator/lib/boot_svc/boot_svc_msg.h"
+#include "sw/device/silicon_creator/lib/boot_timing.h"
 #include "sw/device/silicon_creator/lib/cert/dice_chain.h"
 #include "sw/device/silicon_creator/lib/dbg_print.h"
 #include "sw/device/silicon_creator/lib/drivers/ast.h"
@@ -411,6 +412,8 @@ static rom_error_t rom_ext_boot(boot_data_t *boot_data, boot_log_t *boot_log,
 
   // Write the DICE certs to flash if they have been updated.
   HARDENED_RETURN_IF_ERROR(dice_chain_flush_flash());
+  boot_timing_t *boot_timing = &retention_sram_get()->creator.boot_timing;
+  boot_timing_record(boot_timing, kBootTimingStageRomExtDice);
 
   // Remove write and erase access to the certificate pages before handing over
   // execution to the owner firmware (owner firmware can still read).
@@ -501,6 +504,7 @@ static rom_error_t rom_ext_boot(boot_data_t *boot_data, boot_log_t *boot_log,
                                    TOP_EARLGREY_OTP_CTRL_CORE_BASE_ADDR);
   // Jump to OWNER entry point.
   dbg_printf("entry: 0x%x\r\n", (unsigned int)entry_point);
+  boot_timing_record(boot_timing, kBootTimingStageRomExtHandoff);
   ((owner_stage_entry_point *)entry_point)();
 
   return kErrorRomExtBootFailed;
@@ -667,6 +671,8 @@ static rom_error_t rom_ext_try_next_stage(boot_data_t *boot_data,
     if (error != kErrorOk) {
       continue;
     }
+    boot_timing_record(&retention_sram_get()->creator.boot_timing,
+                       kBootTimingStageRomExtVerify);
 
     if (manifests.ordered[i] == rom_ext_boot_policy_manifest_a_get()) {
       boot_log->bl0_slot = kBootSlotA;
@@ -697,6 +703,10 @@ static rom_error_t rom_ext_try_next_stage(boot_data_t *boot_data,
 }
 
 static rom_error_t rom_ext_start(boot_data_t *boot_data, boot_log_t *boot_log) {
+  boot_timing_t *boot_timing = &retention_sram_get()->creator.boot_timing;
+  boot_timing_check_or_init(boot_timing);
+  boot_timing_record(boot_timing, kBootTimingStageRomExtStart);
+
   HARDENED_RETURN_IF_ERROR(rom_ext_init(boot_data));
   const manifest_t *self = rom_ext_manifest();
   dbg_printf("ROM_EXT:%u.%u\r\n", self->version_major, self->version_minor);
@@ -720,6 +730,7 @@ static rom_error_t rom_ext_start(boot_data_t *boot_data, boot_log_t *boot_log) {
 
   // Prepare dice chain builder for CDI_1.
   HARDENED_RETURN_IF_ERROR(dice_chain_init());
+  boot_timing_record(boot_timing, kBootTimingStageRomExtInit);
 
   // Initialize the boot_log in retention RAM.
   const chip_info_t *rom_chip_info = (const chip_info_t *)_rom_chip_info_start;
@@ -768,6 +779,7 @@ static rom_error_t rom_ext_start(boot_data_t *boot_data, boot_log_t *boot_log) {
   boot_log->rom_ext_min_sec_ver = boot_data->min_security_version_rom_ext;
   boot_log->bl0_min_sec_ver = boot_data->min_security_version_bl0;
   boot_log_digest_update(boot_log);
+  boot_timing_record(boot_timing, kBootTimingStageRomExtOwnership);
 
   if (uart_break_detect(kRescueDetectTime) == kHardenedBoolTrue) {
     dbg_printf("rescue: remember to clear break\r\n");
@@ -150,45 +150,80 @@ int set_nist_p384_params(cryptotest_ecdsa_coordinate_t uj_qx,
   return true;
 }
 
-status_t interpret_verification_result(ujson_t *uj,
-                                       hardened_bool_t *verification_result) {
-  cryptotest_ecdsa_verify_output_t uj_output;
-  switch (*verification_result) {
-    case kHardenedBoolFalse:
-      uj_output = kCryptotestEcdsaVerifyOutputFailure;
+/**
+ * Turns the outcome of an `otcrypto_ecdsa_*_verify` call into a verdict.
+ *
+ * Some ECDSA test vectors test invalid inputs. If cryptolib returns an invalid
+ * input code, the signature is simply reported as invalid. Any other error is
+ * returned to the caller.
+ */
+static status_t verification_verdict(otcrypto_status_t status,
+                                     hardened_bool_t verification_result,
+                                     bool *valid) {
+  switch (status.value) {
+    case kOtcryptoStatusValueOk:
       break;
+    case kOtcryptoStatusValueBadArgs:
+      *valid = false;
+      return OK_STATUS(0);
+    default:
+      LOG_ERROR(
+          "Unexpected status value returned from otcrypto_ecdsa_verify: "
+          "0x%x",
+          status.value);
+      return INTERNAL();
+  }
+  switch (verification_result) {
+    case kHardenedBoolFalse:
+      *valid = false;
+      return OK_STATUS(0);
     case kHardenedBoolTrue:
-      uj_output = kCryptotestEcdsaVerifyOutputSuccess;
-      break;
+      *valid = true;
+      return OK_STATUS(0);
     default:
       LOG_ERROR("Unexpected result value from otcrypto_ecdsa_verify: %d",
                 verification_result);
       return INTERNAL();
   }
-  RESP_OK(ujson_serialize_cryptotest_ecdsa_verify_output_t, uj, &uj_output);
-  return OK_STATUS(0);
 }
 
 status_t interpret_verify_status(ujson_t *uj, otcrypto_status_t status,
                                  hardened_bool_t *verification_result) {
-  cryptotest_ecdsa_verify_output_t uj_output;
-  switch (status.value) {
-    case kOtcryptoStatusValueOk:
-      return interpret_verification_result(uj, verification_result);
-    case kOtcryptoStatusValueBadArgs:
-      // Some ECDSA test vectors test invalid inputs. If cryptolib
-      // returns an invalid input code, we simply respond with
-      // "validation failed". Otherwise, we error out.
-      uj_output = kCryptotestEcdsaVerifyOutputFailure;
-      RESP_OK(ujson_serialize_cryptotest_ecdsa_verify_output_t, uj, &uj_output);
-      return OK_STATUS(0);
+  bool valid;
+  TRY(verification_verdict(status, *verification_result, &valid));
+  cryptotest_ecdsa_verify_output_t uj_output =
+      valid ? kCryptotestEcdsaVerifyOutputSuccess
+            : kCryptotestEcdsaVerifyOutputFailure;
+  RESP_OK(ujson_serialize_cryptotest_ecdsa_verify_output_t, uj, &uj_output);
+  return OK_STATUS(0);
+}
+
+static status_t ecdsa_hash_mode(cryptotest_ecdsa_hash_alg_t uj_hash_alg,
+                                otcrypto_hash_mode_t *mode) {
+  switch (uj_hash_alg) {
+    case kCryptotestEcdsaHashAlgSha256:
+      *mode = kOtcryptoHashModeSha256;
+      break;
+    case kCryptotestEcdsaHashAlgSha384:
+      *mode = kOtcryptoHashModeSha384;
+      break;
+    case kCryptotestEcdsaHashAlgSha512:
+      *mode = kOtcryptoHashModeSha512;
+      break;
+    case kCryptotestEcdsaHashAlgSha3_256:
+      *mode = kOtcryptoHashModeSha3_256;
+      break;
+    case kCryptotestEcdsaHashAlgSha3_384:
+      *mode = kOtcryptoHashModeSha3_384;
+      break;
+    case kCryptotestEcdsaHashAlgSha3_512:
+      *mode = kOtcryptoHashModeSha3_512;
+      break;
     default:
-      LOG_ERROR(
-          "Unexpected status value returned from otcrypto_ecdsa_verify: "
-          "0x%x",
-          status.value);
-      return INTERNAL();
+      LOG_ERROR("Unrecognized ECDSA hash mode: %d", uj_hash_alg);
+      return INVALID_ARGUMENT();
   }
+  return OK_STATUS(0);
 }
 
 status_t p256_sign(ujson_t *uj, cryptotest_ecdsa_private_key_t *uj_private_key,
@@ -263,6 +298,111 @@ status_t p384_sign(ujson_t *uj, cryptotest_ecdsa_private_key_t *uj_private_key,
   return OK_STATUS(0);
 }
 
+/**
+ * Verifies a batch of signatures under one public key.
+ *
+ * The key, curve and hash mode are received once, followed by the message
+ * digest and signature of each vector. Vectors are verified as they arrive and
+ * the verdicts are returned as a bitmap in a single response, so the host does
+ * not pay a console round trip per vector.
+ */
+static status_t handle_ecdsa_verify_batch(ujson_t *uj) {
+  cryptotest_ecdsa_hash_alg_t uj_hash_alg;
+  cryptotest_ecdsa_curve_t uj_curve;
+  cryptotest_ecdsa_coordinate_t uj_qx;
+  cryptotest_ecdsa_coordinate_t uj_qy;
+  cryptotest_ecdsa_batch_t uj_batch;
+  TRY(ujson_deserialize_cryptotest_ecdsa_hash_alg_t(uj, &uj_hash_alg));
+  TRY(ujson_deserialize_cryptotest_ecdsa_curve_t(uj, &uj_curve));
+  TRY(ujson_deserialize_cryptotest_ecdsa_coordinate_t(uj, &uj_qx));
+  TRY(ujson_deserialize_cryptotest_ecdsa_coordinate_t(uj, &uj_qy));
+  TRY(ujson_deserialize_cryptotest_ecdsa_batch_t(uj, &uj_batch));
+  if (uj_batch.count > ECDSA_CMD_MAX_BATCH_VECTORS) {
+    LOG_ERROR("Too many vectors in ECDSA batch (have = %d, max = %d)",
+              uj_batch.count, ECDSA_CMD_MAX_BATCH_VECTORS);
+    return INVALID_ARGUMENT();
+  }
+
+  otcrypto_hash_mode_t mode;
+  TRY(ecdsa_hash_mode(uj_hash_alg, &mode));
+
+  cryptotest_ecdsa_verify_batch_output_t uj_output;
+  memset(&uj_output, 0, sizeof(uj_output));
+  uj_output.count = uj_batch.count;
+
+  otcrypto_unblinded_key_t public_key;
+  size_t digest_len;
+  otcrypto_word32_buf_t signature_mut;
+  p256_ecdsa_signature_t signature_p256;
+  p384_ecdsa_signature_t signature_p384;
+  p256_point_t pub_p256;
+  p384_point_t pub_p384;
+  uint8_t message_buf[ECDSA_CMD_MAX_MESSAGE_BYTES];
+  for (size_t i = 0; i < uj_batch.count; ++i) {
+    cryptotest_ecdsa_message_t uj_message;
+    cryptotest_ecdsa_signature_t uj_signature;
+    TRY(ujson_deserialize_cryptotest_ecdsa_message_t(uj, &uj_message));
+    TRY(ujson_deserialize_cryptotest_ecdsa_signature_t(uj, &uj_signature));
+    if (uj_message.input_len > ECDSA_CMD_MAX_MESSAGE_BYTES) {
+      LOG_ERROR("Message digest too large (have = %d bytes, max = %d bytes)",
+                uj_message.input_len, ECDSA_CMD_MAX_MESSAGE_BYTES);
+      return INVALID_ARGUMENT();
+    }
+
+    int success;
+    switch (uj_curve) {
+      case kCryptotestEcdsaCurveP256:
+        success = set_nist_p256_params(uj_qx, uj_qy, uj_signature, &public_key,
+                                       &signature_p256, &pub_p256,
+                                       &signature_mut, &digest_len);
+        break;
+      case kCryptotestEcdsaCurveP384:
+        success = set_nist_p384_params(uj_qx, uj_qy, uj_signature, &public_key,
+                                       &signature_p384, &pub_p384,
+                                       &signature_mut, &digest_len);
+        break;
+      default:
+        LOG_ERROR("Unsupported ECC curve: %d", uj_curve);
+        return INVALID_ARGUMENT();
+    }
+    if (!success) {
+      return INVALID_ARGUMENT();
+    }
+    public_key.checksum = integrity_unblinded_checksum(&public_key);
+    otcrypto_const_word32_buf_t signature = {
+        .len = signature_mut.len,
+        .data = signature_mut.data,
+    };
+
+    memset(message_buf, 0, digest_len * sizeof(uint32_t));
+    memcpy(message_buf, uj_message.input, uj_message.input_len);
+    const otcrypto_hash_digest_t message_digest = {
+        .mode = mode,
+        .len = digest_len,
+        .data = (uint32_t *)message_buf,
+    };
+
+    hardened_bool_t verification_result = kHardenedBoolFalse;
+    otcrypto_status_t status;
+    if (uj_curve == kCryptotestEcdsaCurveP256) {
+      status = otcrypto_ecdsa_p256_verify(&public_key, message_digest,
+                                          signature, &verification_result);
+    } else {
+      status = otcrypto_ecdsa_p384_verify(&public_key, message_digest,
+                                          signature, &verification_result);
+    }
+    bool valid;
+    TRY(verification_verdict(status, verification_result, &valid));
+    if (valid) {
+      uj_output.passed[i / 8] |= (uint8_t)(1 << (i % 8));
+    }
+  }
+
+  RESP_OK(ujson_serialize_cryptotest_ecdsa_verify_batch_output_t, uj,
+          &uj_output);
+  return OK_STATUS(0);
+}
+
 status_t handle_ecdsa(ujson_t *uj) {
   // Declare ECDSA parameter ujson deserializer types
   cryptotest_ecdsa_operation_t uj_op;
@@ -276,6 +416,9 @@ status_t handle_ecdsa(ujson_t *uj) {
 
   // Deserialize ujson byte stream into ECDSA parameters
   TRY(ujson_deserialize_cryptotest_ecdsa_operation_t(uj, &uj_op));
+  if (uj_op == kCryptotestEcdsaOperationVerifyBatch) {
+    return handle_ecdsa_verify_batch(uj);
+  }
   TRY(ujson_deserialize_cryptotest_ecdsa_hash_alg_t(uj, &uj_hash_alg));
   TRY(ujson_deserialize_cryptotest_ecdsa_curve_t(uj, &uj_curve));
   TRY(ujson_deserialize_cryptotest_ecdsa_message_t(uj, &uj_message));
@@ -321,29 +464,7 @@ status_t handle_ecdsa(ujson_t *uj) {
   };
 
   otcrypto_hash_mode_t mode;
-  switch (uj_hash_alg) {
-    case kCryptotestEcdsaHashAlgSha256:
-      mode = kOtcryptoHashModeSha256;
-      break;
-    case kCryptotestEcdsaHashAlgSha384:
-      mode = kOtcryptoHashModeSha384;
-      break;
-    case kCryptotestEcdsaHashAlgSha512:
-      mode = kOtcryptoHashModeSha512;
-      break;
-    case kCryptotestEcdsaHashAlgSha3_256:
-      mode = kOtcryptoHashModeSha3_256;
-      break;
-    case kCryptotestEcdsaHashAlgSha3_384:
-      mode = kOtcryptoHashModeSha3_384;
-      break;
-    case kCryptotestEcdsaHashAlgSha3_512:
-      mode = kOtcryptoHashModeSha3_512;
-      break;
-    default:
-      LOG_ERROR("Unrecognized ECDSA hash mode: %d", uj_hash_alg);
-      return INVALID_ARGUMENT();
-  }
+  TRY(ecdsa_hash_mode(uj_hash_alg, &mode));
   uint8_t message_buf[ECDSA_CMD_MAX_MESSAGE_BYTES];
   memset(message_buf, 0, digest_len * sizeof(uint32_t));
   memcpy(message_buf, uj_message.input, uj_message.input_len);
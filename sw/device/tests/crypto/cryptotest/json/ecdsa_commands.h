@@ -15,6 +15,9 @@ extern "C" {
 #define ECDSA_CMD_MAX_SIGNATURE_SCALAR_BYTES 64
 #define ECDSA_CMD_MAX_COORDINATE_BYTES 64
 #define ECDSA_CMD_MAX_PRIVATE_KEY_SHARE_BYTES 64
+#define ECDSA_CMD_MAX_BATCH_VECTORS 256
+// One bit per vector in a `VerifyBatch` result.
+#define ECDSA_CMD_BATCH_RESULT_BYTES 32
 
 // clang-format off
 
@@ -27,9 +30,22 @@ extern "C" {
 // - qy (ECDSA_COORDINATE)
 // The device will then respond with:
 // - result (ECDSA_VERIFY_OUTPUT)
+//
+// Following a `VerifyBatch` Operation, the host is expected to send the following parameters, in order:
+// - hash_alg (ECDSA_HASH_ALG)
+// - curve (ECDSA_CURVE)
+// - qx (ECDSA_COORDINATE)
+// - qy (ECDSA_COORDINATE)
+// - batch (ECDSA_BATCH)
+// - `batch.count` times:
+//   - message_digest (ECDSA_MESSAGE)
+//   - signature (ECDSA_SIGNATURE)
+// The device verifies each vector as it arrives and, after the last one, responds with:
+// - results (ECDSA_VERIFY_BATCH_OUTPUT)
 #define ECDSA_OPERATION(_, value) \
     value(_, Sign) \
-    value(_, Verify)
+    value(_, Verify) \
+    value(_, VerifyBatch)
 UJSON_SERDE_ENUM(CryptotestEcdsaOperation, cryptotest_ecdsa_operation_t, ECDSA_OPERATION);
 
 #define ECDSA_HASH_ALG(_, value) \
@@ -76,6 +92,16 @@ UJSON_SERDE_STRUCT(CryptotestEcdsaPrivateKey, cryptotest_ecdsa_private_key_t, EC
     value(_, Failure)
 UJSON_SERDE_ENUM(CryptotestEcdsaVerifyOutput, cryptotest_ecdsa_verify_output_t, ECDSA_VERIFY_OUTPUT);
 
+#define ECDSA_BATCH(field, string) \
+    field(count, size_t)
+UJSON_SERDE_STRUCT(CryptotestEcdsaBatch, cryptotest_ecdsa_batch_t, ECDSA_BATCH);
+
+// Bit `i % 8` of `passed[i / 8]` is set if vector `i` of the batch verified.
+#define ECDSA_VERIFY_BATCH_OUTPUT(field, string) \
+    field(count, size_t) \
+    field(passed, ujson_blob_t, ECDSA_CMD_BATCH_RESULT_BYTES)
+UJSON_SERDE_STRUCT(CryptotestEcdsaVerifyBatchOutput, cryptotest_ecdsa_verify_batch_output_t, ECDSA_VERIFY_BATCH_OUTPUT);
+
 #undef MODULE_ID
 
 // clang-format on
@@ -27,12 +27,12 @@ UJSON_SERDE_ENUM(CryptotestSphincsPlusOperation, cryptotest_sphincsplus_operatio
 UJSON_SERDE_ENUM(CryptotestSphincsPlusHashAlg, cryptotest_sphincsplus_hash_alg_t, SPHINCSPLUS_HASH_ALG);
 
 #define SPHINCSPLUS_MESSAGE(field, string) \
-    field(message, uint8_t, SPHINCSPLUS_CMD_MAX_MESSAGE_BYTES) \
+    field(message, ujson_blob_t, SPHINCSPLUS_CMD_MAX_MESSAGE_BYTES) \
     field(message_len, size_t)
 UJSON_SERDE_STRUCT(CryptotestSphincsPlusMessage, cryptotest_sphincsplus_message_t, SPHINCSPLUS_MESSAGE);
 
 #define SPHINCSPLUS_SIGNATURE(field, string) \
-    field(signature, uint8_t, SPHINCSPLUS_CMD_MAX_SIGNATURE_BYTES) \
+    field(signature, ujson_blob_t, SPHINCSPLUS_CMD_MAX_SIGNATURE_BYTES) \
     field(signature_len, size_t)
 UJSON_SERDE_STRUCT(CryptotestSphincsPlusSignature, cryptotest_sphincsplus_signature_t, SPHINCSPLUS_SIGNATURE);
 
@@ -2,9 +2,11 @@
 // Licensed under the Apache License, Version 2.0, see LICENSE for details.
 // SPDX-License-Identifier: Apache-2.0
 
+#include "sw/device/lib/base/memory.h"
 #include "sw/device/lib/base/status.h"
 #include "sw/device/lib/crypto/drivers/entropy.h"
 #include "sw/device/lib/crypto/include/drbg.h"
+#include "sw/device/lib/runtime/ibex.h"
 #include "sw/device/lib/runtime/log.h"
 #include "sw/device/lib/testing/randomness_quality.h"
 #include "sw/device/lib/testing/test_framework/check.h"
@@ -79,6 +81,51 @@ static status_t random_test(void) {
       kRandomnessQualitySignificanceOnePercent);
 }
 
+static status_t pool_test(void) {
+  // Instantiate DRBG.
+  TRY(otcrypto_drbg_instantiate(/*perso_string=*/kEmptyBuffer));
+
+  // Generate many small values, as done for nonces and masks. Most of these
+  // requests should be served from the random pool.
+  enum {
+    kNumValues = 256,
+    kValueWords = 2,
+  };
+  uint32_t output_data[kNumValues * kValueWords];
+  uint64_t start_cycles = ibex_mcycle_read();
+  for (size_t i = 0; i < kNumValues; i++) {
+    otcrypto_word32_buf_t output = {
+        .data = &output_data[i * kValueWords],
+        .len = kValueWords,
+    };
+    TRY(otcrypto_drbg_generate(/*additional_input=*/kEmptyBuffer, output));
+  }
+  uint64_t num_cycles = ibex_mcycle_read() - start_cycles;
+  TRY_CHECK(num_cycles <= UINT32_MAX);
+  LOG_INFO("Generated %d %d-word values in %d cycles.", kNumValues,
+           kValueWords, (uint32_t)num_cycles);
+
+  // Consecutive values must never repeat.
+  for (size_t i = 1; i < kNumValues; i++) {
+    TRY_CHECK(memcmp(&output_data[(i - 1) * kValueWords],
+                     &output_data[i * kValueWords],
+                     kValueWords * sizeof(uint32_t)) != 0);
+  }
+
+  // Reseeding discards the pool; generation must keep working afterwards.
+  TRY(otcrypto_drbg_reseed(/*additional_input=*/kEmptyBuffer));
+  otcrypto_word32_buf_t output = {
+      .data = output_data,
+      .len = kValueWords,
+  };
+  TRY(otcrypto_drbg_generate(/*additional_input=*/kEmptyBuffer, output));
+
+  // Run a basic randomness-quality check on the output.
+  return randomness_quality_monobit_test(
+      (unsigned char *)output_data, sizeof(output_data),
+      kRandomnessQualitySignificanceOnePercent);
+}
+
 bool test_main(void) {
   status_t result = OK_STATUS();
 
@@ -88,5 +135,6 @@ bool test_main(void) {
 
   EXECUTE_TEST(result, kat_test);
   EXECUTE_TEST(result, random_test);
+  EXECUTE_TEST(result, pool_test);
   return status_ok(result);
 }
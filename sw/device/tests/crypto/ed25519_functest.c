@@ -0,0 +1,264 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/lib/base/memory.h"
+#include "sw/device/lib/crypto/drivers/otbn.h"
+#include "sw/device/lib/crypto/impl/integrity.h"
+#include "sw/device/lib/crypto/include/datatypes.h"
+#include "sw/device/lib/crypto/include/ed25519.h"
+#include "sw/device/lib/runtime/log.h"
+#include "sw/device/lib/testing/entropy_testutils.h"
+#include "sw/device/lib/testing/test_framework/check.h"
+#include "sw/device/lib/testing/test_framework/ottf_main.h"
+
+enum {
+  /* Number of bytes in an Ed25519 public key. */
+  kEd25519PublicKeyBytes = 256 / 8,
+  /* Number of bytes in an Ed25519 signature. */
+  kEd25519SignatureBytes = 512 / 8,
+};
+
+/**
+ * An Ed25519 signature verification test vector.
+ */
+typedef struct ed25519_verify_test_vector {
+  const char *comment;
+  uint8_t public_key[kEd25519PublicKeyBytes];
+  const uint8_t *msg;
+  size_t msg_len;
+  uint8_t signature[kEd25519SignatureBytes];
+  otcrypto_eddsa_sign_mode_t sign_mode;
+  otcrypto_eddsa_verify_mode_t verify_mode;
+  bool valid;
+} ed25519_verify_test_vector_t;
+
+static const uint8_t kMessageEmpty[] = {0};
+static const uint8_t kMessage72[] = {0x72};
+static const uint8_t kMessageAbc[] = {'a', 'b', 'c'};
+
+/**
+ * Test vectors.
+ *
+ * The last two vectors add the point of order 2 to R before hashing, so only
+ * the cofactored verification equation accepts the signature.
+ */
+static const ed25519_verify_test_vector_t kEd25519VerifyTests[] = {
+    {
+        .comment = "RFC 8032, section 7.1, test 1",
+        .public_key =
+            {
+                0xd7, 0x5a, 0x98, 0x01, 0x82, 0xb1, 0x0a, 0xb7,
+                0xd5, 0x4b, 0xfe, 0xd3, 0xc9, 0x64, 0x07, 0x3a,
+                0x0e, 0xe1, 0x72, 0xf3, 0xda, 0xa6, 0x23, 0x25,
+                0xaf, 0x02, 0x1a, 0x68, 0xf7, 0x07, 0x51, 0x1a,
+            },
+        .msg = kMessageEmpty,
+        .msg_len = 0,
+        .signature =
+            {
+                0xe5, 0x56, 0x43, 0x00, 0xc3, 0x60, 0xac, 0x72,
+                0x90, 0x86, 0xe2, 0xcc, 0x80, 0x6e, 0x82, 0x8a,
+                0x84, 0x87, 0x7f, 0x1e, 0xb8, 0xe5, 0xd9, 0x74,
+                0xd8, 0x73, 0xe0, 0x65, 0x22, 0x49, 0x01, 0x55,
+                0x5f, 0xb8, 0x82, 0x15, 0x90, 0xa3, 0x3b, 0xac,
+                0xc6, 0x1e, 0x39, 0x70, 0x1c, 0xf9, 0xb4, 0x6b,
+                0xd2, 0x5b, 0xf5, 0xf0, 0x59, 0x5b, 0xbe, 0x24,
+                0x65, 0x51, 0x41, 0x43, 0x8e, 0x7a, 0x10, 0x0b,
+            },
+        .sign_mode = kOtcryptoEddsaSignModeEddsa,
+        .verify_mode = kOtcryptoEddsaVerifyModeCofactorless,
+        .valid = true,
+    },
+    {
+        .comment = "RFC 8032, section 7.1, test 1 (cofactored)",
+        .public_key =
+            {
+                0xd7, 0x5a, 0x98, 0x01, 0x82, 0xb1, 0x0a, 0xb7,
+                0xd5, 0x4b, 0xfe, 0xd3, 0xc9, 0x64, 0x07, 0x3a,
+                0x0e, 0xe1, 0x72, 0xf3, 0xda, 0xa6, 0x23, 0x25,
+                0xaf, 0x02, 0x1a, 0x68, 0xf7, 0x07, 0x51, 0x1a,
+            },
+        .msg = kMessageEmpty,
+        .msg_len = 0,
+        .signature =
+            {
+                0xe5, 0x56, 0x43, 0x00, 0xc3, 0x60, 0xac, 0x72,
+                0x90, 0x86, 0xe2, 0xcc, 0x80, 0x6e, 0x82, 0x8a,
+                0x84, 0x87, 0x7f, 0x1e, 0xb8, 0xe5, 0xd9, 0x74,
+                0xd8, 0x73, 0xe0, 0x65, 0x22, 0x49, 0x01, 0x55,
+                0x5f, 0xb8, 0x82, 0x15, 0x90, 0xa3, 0x3b, 0xac,
+                0xc6, 0x1e, 0x39, 0x70, 0x1c, 0xf9, 0xb4, 0x6b,
+                0xd2, 0x5b, 0xf5, 0xf0, 0x59, 0x5b, 0xbe, 0x24,
+                0x65, 0x51, 0x41, 0x43, 0x8e, 0x7a, 0x10, 0x0b,
+            },
+        .sign_mode = kOtcryptoEddsaSignModeEddsa,
+        .verify_mode = kOtcryptoEddsaVerifyModeCofactored,
+        .valid = true,
+    },
+    {
+        .comment = "RFC 8032, section 7.1, test 1 with a different message",
+        .public_key =
+            {
+                0xd7, 0x5a, 0x98, 0x01, 0x82, 0xb1, 0x0a, 0xb7,
+                0xd5, 0x4b, 0xfe, 0xd3, 0xc9, 0x64, 0x07, 0x3a,
+                0x0e, 0xe1, 0x72, 0xf3, 0xda, 0xa6, 0x23, 0x25,
+                0xaf, 0x02, 0x1a, 0x68, 0xf7, 0x07, 0x51, 0x1a,
+            },
+        .msg = kMessage72,
+        .msg_len = sizeof(kMessage72),
+        .signature =
+            {
+                0xe5, 0x56, 0x43, 0x00, 0xc3, 0x60, 0xac, 0x72,
+                0x90, 0x86, 0xe2, 0xcc, 0x80, 0x6e, 0x82, 0x8a,
+                0x84, 0x87, 0x7f, 0x1e, 0xb8, 0xe5, 0xd9, 0x74,
+                0xd8, 0x73, 0xe0, 0x65, 0x22, 0x49, 0x01, 0x55,
+                0x5f, 0xb8, 0x82, 0x15, 0x90, 0xa3, 0x3b, 0xac,
+                0xc6, 0x1e, 0x39, 0x70, 0x1c, 0xf9, 0xb4, 0x6b,
+                0xd2, 0x5b, 0xf5, 0xf0, 0x59, 0x5b, 0xbe, 0x24,
+                0x65, 0x51, 0x41, 0x43, 0x8e, 0x7a, 0x10, 0x0b,
+            },
+        .sign_mode = kOtcryptoEddsaSignModeEddsa,
+        .verify_mode = kOtcryptoEddsaVerifyModeCofactorless,
+        .valid = false,
+    },
+    {
+        .comment = "RFC 8032, section 7.3, Ed25519ph",
+        .public_key =
+            {
+                0xec, 0x17, 0x2b, 0x93, 0xad, 0x5e, 0x56, 0x3b,
+                0xf4, 0x93, 0x2c, 0x70, 0xe1, 0x24, 0x50, 0x34,
+                0xc3, 0x54, 0x67, 0xef, 0x2e, 0xfd, 0x4d, 0x64,
+                0xeb, 0xf8, 0x19, 0x68, 0x34, 0x67, 0xe2, 0xbf,
+            },
+        .msg = kMessageAbc,
+        .msg_len = sizeof(kMessageAbc),
+        .signature =
+            {
+                0x98, 0xa7, 0x02, 0x22, 0xf0, 0xb8, 0x12, 0x1a,
+                0xa9, 0xd3, 0x0f, 0x81, 0x3d, 0x68, 0x3f, 0x80,
+                0x9e, 0x46, 0x2b, 0x46, 0x9c, 0x7f, 0xf8, 0x76,
+                0x39, 0x49, 0x9b, 0xb9, 0x4e, 0x6d, 0xae, 0x41,
+                0x31, 0xf8, 0x50, 0x42, 0x46, 0x3c, 0x2a, 0x35,
+                0x5a, 0x20, 0x03, 0xd0, 0x62, 0xad, 0xf5, 0xaa,
+                0xa1, 0x0b, 0x8c, 0x61, 0xe6, 0x36, 0x06, 0x2a,
+                0xaa, 0xd1, 0x1c, 0x2a, 0x26, 0x08, 0x34, 0x06,
+            },
+        .sign_mode = kOtcryptoEddsaSignModeHashEddsa,
+        .verify_mode = kOtcryptoEddsaVerifyModeCofactorless,
+        .valid = true,
+    },
+    {
+        .comment = "Small-order component in R (cofactorless)",
+        .public_key =
+            {
+                0x3d, 0x40, 0x17, 0xc3, 0xe8, 0x43, 0x89, 0x5a,
+                0x92, 0xb7, 0x0a, 0xa7, 0x4d, 0x1b, 0x7e, 0xbc,
+                0x9c, 0x98, 0x2c, 0xcf, 0x2e, 0xc4, 0x96, 0x8c,
+                0xc0, 0xcd, 0x55, 0xf1, 0x2a, 0xf4, 0x66, 0x0c,
+            },
+        .msg = kMessage72,
+        .msg_len = sizeof(kMessage72),
+        .signature =
+            {
+                0x5b, 0x5f, 0xf6, 0x56, 0x0f, 0x2b, 0x35, 0x47,
+                0x8d, 0xf1, 0x7d, 0xf4, 0xa0, 0x9b, 0xda, 0xbf,
+                0x5d, 0x4d, 0x84, 0xab, 0xe9, 0xaf, 0xc0, 0x70,
+                0x4c, 0x89, 0xdd, 0xdc, 0x14, 0x24, 0x96, 0x25,
+                0x0f, 0x8f, 0xcf, 0xec, 0x0f, 0xf2, 0x0e, 0x26,
+                0x55, 0x8a, 0xf1, 0xf8, 0x39, 0xa8, 0xbd, 0xfc,
+                0x97, 0xb4, 0xd8, 0x60, 0x44, 0x33, 0x24, 0xe5,
+                0xbb, 0x24, 0x50, 0x37, 0x3e, 0xba, 0x30, 0x07,
+            },
+        .sign_mode = kOtcryptoEddsaSignModeEddsa,
+        .verify_mode = kOtcryptoEddsaVerifyModeCofactorless,
+        .valid = false,
+    },
+    {
+        .comment = "Small-order component in R (cofactored)",
+        .public_key =
+            {
+                0x3d, 0x40, 0x17, 0xc3, 0xe8, 0x43, 0x89, 0x5a,
+                0x92, 0xb7, 0x0a, 0xa7, 0x4d, 0x1b, 0x7e, 0xbc,
+                0x9c, 0x98, 0x2c, 0xcf, 0x2e, 0xc4, 0x96, 0x8c,
+                0xc0, 0xcd, 0x55, 0xf1, 0x2a, 0xf4, 0x66, 0x0c,
+            },
+        .msg = kMessage72,
+        .msg_len = sizeof(kMessage72),
+        .signature =
+            {
+                0x5b, 0x5f, 0xf6, 0x56, 0x0f, 0x2b, 0x35, 0x47,
+                0x8d, 0xf1, 0x7d, 0xf4, 0xa0, 0x9b, 0xda, 0xbf,
+                0x5d, 0x4d, 0x84, 0xab, 0xe9, 0xaf, 0xc0, 0x70,
+                0x4c, 0x89, 0xdd, 0xdc, 0x14, 0x24, 0x96, 0x25,
+                0x0f, 0x8f, 0xcf, 0xec, 0x0f, 0xf2, 0x0e, 0x26,
+                0x55, 0x8a, 0xf1, 0xf8, 0x39, 0xa8, 0xbd, 0xfc,
+                0x97, 0xb4, 0xd8, 0x60, 0x44, 0x33, 0x24, 0xe5,
+                0xbb, 0x24, 0x50, 0x37, 0x3e, 0xba, 0x30, 0x07,
+            },
+        .sign_mode = kOtcryptoEddsaSignModeEddsa,
+        .verify_mode = kOtcryptoEddsaVerifyModeCofactored,
+        .valid = true,
+    },
+};
+
+status_t ed25519_verify_test(const ed25519_verify_test_vector_t *testvec) {
+  uint32_t pk[kEd25519PublicKeyBytes / sizeof(uint32_t)];
+  memcpy(pk, testvec->public_key, sizeof(pk));
+  otcrypto_unblinded_key_t public_key = {
+      .key_mode = kOtcryptoKeyModeEd25519,
+      .key_length = sizeof(pk),
+      .key = pk,
+  };
+  public_key.checksum = integrity_unblinded_checksum(&public_key);
+
+  uint32_t sig[kEd25519SignatureBytes / sizeof(uint32_t)];
+  memcpy(sig, testvec->signature, sizeof(sig));
+
+  otcrypto_const_byte_buf_t msg = {
+      .data = testvec->msg,
+      .len = testvec->msg_len,
+  };
+
+  hardened_bool_t result;
+  TRY(otcrypto_ed25519_verify(
+      &public_key, msg, testvec->sign_mode, testvec->verify_mode,
+      (otcrypto_const_word32_buf_t){.data = sig, .len = ARRAYSIZE(sig)},
+      &result));
+
+  if (testvec->valid && result != kHardenedBoolTrue) {
+    LOG_ERROR("Valid signature failed verification.");
+    return OTCRYPTO_RECOV_ERR;
+  } else if (!testvec->valid && result != kHardenedBoolFalse) {
+    LOG_ERROR("Invalid signature passed verification.");
+    return OTCRYPTO_RECOV_ERR;
+  }
+
+  return OTCRYPTO_OK;
+}
+
+OTTF_DEFINE_TEST_CONFIG();
+
+bool test_main(void) {
+  // Stays true only if all tests pass.
+  bool result = true;
+
+  CHECK_STATUS_OK(entropy_testutils_auto_mode_init());
+
+  for (size_t i = 0; i < ARRAYSIZE(kEd25519VerifyTests); i++) {
+    const ed25519_verify_test_vector_t *testvec = &kEd25519VerifyTests[i];
+    status_t err = ed25519_verify_test(testvec);
+    if (status_ok(err)) {
+      LOG_INFO("%s: ok", testvec->comment);
+    } else {
+      LOG_ERROR("%s: error %r", testvec->comment, err);
+      // For help with debugging, print the OTBN error bits and instruction
+      // count.
+      LOG_INFO("OTBN error bits: 0x%08x", otbn_err_bits_get());
+      LOG_INFO("OTBN instruction count: 0x%08x", otbn_instruction_count_get());
+      result = false;
+    }
+  }
+
+  return result;
+}
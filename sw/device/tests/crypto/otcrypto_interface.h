@@ -174,6 +174,7 @@ typedef struct otcrypto_interface_t {
   otcrypto_status_t (*ed25519_verify)(const otcrypto_unblinded_key_t *,
                                       otcrypto_const_byte_buf_t,
                                       otcrypto_eddsa_sign_mode_t,
+                                      otcrypto_eddsa_verify_mode_t,
                                       otcrypto_const_word32_buf_t,
                                       hardened_bool_t *);
   otcrypto_status_t (*ed25519_keygen_async_start)(
@@ -187,7 +188,8 @@ typedef struct otcrypto_interface_t {
   otcrypto_status_t (*ed25519_sign_async_finalize)(otcrypto_word32_buf_t);
   otcrypto_status_t (*ed25519_verify_async_start)(
       const otcrypto_unblinded_key_t *, otcrypto_const_byte_buf_t,
-      otcrypto_eddsa_sign_mode_t, otcrypto_const_word32_buf_t);
+      otcrypto_eddsa_sign_mode_t, otcrypto_eddsa_verify_mode_t,
+      otcrypto_const_word32_buf_t);
   otcrypto_status_t (*ed25519_verify_async_finalize)(hardened_bool_t *);
 
   // X25519
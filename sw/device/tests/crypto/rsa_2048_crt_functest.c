@@ -0,0 +1,162 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/lib/base/memory.h"
+#include "sw/device/lib/crypto/drivers/otbn.h"
+#include "sw/device/lib/crypto/impl/rsa/rsa_datatypes.h"
+#include "sw/device/lib/crypto/include/datatypes.h"
+#include "sw/device/lib/crypto/include/rsa.h"
+#include "sw/device/lib/crypto/include/sha2.h"
+#include "sw/device/lib/runtime/log.h"
+#include "sw/device/lib/testing/entropy_testutils.h"
+#include "sw/device/lib/testing/test_framework/check.h"
+#include "sw/device/lib/testing/test_framework/ottf_main.h"
+
+// Module for status messages.
+#define MODULE_ID MAKE_MODULE_ID('t', 's', 't')
+
+// Message data for testing.
+static const unsigned char kTestMessage[] = "Test message.";
+static const size_t kTestMessageLen = sizeof(kTestMessage) - 1;
+
+// RSA key mode for testing.
+static const otcrypto_key_mode_t kTestKeyMode = kOtcryptoKeyModeRsaSignPkcs;
+
+// Buffers for the generated key pair.
+static uint32_t public_key_data[ceil_div(kOtcryptoRsa2048PublicKeyBytes,
+                                         sizeof(uint32_t))];
+static uint32_t keyblob[ceil_div(kOtcryptoRsa2048CrtPrivateKeyblobBytes,
+                                 sizeof(uint32_t))];
+
+static otcrypto_unblinded_key_t public_key = {
+    .key_mode = kTestKeyMode,
+    .key_length = kOtcryptoRsa2048PublicKeyBytes,
+    .key = public_key_data,
+};
+
+static otcrypto_blinded_key_t private_key = {
+    .config =
+        {
+            .version = kOtcryptoLibVersion1,
+            .key_mode = kTestKeyMode,
+            .key_length = kOtcryptoRsa2048PrivateKeyBytes,
+            .hw_backed = kHardenedBoolFalse,
+            .security_level = kOtcryptoKeySecurityLevelLow,
+        },
+    .keyblob_length = kOtcryptoRsa2048CrtPrivateKeyblobBytes,
+    .keyblob = keyblob,
+};
+
+status_t keygen_then_sign_test(void) {
+  // Generate the key pair in CRT form.
+  LOG_INFO("Starting CRT keypair generation...");
+  TRY(otcrypto_rsa_keygen(kOtcryptoRsaSize2048, &public_key, &private_key));
+  LOG_INFO("CRT keypair generation complete.");
+  LOG_INFO("OTBN instruction count: %u", otbn_instruction_count_get());
+
+  // Interpret the keys using internal RSA datatypes.
+  TRY_CHECK(public_key.key_length == sizeof(rsa_2048_public_key_t));
+  rsa_2048_public_key_t *pk = (rsa_2048_public_key_t *)public_key.key;
+  TRY_CHECK(private_key.keyblob_length == sizeof(rsa_2048_crt_private_key_t));
+  rsa_2048_crt_private_key_t *sk =
+      (rsa_2048_crt_private_key_t *)private_key.keyblob;
+
+  // Check that the moduli match.
+  TRY_CHECK_ARRAYS_EQ(pk->n.data, sk->n.data, ARRAYSIZE(pk->n.data));
+
+  // Hash the message.
+  otcrypto_const_byte_buf_t msg_buf = {.data = kTestMessage,
+                                       .len = kTestMessageLen};
+  uint32_t msg_digest_data[256 / 32];
+  otcrypto_hash_digest_t msg_digest = {
+      .data = msg_digest_data,
+      .len = ARRAYSIZE(msg_digest_data),
+  };
+  TRY(otcrypto_sha2_256(msg_buf, &msg_digest));
+
+  uint32_t sig[kRsa2048NumWords];
+  otcrypto_word32_buf_t sig_buf = {
+      .data = sig,
+      .len = kRsa2048NumWords,
+  };
+  otcrypto_const_word32_buf_t const_sig_buf = {
+      .data = sig,
+      .len = kRsa2048NumWords,
+  };
+
+  // Generate a signature with the CRT key. OTBN checks the signature against
+  // the public exponent before releasing it.
+  LOG_INFO("Starting CRT signature generation...");
+  TRY(otcrypto_rsa_sign(&private_key, msg_digest, kOtcryptoRsaPaddingPkcs,
+                        sig_buf));
+  LOG_INFO("CRT signature generation complete.");
+  LOG_INFO("OTBN instruction count: %u", otbn_instruction_count_get());
+
+  // Verify the signature.
+  LOG_INFO("Starting signature verification...");
+  hardened_bool_t verification_result;
+  TRY(otcrypto_rsa_verify(&public_key, msg_digest, kOtcryptoRsaPaddingPkcs,
+                          const_sig_buf, &verification_result));
+  LOG_INFO("Signature verification complete.");
+  LOG_INFO("OTBN instruction count: %u", otbn_instruction_count_get());
+
+  // Expect the signature to pass verification.
+  TRY_CHECK(verification_result == kHardenedBoolTrue);
+  return OK_STATUS();
+}
+
+status_t keypair_from_primes_test(void) {
+  rsa_2048_crt_private_key_t *sk =
+      (rsa_2048_crt_private_key_t *)private_key.keyblob;
+
+  // Buffers for the derived key pair.
+  static uint32_t derived_public_key_data[ARRAYSIZE(public_key_data)];
+  otcrypto_unblinded_key_t derived_public_key = public_key;
+  derived_public_key.key = derived_public_key_data;
+  static uint32_t derived_keyblob[ARRAYSIZE(keyblob)];
+  otcrypto_blinded_key_t derived_private_key = private_key;
+  derived_private_key.keyblob = derived_keyblob;
+
+  // Derive the key again from the primes of the generated key.
+  otcrypto_const_word32_buf_t p = {
+      .data = sk->p.data,
+      .len = ARRAYSIZE(sk->p.data),
+  };
+  otcrypto_const_word32_buf_t q = {
+      .data = sk->q.data,
+      .len = ARRAYSIZE(sk->q.data),
+  };
+  LOG_INFO("Starting CRT key derivation...");
+  TRY(otcrypto_rsa_keypair_from_primes(kOtcryptoRsaSize2048, p, q,
+                                       &derived_public_key,
+                                       &derived_private_key));
+  LOG_INFO("CRT key derivation complete.");
+  LOG_INFO("OTBN instruction count: %u", otbn_instruction_count_get());
+
+  // The derived key must match the generated one (after unmasking).
+  rsa_2048_crt_private_key_t *derived_sk =
+      (rsa_2048_crt_private_key_t *)derived_private_key.keyblob;
+  TRY_CHECK_ARRAYS_EQ(derived_public_key_data, public_key_data,
+                      ARRAYSIZE(public_key_data));
+  TRY_CHECK_ARRAYS_EQ(derived_sk->qinv.data, sk->qinv.data,
+                      ARRAYSIZE(sk->qinv.data));
+  for (size_t i = 0; i < ARRAYSIZE(sk->dp0.data); i++) {
+    TRY_CHECK((derived_sk->dp0.data[i] ^ derived_sk->dp1.data[i]) ==
+              (sk->dp0.data[i] ^ sk->dp1.data[i]));
+    TRY_CHECK((derived_sk->dq0.data[i] ^ derived_sk->dq1.data[i]) ==
+              (sk->dq0.data[i] ^ sk->dq1.data[i]));
+  }
+  return OK_STATUS();
+}
+
+OTTF_DEFINE_TEST_CONFIG();
+
+bool test_main(void) {
+  CHECK_STATUS_OK(entropy_testutils_auto_mode_init());
+
+  status_t test_result = OK_STATUS();
+  EXECUTE_TEST(test_result, keygen_then_sign_test);
+  EXECUTE_TEST(test_result, keypair_from_primes_test);
+  return status_ok(test_result);
+}
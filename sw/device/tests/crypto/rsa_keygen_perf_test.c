@@ -0,0 +1,128 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sw/device/lib/base/math.h"
+#include "sw/device/lib/base/memory.h"
+#include "sw/device/lib/crypto/drivers/otbn.h"
+#include "sw/device/lib/crypto/include/datatypes.h"
+#include "sw/device/lib/crypto/include/rsa.h"
+#include "sw/device/lib/runtime/ibex.h"
+#include "sw/device/lib/runtime/log.h"
+#include "sw/device/lib/testing/entropy_testutils.h"
+#include "sw/device/lib/testing/test_framework/check.h"
+#include "sw/device/lib/testing/test_framework/ottf_main.h"
+
+// Module for status messages.
+#define MODULE_ID MAKE_MODULE_ID('t', 's', 't')
+
+// RSA key mode for testing.
+static const otcrypto_key_mode_t kTestKeyMode = kOtcryptoKeyModeRsaSignPkcs;
+
+enum {
+  // Number of keys to generate for each RSA size.
+  kNumKeygens = 8,
+  // Largest public key (bytes).
+  kMaxPublicKeyBytes = kOtcryptoRsa4096PublicKeyBytes,
+  // Largest private keyblob (bytes).
+  kMaxPrivateKeyblobBytes = kOtcryptoRsa4096PrivateKeyblobBytes,
+};
+
+/**
+ * Generates `kNumKeygens` RSA keys of the given size and reports the spread of
+ * keygen times.
+ *
+ * Prime generation is randomized, so the runtime of a single keygen says
+ * little; this logs the minimum, mean, and maximum Ibex cycle counts (in
+ * kilocycles) as well as the OTBN instruction count for each run.
+ *
+ * @param size RSA size parameter.
+ * @param public_key_bytes Length of the public key in bytes.
+ * @param private_key_bytes Length of the private key in bytes.
+ * @param keyblob_bytes Length of the private keyblob in bytes.
+ * @return OK or error.
+ */
+static status_t keygen_perf(otcrypto_rsa_size_t size, size_t public_key_bytes,
+                            size_t private_key_bytes, size_t keyblob_bytes) {
+  uint32_t public_key_data[ceil_div(kMaxPublicKeyBytes, sizeof(uint32_t))];
+  uint32_t keyblob[ceil_div(kMaxPrivateKeyblobBytes, sizeof(uint32_t))];
+
+  uint64_t min_cycles = UINT64_MAX;
+  uint64_t max_cycles = 0;
+  uint64_t total_cycles = 0;
+  for (size_t i = 0; i < kNumKeygens; i++) {
+    memset(public_key_data, 0, sizeof(public_key_data));
+    otcrypto_unblinded_key_t public_key = {
+        .key_mode = kTestKeyMode,
+        .key_length = public_key_bytes,
+        .key = public_key_data,
+    };
+    memset(keyblob, 0, sizeof(keyblob));
+    otcrypto_blinded_key_t private_key = {
+        .config =
+            {
+                .version = kOtcryptoLibVersion1,
+                .key_mode = kTestKeyMode,
+                .key_length = private_key_bytes,
+                .hw_backed = kHardenedBoolFalse,
+                .security_level = kOtcryptoKeySecurityLevelLow,
+            },
+        .keyblob_length = keyblob_bytes,
+        .keyblob = keyblob,
+    };
+
+    uint64_t start_cycles = ibex_mcycle_read();
+    TRY(otcrypto_rsa_keygen(size, &public_key, &private_key));
+    uint64_t num_cycles = ibex_mcycle_read() - start_cycles;
+    LOG_INFO("Run %d: %u kcycles, OTBN instruction count: %u", i,
+             (uint32_t)udiv64_slow(num_cycles, 1000, NULL),
+             otbn_instruction_count_get());
+
+    if (num_cycles < min_cycles) {
+      min_cycles = num_cycles;
+    }
+    if (num_cycles > max_cycles) {
+      max_cycles = num_cycles;
+    }
+    total_cycles += num_cycles;
+  }
+
+  // Cycle counts for large keys can exceed 32 bits, so report kilocycles.
+  uint32_t min_kcycles = (uint32_t)udiv64_slow(min_cycles, 1000, NULL);
+  uint32_t max_kcycles = (uint32_t)udiv64_slow(max_cycles, 1000, NULL);
+  uint32_t mean_kcycles =
+      (uint32_t)udiv64_slow(total_cycles, kNumKeygens * 1000, NULL);
+  LOG_INFO("Keygen kcycles over %d runs: min = %u, mean = %u, max = %u",
+           kNumKeygens, min_kcycles, mean_kcycles, max_kcycles);
+  return OK_STATUS();
+}
+
+status_t rsa2048_keygen_perf_test(void) {
+  return keygen_perf(kOtcryptoRsaSize2048, kOtcryptoRsa2048PublicKeyBytes,
+                     kOtcryptoRsa2048PrivateKeyBytes,
+                     kOtcryptoRsa2048PrivateKeyblobBytes);
+}
+
+status_t rsa3072_keygen_perf_test(void) {
+  return keygen_perf(kOtcryptoRsaSize3072, kOtcryptoRsa3072PublicKeyBytes,
+                     kOtcryptoRsa3072PrivateKeyBytes,
+                     kOtcryptoRsa3072PrivateKeyblobBytes);
+}
+
+status_t rsa4096_keygen_perf_test(void) {
+  return keygen_perf(kOtcryptoRsaSize4096, kOtcryptoRsa4096PublicKeyBytes,
+                     kOtcryptoRsa4096PrivateKeyBytes,
+                     kOtcryptoRsa4096PrivateKeyblobBytes);
+}
+
+OTTF_DEFINE_TEST_CONFIG();
+
+bool test_main(void) {
+  CHECK_STATUS_OK(entropy_testutils_auto_mode_init());
+
+  status_t test_result = OK_STATUS();
+  EXECUTE_TEST(test_result, rsa2048_keygen_perf_test);
+  EXECUTE_TEST(test_result, rsa3072_keygen_perf_test);
+  EXECUTE_TEST(test_result, rsa4096_keygen_perf_test);
+  return status_ok(test_result);
+}
@@ -12,7 +12,8 @@
 #include "sw/device/lib/testing/test_framework/ujson_ottf_commands.h"
 #include "sw/device/lib/ujson/ujson.h"
 
-OTTF_DEFINE_TEST_CONFIG(.enable_uart_flow_control = true);
+OTTF_DEFINE_TEST_CONFIG(.enable_uart_flow_control = true,
+                        .enable_uart_tx_irq = true);
 
 volatile uint8_t kTestBytes[256];
 volatile uint32_t kTestWord;
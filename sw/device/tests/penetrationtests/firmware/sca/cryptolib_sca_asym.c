@@ -274,6 +274,57 @@ status_t handle_cryptolib_sca_asym_p256_ecdh(ujson_t *uj) {
   return OK_STATUS();
 }
 
+status_t handle_cryptolib_sca_asym_p256_ecdh_fvsr(ujson_t *uj) {
+  cryptolib_sca_asym_p256_ecdh_fvsr_in_t uj_input;
+  TRY(ujson_deserialize_cryptolib_sca_asym_p256_ecdh_fvsr_in_t(uj, &uj_input));
+
+  uint8_t batch_private_key[uj_input.num_iterations][P256_CMD_BYTES];
+
+  // First generate all FvsR data sets. When sample_fixed,
+  // the provided private key is used. When not sample_fixed,
+  // a random private key is generated. The public key is
+  // the same for all data sets.
+  bool sample_fixed = true;
+  for (size_t it = 0; it < uj_input.num_iterations; it++) {
+    if (sample_fixed) {
+      memcpy(batch_private_key[it], uj_input.private_key, P256_CMD_BYTES);
+    } else {
+      prng_rand_bytes(batch_private_key[it], P256_CMD_BYTES);
+    }
+    sample_fixed = prng_rand_byte() & 0x1;
+  }
+
+  cryptolib_sca_asym_p256_ecdh_in_t ecdh_input;
+  memset(&ecdh_input, 0, sizeof(ecdh_input));
+  memcpy(ecdh_input.public_x, uj_input.public_x, P256_CMD_BYTES);
+  memcpy(ecdh_input.public_y, uj_input.public_y, P256_CMD_BYTES);
+  ecdh_input.cfg = uj_input.cfg;
+  ecdh_input.trigger = uj_input.trigger;
+
+  // Invoke ECDH for each data set. The shared keys are XORed together so
+  // that the host can check the whole batch, and the first failing status is
+  // reported.
+  cryptolib_sca_asym_p256_ecdh_out_t uj_output;
+  memset(&uj_output, 0, sizeof(uj_output));
+  for (size_t it = 0; it < uj_input.num_iterations; it++) {
+    memcpy(ecdh_input.private_key, batch_private_key[it], P256_CMD_BYTES);
+    cryptolib_sca_asym_p256_ecdh_out_t ecdh_output;
+    memset(&ecdh_output, 0, sizeof(ecdh_output));
+    size_t status =
+        (size_t)cryptolib_sca_p256_ecdh_impl(ecdh_input, &ecdh_output).value;
+    if (uj_output.status == 0) {
+      uj_output.status = status;
+    }
+    for (size_t i = 0; i < P256_CMD_BYTES; i++) {
+      uj_output.shared_key[i] ^= ecdh_output.shared_key[i];
+    }
+    uj_output.cfg = ecdh_output.cfg;
+  }
+
+  RESP_OK(ujson_serialize_cryptolib_sca_asym_p256_ecdh_out_t, uj, &uj_output);
+  return OK_STATUS();
+}
+
 status_t handle_cryptolib_sca_asym_p256_sign(ujson_t *uj) {
   cryptolib_sca_asym_p256_sign_in_t uj_input;
   TRY(ujson_deserialize_cryptolib_sca_asym_p256_sign_in_t(uj, &uj_input));
@@ -291,6 +342,54 @@ status_t handle_cryptolib_sca_asym_p256_sign(ujson_t *uj) {
   return OK_STATUS();
 }
 
+status_t handle_cryptolib_sca_asym_p256_sign_fvsr(ujson_t *uj) {
+  cryptolib_sca_asym_p256_sign_fvsr_in_t uj_input;
+  TRY(ujson_deserialize_cryptolib_sca_asym_p256_sign_fvsr_in_t(uj, &uj_input));
+
+  uint8_t batch_message[uj_input.num_iterations][P256_CMD_BYTES];
+
+  // First generate all FvsR data sets. When sample_fixed,
+  // the provided message is used. When not sample_fixed,
+  // a random message is generated. The key is the same
+  // for all data sets.
+  bool sample_fixed = true;
+  for (size_t it = 0; it < uj_input.num_iterations; it++) {
+    if (sample_fixed) {
+      memcpy(batch_message[it], uj_input.message, P256_CMD_BYTES);
+    } else {
+      prng_rand_bytes(batch_message[it], P256_CMD_BYTES);
+    }
+    sample_fixed = prng_rand_byte() & 0x1;
+  }
+
+  cryptolib_sca_asym_p256_sign_in_t sign_input;
+  memset(&sign_input, 0, sizeof(sign_input));
+  memcpy(sign_input.scalar, uj_input.scalar, P256_CMD_BYTES);
+  memcpy(sign_input.pubx, uj_input.pubx, P256_CMD_BYTES);
+  memcpy(sign_input.puby, uj_input.puby, P256_CMD_BYTES);
+  sign_input.cfg = uj_input.cfg;
+  sign_input.trigger = uj_input.trigger;
+
+  // Invoke sign for each data set. Signatures are randomized, so the last
+  // one is sent back for the host to verify, along with the first failing
+  // status of the batch.
+  cryptolib_sca_asym_p256_sign_out_t uj_output;
+  memset(&uj_output, 0, sizeof(uj_output));
+  size_t batch_status = 0;
+  for (size_t it = 0; it < uj_input.num_iterations; it++) {
+    memcpy(sign_input.message, batch_message[it], P256_CMD_BYTES);
+    size_t status =
+        (size_t)cryptolib_sca_p256_sign_impl(sign_input, &uj_output).value;
+    if (batch_status == 0) {
+      batch_status = status;
+    }
+  }
+  uj_output.status = batch_status;
+
+  RESP_OK(ujson_serialize_cryptolib_sca_asym_p256_sign_out_t, uj, &uj_output);
+  return OK_STATUS();
+}
+
 status_t trigger_cryptolib_sca_asym_p384_base_mul(
     uint8_t scalar[P384_CMD_BYTES], uint8_t x[P384_CMD_BYTES],
     uint8_t y[P384_CMD_BYTES], size_t cfg_in, size_t *cfg_out, size_t *status,
@@ -889,8 +988,12 @@ status_t handle_cryptolib_sca_asym(ujson_t *uj) {
       return handle_cryptolib_sca_asym_p256_point_mul(uj);
     case kCryptoLibScaAsymSubcommandP256Ecdh:
       return handle_cryptolib_sca_asym_p256_ecdh(uj);
+    case kCryptoLibScaAsymSubcommandP256EcdhFvsr:
+      return handle_cryptolib_sca_asym_p256_ecdh_fvsr(uj);
     case kCryptoLibScaAsymSubcommandP256Sign:
       return handle_cryptolib_sca_asym_p256_sign(uj);
+    case kCryptoLibScaAsymSubcommandP256SignFvsr:
+      return handle_cryptolib_sca_asym_p256_sign_fvsr(uj);
     case kCryptoLibScaAsymSubcommandP384BaseMulFvsr:
       return handle_cryptolib_sca_asym_p384_base_mul_fvsr(uj);
     case kCryptoLibScaAsymSubcommandP384BaseMulDaisy:
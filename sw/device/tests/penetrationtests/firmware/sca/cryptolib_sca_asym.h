@@ -122,6 +122,21 @@ status_t handle_cryptolib_sca_asym_p256_point_mul(ujson_t *uj);
  */
 status_t handle_cryptolib_sca_asym_p256_ecdh(ujson_t *uj);
 
+/**
+ * The cryptolib sca p256 ecdh fvsr handler.
+ *
+ * This SCA penetration test triggers num_iterations ECDH operations on p256
+ * with either the fixed or a random private key. The XOR of all shared keys is
+ * returned.
+ *
+ * See cryptolib_sca_asymcommands.h for inputs and outputs.
+ * See sca_cryptolib.json for examples of its use.
+ *
+ * @param uj An initialized uJSON context.
+ * @return OK or error.
+ */
+status_t handle_cryptolib_sca_asym_p256_ecdh_fvsr(ujson_t *uj);
+
 /**
  * The cryptolib sca p256 sign handler.
  *
@@ -135,6 +150,20 @@ status_t handle_cryptolib_sca_asym_p256_ecdh(ujson_t *uj);
  */
 status_t handle_cryptolib_sca_asym_p256_sign(ujson_t *uj);
 
+/**
+ * The cryptolib sca p256 sign fvsr handler.
+ *
+ * This SCA penetration test triggers num_iterations signs on p256 of either
+ * the fixed or a random message. The last signature is returned.
+ *
+ * See cryptolib_sca_asymcommands.h for inputs and outputs.
+ * See sca_cryptolib.json for examples of its use.
+ *
+ * @param uj An initialized uJSON context.
+ * @return OK or error.
+ */
+status_t handle_cryptolib_sca_asym_p256_sign_fvsr(ujson_t *uj);
+
 /**
  * The cryptolib sca p384 base mul handler.
  *
@@ -153,6 +153,9 @@ static void otbn_manual_trigger(void) { otbn_execute(); }
 /**
  * Runs the OTBN key generation program.
  *
+ * The app must already be loaded. Every input is rewritten before each run,
+ * so the app can stay loaded for a whole batch.
+ *
  * The seed shares must be `kEcc256SeedNumWords` words long.
  *
  * @param[in] mode  Mode parameter (private key only or full keypair).
@@ -162,9 +165,6 @@ static void otbn_manual_trigger(void) { otbn_execute(); }
  */
 static status_t p256_run_keygen(uint32_t mode, const uint32_t *share0,
                                 const uint32_t *share1) {
-  // Secure wipe to scramble DMEM.
-  TRY(otbn_load_app(kOtbnAppP256KeyFromSeed));
-
   // Write mode.
   TRY(otbn_dmem_write(/*num_words=*/1, &mode, kOtbnVarMode));
 
@@ -228,6 +228,8 @@ status_t handle_otbn_sca_ecc256_ecdsa_keygen_fvsr_key_batch(ujson_t *uj) {
     run_fixed = prng_rand_uint32() & 0x1;
   }
 
+  // Load the app once for the whole batch.
+  TRY(otbn_load_app(kOtbnAppP256KeyFromSeed));
   for (size_t i = 0; i < num_traces; ++i) {
     TRY(p256_run_keygen(kEcc256ModeKeypair, batch_share0[i], batch_share1[i]));
 
@@ -296,6 +298,8 @@ status_t handle_otbn_sca_ecc256_ecdsa_keygen_fvsr_seed_batch(ujson_t *uj) {
     run_fixed = prng_rand_uint32() & 0x1;
   }
 
+  // Load the app once for the whole batch.
+  TRY(otbn_load_app(kOtbnAppP256KeyFromSeed));
   for (size_t i = 0; i < num_traces; ++i) {
     TRY(p256_run_keygen(kEcc256ModeKeypair, batch_share0[i], batch_share1[i]));
 
@@ -49,6 +49,14 @@ enum {
    * Max number of traces per batch.
    */
   kNumBatchOpsMax = 256,
+  /**
+   * Number of bytes for RSA512 operands.
+   */
+  kRsa512NumBytes = 512 / 8,
+  /**
+   * Number of 32b words for RSA512 operands.
+   */
+  kRsa512NumWords = kRsa512NumBytes / sizeof(uint32_t),
 };
 
 // Data structs for key sideloading test.
@@ -353,10 +361,10 @@ status_t handle_otbn_sca_ecdsa_p256_sign_batch(ujson_t *uj) {
   // Last signature output.
   uint32_t ecc256_signature_r[kEcc256NumWords];
   uint32_t ecc256_signature_s[kEcc256NumWords];
-  // Run num_traces ECDSA operations.
+  // Run num_traces ECDSA operations. The app stays loaded for the whole
+  // batch, as every input is rewritten before each run.
+  TRY(otbn_load_app(kOtbnAppP256Ecdsa));
   for (size_t i = 0; i < uj_data_num_traces.num_traces; ++i) {
-    otbn_load_app(kOtbnAppP256Ecdsa);
-
     // Start the operation.
     p256_ecdsa_sign(ecc256_message_batch[i], ecc256_private_key_d_batch[i],
                     ecc256_signature_r, ecc256_signature_s,
@@ -454,10 +462,10 @@ status_t handle_otbn_sca_ecdsa_p256_sign_fvsr_batch(ujson_t *uj) {
   // Last signature output.
   uint32_t ecc256_signature_r[kEcc256NumWords];
   uint32_t ecc256_signature_s[kEcc256NumWords];
-  // Run num_traces ECDSA operations.
+  // Run num_traces ECDSA operations. The app stays loaded for the whole
+  // batch, as every input is rewritten before each run.
+  TRY(otbn_load_app(kOtbnAppP256Ecdsa));
   for (size_t i = 0; i < uj_data_num_traces.num_traces; ++i) {
-    otbn_load_app(kOtbnAppP256Ecdsa);
-
     // Start the operation.
     p256_ecdsa_sign(uj_data.msg, ecc256_private_key_d_batch[i],
                     ecc256_signature_r, ecc256_signature_s,
@@ -803,6 +811,80 @@ status_t handle_otbn_sca_rsa512_decrypt(ujson_t *uj) {
   return OK_STATUS();
 }
 
+status_t handle_otbn_sca_rsa512_decrypt_fvsr_batch(ujson_t *uj) {
+  // Get number of traces.
+  penetrationtest_otbn_sca_num_traces_t uj_data_num_traces;
+  TRY(ujson_deserialize_penetrationtest_otbn_sca_num_traces_t(
+      uj, &uj_data_num_traces));
+
+  if (uj_data_num_traces.num_traces > kNumBatchOpsMax) {
+    return OUT_OF_RANGE();
+  }
+
+  // Get RSA512 parameters and the fixed message.
+  penetrationtest_otbn_sca_rsa512_dec_t uj_data;
+  TRY(ujson_deserialize_penetrationtest_otbn_sca_rsa512_dec_t(uj, &uj_data));
+  uint32_t fixed_msg[kRsa512NumWords];
+  memcpy(fixed_msg, uj_data.msg, sizeof(fixed_msg));
+
+  // Generate the FvsR data set. For each trace, the message is either the fixed
+  // one received from the host or random. The most significant byte of random
+  // messages is cleared to keep them below the modulus.
+  uint32_t rsa512_msg_batch[kNumBatchOpsMax][kRsa512NumWords];
+  bool run_fixed = true;
+  for (size_t i = 0; i < uj_data_num_traces.num_traces; ++i) {
+    gen_fvsr_data(rsa512_msg_batch[i], run_fixed, fixed_msg, kRsa512NumWords);
+    if (!run_fixed) {
+      rsa512_msg_batch[i][kRsa512NumWords - 1] &= 0x00ffffff;
+    }
+    run_fixed = prng_rand_uint32() & 0x1;
+  }
+
+  TRY(otbn_load_app(kOtbnAppRsa));
+
+  const uint8_t zero[kRsa512NumBytes] = {0};
+  uint32_t batch_out[kRsa512NumWords];
+  memset(batch_out, 0, sizeof(batch_out));
+  for (size_t i = 0; i < uj_data_num_traces.num_traces; ++i) {
+    // Write data into OTBN DMEM.
+    TRY(dif_otbn_dmem_write(&otbn, kOtbnVarRsaMode, &kMode512Modexp,
+                            sizeof(uint32_t)));
+    TRY(dif_otbn_dmem_write(&otbn, kOtbnVarRsaModulus, uj_data.modu,
+                            sizeof(uj_data.modu)));
+    TRY(dif_otbn_dmem_write(&otbn, kOtbnVarRsaD0, uj_data.exp,
+                            sizeof(uj_data.exp)));
+    TRY(dif_otbn_dmem_write(&otbn, kOtbnVarRsaD1, zero, sizeof(zero)));
+    TRY(dif_otbn_dmem_write(&otbn, kOtbnVarRsaInOut, rsa512_msg_batch[i],
+                            sizeof(rsa512_msg_batch[i])));
+
+    pentest_set_trigger_high();
+    // Give the trigger time to rise.
+    asm volatile(NOP30);
+    otbn_execute();
+    otbn_busy_wait_for_done();
+    pentest_set_trigger_low();
+
+    // The correctness of the batch is verified by the host with the XOR of
+    // all decrypted messages.
+    uint32_t out[kRsa512NumWords];
+    TRY(dif_otbn_dmem_read(&otbn, kOtbnVarRsaInOut, out, sizeof(out)));
+    for (size_t j = 0; j < kRsa512NumWords; ++j) {
+      batch_out[j] ^= out[j];
+    }
+  }
+
+  // Send back the XOR of all decryption results to host.
+  penetrationtest_otbn_sca_rsa512_dec_out_t uj_output;
+  memcpy(uj_output.out, batch_out, sizeof(batch_out));
+  RESP_OK(ujson_serialize_penetrationtest_otbn_sca_rsa512_dec_out_t, uj,
+          &uj_output);
+
+  // Clear OTBN memory
+  TRY(clear_otbn());
+
+  return OK_STATUS();
+}
+
 status_t handle_otbn_sca(ujson_t *uj) {
   otbn_sca_subcommand_t cmd;
   TRY(ujson_deserialize_otbn_sca_subcommand_t(uj, &cmd));
@@ -835,6 +917,8 @@ status_t handle_otbn_sca(ujson_t *uj) {
       return handle_otbn_sca_key_sideload_fvsr(uj);
     case kOtbnScaSubcommandRsa512Decrypt:
       return handle_otbn_sca_rsa512_decrypt(uj);
+    case kOtbnScaSubcommandRsa512DecryptFvsrBatch:
+      return handle_otbn_sca_rsa512_decrypt_fvsr_batch(uj);
     default:
       LOG_ERROR("Unrecognized OTBN SCA subcommand: %d", cmd);
       return INVALID_ARGUMENT();
@@ -146,6 +146,19 @@ status_t handle_otbn_sca_key_sideload_fvsr(ujson_t *uj);
  */
 status_t handle_otbn_sca_rsa512_decrypt(ujson_t *uj);
 
+/**
+ * Command handler for the otbn.sca.rsa512_decrypt_fvsr_batch test.
+ *
+ * Batched RSA512 decryption side-channel test. Get the number of traces and
+ * the mod, exp, and fixed msg from uJSON. For each trace, either the fixed or
+ * a random message from the PRNG is decrypted, with the OTBN app loaded only
+ * once for the whole batch. The XOR of all decrypted messages is sent back.
+ *
+ * @param uj An initialized uJSON context.
+ * @return OK or error.
+ */
+status_t handle_otbn_sca_rsa512_decrypt_fvsr_batch(ujson_t *uj);
+
 /**
  * Command handler for the otbn.sca.combi_ops test.
  *
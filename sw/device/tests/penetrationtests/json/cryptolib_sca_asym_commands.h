@@ -33,7 +33,9 @@ extern "C" {
     value(_, P256BaseMulDaisy) \
     value(_, P256PointMul) \
     value(_, P256Ecdh) \
+    value(_, P256EcdhFvsr) \
     value(_, P256Sign) \
+    value(_, P256SignFvsr) \
     value(_, P384BaseMulFvsr) \
     value(_, P384BaseMulDaisy) \
     value(_, P384PointMul) \
@@ -158,6 +160,15 @@ UJSON_SERDE_STRUCT(CryptoLibScaAsymP256EcdhIn, cryptolib_sca_asym_p256_ecdh_in_t
     field(cfg, size_t)
 UJSON_SERDE_STRUCT(CryptoLibScaAsymP256EcdhOut, cryptolib_sca_asym_p256_ecdh_out_t, CRYPTOLIBSCAASYM_P256_ECDH_OUT);
 
+#define CRYPTOLIBSCAASYM_P256_ECDH_FVSR_IN(field, string) \
+    field(private_key, uint8_t, P256_CMD_BYTES) \
+    field(public_x, uint8_t, P256_CMD_BYTES) \
+    field(public_y, uint8_t, P256_CMD_BYTES) \
+    field(cfg, size_t) \
+    field(num_iterations, size_t) \
+    field(trigger, size_t)
+UJSON_SERDE_STRUCT(CryptoLibScaAsymP256EcdhFvsrIn, cryptolib_sca_asym_p256_ecdh_fvsr_in_t, CRYPTOLIBSCAASYM_P256_ECDH_FVSR_IN);
+
 #define CRYPTOLIBSCAASYM_P256_SIGN_IN(field, string) \
     field(scalar, uint8_t, P256_CMD_BYTES) \
     field(pubx, uint8_t, P256_CMD_BYTES) \
@@ -176,6 +187,16 @@ UJSON_SERDE_STRUCT(CryptoLibScaAsymP256SignIn, cryptolib_sca_asym_p256_sign_in_t
     field(cfg, size_t)
 UJSON_SERDE_STRUCT(CryptoLibScaAsymP256SignOut, cryptolib_sca_asym_p256_sign_out_t, CRYPTOLIBSCAASYM_P256_SIGN_OUT);
 
+#define CRYPTOLIBSCAASYM_P256_SIGN_FVSR_IN(field, string) \
+    field(scalar, uint8_t, P256_CMD_BYTES) \
+    field(pubx, uint8_t, P256_CMD_BYTES) \
+    field(puby, uint8_t, P256_CMD_BYTES) \
+    field(message, uint8_t, P256_CMD_BYTES) \
+    field(cfg, size_t) \
+    field(num_iterations, size_t) \
+    field(trigger, size_t)
+UJSON_SERDE_STRUCT(CryptoLibScaAsymP256SignFvsrIn, cryptolib_sca_asym_p256_sign_fvsr_in_t, CRYPTOLIBSCAASYM_P256_SIGN_FVSR_IN);
+
 #define CRYPTOLIBSCAASYM_P384_BASE_MUL_IN(field, string) \
     field(scalar, uint8_t, P384_CMD_BYTES) \
     field(cfg, size_t) \
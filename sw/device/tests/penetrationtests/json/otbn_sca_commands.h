@@ -30,7 +30,8 @@ extern "C" {
     value(_, InsnCarryFlag) \
     value(_, CombiOps) \
     value(_, KeySideloadFvsr) \
-    value(_, Rsa512Decrypt)
+    value(_, Rsa512Decrypt) \
+    value(_, Rsa512DecryptFvsrBatch)
 C_ONLY(UJSON_SERDE_ENUM(OtbnScaSubcommand, otbn_sca_subcommand_t, OTBNSCA_SUBCOMMAND));
 RUST_ONLY(UJSON_SERDE_ENUM(OtbnScaSubcommand, otbn_sca_subcommand_t, OTBNSCA_SUBCOMMAND, RUST_DEFAULT_DERIVE, strum::EnumString));
 
@@ -0,0 +1,132 @@
+// Copyright lowRISC contributors (OpenTitan project).
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+use anyhow::{Result, anyhow};
+use byteorder::{LittleEndian, ReadBytesExt};
+use serde_annotate::Annotate;
+use std::convert::TryFrom;
+
+use super::ChipDataError;
+
+/// The names of the boot stages recorded in the ledger, in ledger order.
+pub const BOOT_TIMING_STAGES: [&str; BootTiming::STAGE_COUNT] = [
+    "RomStart",
+    "RomFlashCtrlInit",
+    "RomInit",
+    "RomBootDataRead",
+    "RomBootPolicy",
+    "RomVerify",
+    "RomKeymgr",
+    "RomHandoff",
+    "RomExtStart",
+    "RomExtInit",
+    "RomExtOwnership",
+    "RomExtVerify",
+    "RomExtDice",
+    "RomExtHandoff",
+];
+
+/// A single boot stage in the boot timing ledger.
+#[derive(Debug, Default, Annotate)]
+pub struct BootTimingStage {
+    /// The name of the stage.
+    pub name: String,
+    /// The `mcycle` value at which the stage completed.
+    pub cycles: u32,
+    /// Cycles spent since the previous recorded stage.
+    pub delta: u32,
+}
+
+/// The BootTiming ledger records when each ROM and ROM_EXT boot stage
+/// completed, as the low 32 bits of the `mcycle` counter.
+#[derive(Debug, Default, Annotate)]
+pub struct BootTiming {
+    /// A tag that identifies this struct as the boot timing ledger ('BTIM').
+    #[annotate(format=hex)]
+    pub identifier: u32,
+    /// The number of valid entries in `cycles`.
+    pub count: u32,
+    /// Raw cycle counts indexed by boot stage.
+    pub cycles: [u32; BootTiming::STAGE_COUNT],
+}
+
+impl TryFrom<&[u8]> for BootTiming {
+    type Error = ChipDataError;
+    fn try_from(buf: &[u8]) -> std::result::Result<Self, Self::Error> {
+        if buf.len() < Self::SIZE {
+            return Err(ChipDataError::BadSize(Self::SIZE, buf.len()));
+        }
+        let mut reader = std::io::Cursor::new(buf);
+        let mut val = BootTiming {
+            identifier: reader.read_u32::<LittleEndian>()?,
+            count: reader.read_u32::<LittleEndian>()?,
+            ..Default::default()
+        };
+        if val.identifier != Self::IDENTIFIER {
+            return Err(anyhow!("bad boot timing identifier: {:#x}", val.identifier).into());
+        }
+        reader.read_u32_into::<LittleEndian>(&mut val.cycles)?;
+        Ok(val)
+    }
+}
+
+impl BootTiming {
+    pub const SIZE: usize = 64;
+    pub const STAGE_COUNT: usize = 14;
+    pub const IDENTIFIER: u32 = u32::from_le_bytes(*b"BTIM");
+
+    /// Returns the stages that were reached on this boot along with the
+    /// number of cycles spent since the previous reached stage.
+    pub fn stages(&self) -> Result<Vec<BootTimingStage>> {
+        let count = usize::try_from(self.count)?.min(Self::STAGE_COUNT);
+        let mut prev = 0u32;
+        let mut stages = Vec::new();
+        for (name, &cycles) in BOOT_TIMING_STAGES.iter().zip(&self.cycles[..count]) {
+            if cycles == 0 {
+                continue;
+            }
+            stages.push(BootTimingStage {
+                name: name.to_string(),
+                cycles,
+                delta: cycles.wrapping_sub(prev),
+            });
+            prev = cycles;
+        }
+        Ok(stages)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_boot_timing_parse() -> Result<()> {
+        let mut buf = Vec::new();
+        buf.extend_from_slice(b"BTIM");
+        buf.extend_from_slice(&14u32.to_le_bytes());
+        for i in 0..BootTiming::STAGE_COUNT as u32 {
+            // Leave RomBootPolicy unrecorded.
+            let cycles = if i == 4 { 0 } else { (i + 1) * 100 };
+            buf.extend_from_slice(&cycles.to_le_bytes());
+        }
+        let timing = BootTiming::try_from(buf.as_slice())?;
+        assert_eq!(timing.identifier, BootTiming::IDENTIFIER);
+        assert_eq!(timing.cycles[13], 1400);
+
+        let stages = timing.stages()?;
+        assert_eq!(stages.len(), 13);
+        assert_eq!(stages[0].name, "RomStart");
+        assert_eq!(stages[0].delta, 100);
+        assert_eq!(stages[4].name, "RomVerify");
+        assert_eq!(stages[4].delta, 200);
+        Ok(())
+    }
+
+    #[test]
+    fn test_boot_timing_bad_identifier() {
+        let buf = [0u8; BootTiming::SIZE];
+        assert!(BootTiming::try_from(&buf[..]).is_err());
+    }
+}
@@ -7,6 +7,7 @@ use thiserror::Error;
 pub mod boolean;
 pub mod boot_log;
 pub mod boot_svc;
+pub mod boot_timing;
 pub mod device_id;
 pub mod helper;
 pub mod rom_error;
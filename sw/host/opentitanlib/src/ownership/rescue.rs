@@ -33,6 +33,7 @@ with_unknown! {
         RescueB = u32::from_be_bytes(*b"RESB"),
         Reboot = u32::from_be_bytes(*b"REBO"),
         GetBootLog = u32::from_be_bytes(*b"BLOG"),
+        GetBootTiming = u32::from_be_bytes(*b"BTIM"),
         BootSvcReq = u32::from_be_bytes(*b"BREQ"),
         BootSvcRsp = u32::from_be_bytes(*b"BRSP"),
         OwnerBlock = u32::from_be_bytes(*b"OWNR"),
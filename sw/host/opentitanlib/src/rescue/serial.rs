@@ -9,6 +9,7 @@ use std::time::Duration;
 use crate::app::TransportWrapper;
 use crate::chip::boot_log::BootLog;
 use crate::chip::boot_svc::{BootSlot, BootSvc, OwnershipActivateRequest, OwnershipUnlockRequest};
+use crate::chip::boot_timing::BootTiming;
 use crate::chip::device_id::DeviceId;
 use crate::io::uart::Uart;
 use crate::rescue::RescueError;
@@ -28,6 +29,7 @@ impl RescueSerial {
     pub const REBOOT: [u8; 4] = *b"REBO";
     pub const BAUD: [u8; 4] = *b"BAUD";
     pub const BOOT_LOG: [u8; 4] = *b"BLOG";
+    pub const BOOT_TIMING: [u8; 4] = *b"BTIM";
     pub const BOOT_SVC_REQ: [u8; 4] = *b"BREQ";
     pub const BOOT_SVC_RSP: [u8; 4] = *b"BRSP";
     pub const OWNER_BLOCK: [u8; 4] = *b"OWNR";
@@ -150,6 +152,11 @@ impl RescueSerial {
         Ok(BootLog::try_from(blog.as_slice())?)
     }
 
+    pub fn get_boot_timing(&self) -> Result<BootTiming> {
+        let btim = self.get_raw(Self::BOOT_TIMING)?;
+        Ok(BootTiming::try_from(btim.as_slice())?)
+    }
+
     pub fn get_boot_svc(&self) -> Result<BootSvc> {
         let bsvc = self.get_raw(Self::BOOT_SVC_RSP)?;
         Ok(BootSvc::try_from(bsvc.as_slice())?)
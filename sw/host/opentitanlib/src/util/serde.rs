@@ -69,3 +69,65 @@ where
     }
     deserializer.deserialize_any(StringOrStruct(PhantomData))
 }
+
+/// Serialize and deserialize byte arrays as base64 strings.
+///
+/// This is the host side of ujson `ujson_blob_t` array fields, which the device
+/// sends as base64 strings rather than lists of integers. Use it with
+/// `#[serde(with = "opentitanlib::util::serde::base64_arrayvec")]` on an
+/// `ArrayVec<u8, N>` field.
+pub mod base64_arrayvec {
+    use arrayvec::ArrayVec;
+    use base64ct::{Base64, Encoding};
+    use serde::{Deserialize, Deserializer, Serializer, de};
+
+    pub fn serialize<S, const N: usize>(
+        data: &ArrayVec<u8, N>,
+        serializer: S,
+    ) -> Result<S::Ok, S::Error>
+    where
+        S: Serializer,
+    {
+        serializer.serialize_str(&Base64::encode_string(data))
+    }
+
+    pub fn deserialize<'de, D, const N: usize>(deserializer: D) -> Result<ArrayVec<u8, N>, D::Error>
+    where
+        D: Deserializer<'de>,
+    {
+        let s = String::deserialize(deserializer)?;
+        let data = Base64::decode_vec(&s).map_err(de::Error::custom)?;
+        ArrayVec::try_from(data.as_slice()).map_err(|_| {
+            de::Error::custom(format!("expected at most {N} bytes, got {}", data.len()))
+        })
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use super::*;
+    use arrayvec::ArrayVec;
+    use serde::Serialize;
+
+    #[derive(Debug, PartialEq, Serialize, Deserialize)]
+    struct Blob {
+        #[serde(with = "base64_arrayvec")]
+        data: ArrayVec<u8, 8>,
+    }
+
+    #[test]
+    fn test_base64_arrayvec() -> anyhow::Result<()> {
+        let blob = Blob {
+            data: ArrayVec::try_from(&b"foobar"[..])?,
+        };
+        let json = serde_json::to_string(&blob)?;
+        assert_eq!(json, r#"{"data":"Zm9vYmFy"}"#);
+        assert_eq!(serde_json::from_str::<Blob>(&json)?, blob);
+
+        // Too long for the array.
+        assert!(serde_json::from_str::<Blob>(r#"{"data":"Zm9vYmFyYmF6"}"#).is_err());
+        // Not base64.
+        assert!(serde_json::from_str::<Blob>(r#"{"data":"Zm9v!"}"#).is_err());
+        Ok(())
+    }
+}
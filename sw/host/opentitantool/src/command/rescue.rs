@@ -155,6 +155,40 @@ impl CommandDispatch for GetBootLog {
     }
 }
 
+#[derive(Debug, Args)]
+pub struct GetBootTiming {
+    #[command(flatten)]
+    params: UartParams,
+    #[arg(
+        long,
+        default_value_t = true,
+        action = clap::ArgAction::Set,
+        help = "Reset the target to enter rescue mode"
+    )]
+    reset_target: bool,
+    #[arg(long, short, default_value = "false")]
+    raw: bool,
+}
+
+impl CommandDispatch for GetBootTiming {
+    fn run(
+        &self,
+        _context: &dyn Any,
+        transport: &TransportWrapper,
+    ) -> Result<Option<Box<dyn erased_serde::Serialize>>> {
+        let uart = self.params.create(transport)?;
+        let rescue = RescueSerial::new(uart);
+        rescue.enter(transport, self.reset_target)?;
+        if self.raw {
+            let data = rescue.get_raw(RescueSerial::BOOT_TIMING)?;
+            Ok(Some(Box::new(RawBytes(data))))
+        } else {
+            let data = rescue.get_boot_timing()?;
+            Ok(Some(Box::new(data.stages()?)))
+        }
+    }
+}
+
 #[derive(Debug, Args)]
 pub struct GetBootSvc {
     #[command(flatten)]
@@ -507,6 +541,7 @@ pub enum RescueCommand {
     BootSvc(BootSvcCommand),
     EraseOwner(EraseOwner),
     GetBootLog(GetBootLog),
+    GetBootTiming(GetBootTiming),
     GetDeviceId(GetDeviceId),
     Firmware(Firmware),
     SetOwnerConfig(SetOwnerConfig),
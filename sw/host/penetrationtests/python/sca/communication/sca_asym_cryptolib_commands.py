@@ -231,6 +231,31 @@ class OTAsymCrypto:
         }
         self.target.write(json.dumps(input_data).encode("ascii"))
 
+    def handle_p256_ecdh_fvsr(
+        self, private_key, public_x, public_y, cfg, trigger, num_iterations
+    ) -> None:
+        """Call the cryptolib p256 ecdh in fixed-vs-random batch mode.
+
+        Args:
+            private_key: Array of 32 bytes of fixed scalar data.
+            public_x: Array of 32 bytes of x-coord data.
+            public_y: Array of 32 bytes of y-coord data.
+            cfg: Integer for configuration.
+            trigger: Integer specifying which triggers to set.
+            num_iterations: Number of segments in the batching.
+        """
+        self._ujson_asym_crypto_sca_cmd()
+        self.target.write(json.dumps("P256EcdhFvsr").encode("ascii"))
+        input_data = {
+            "private_key": private_key,
+            "public_x": public_x,
+            "public_y": public_y,
+            "cfg": cfg,
+            "num_iterations": num_iterations,
+            "trigger": trigger,
+        }
+        self.target.write(json.dumps(input_data).encode("ascii"))
+
     def handle_p256_sign(self, scalar, pubx, puby, message, cfg, trigger) -> None:
         """Call the cryptolib p256 signing.
 
@@ -254,6 +279,33 @@ class OTAsymCrypto:
         }
         self.target.write(json.dumps(input_data).encode("ascii"))
 
+    def handle_p256_sign_fvsr(
+        self, scalar, pubx, puby, message, cfg, trigger, num_iterations
+    ) -> None:
+        """Call the cryptolib p256 signing in fixed-vs-random batch mode.
+
+        Args:
+            scalar: Array of 32 bytes of scalar data.
+            pubx: Array of 32 bytes of x-coord data.
+            puby: Array of 32 bytes of y-coord data.
+            message: Array of 32 bytes of fixed message data.
+            cfg: Integer for configuration.
+            trigger: Integer specifying which triggers to set.
+            num_iterations: Number of segments in the batching.
+        """
+        self._ujson_asym_crypto_sca_cmd()
+        self.target.write(json.dumps("P256SignFvsr").encode("ascii"))
+        input_data = {
+            "scalar": scalar,
+            "pubx": pubx,
+            "puby": puby,
+            "message": message,
+            "cfg": cfg,
+            "num_iterations": num_iterations,
+            "trigger": trigger,
+        }
+        self.target.write(json.dumps(input_data).encode("ascii"))
+
     def handle_p384_base_mult_fvsr(self, scalar, cfg, trigger, num_iterations) -> None:
         """Call the cryptolib p384 base multiplication.
 
@@ -136,6 +136,25 @@ class OTOTBN:
         data = {"msg": msg, "d0": d0, "ko": k0}
         self.target.write(json.dumps(data).encode("ascii"))
 
+    def rsa512_decrypt_fvsr_batch(self, num_traces: int, modu, exp, msg):
+        """Starts the Rsa512DecryptFvsrBatch test on OTBN.
+        Args:
+            num_traces: Number of batch operations.
+            modu: Modulus array (64xuint8_t)
+            exp: Private exponent array (64xuint8_t)
+            msg: Fixed message array (64xuint8_t)
+        """
+        # OtbnSca command.
+        self._ujson_otbn_sca_cmd()
+        # Start the Rsa512DecryptFvsrBatch test.
+        self.target.write(json.dumps("Rsa512DecryptFvsrBatch").encode("ascii"))
+        # Configure number of traces.
+        num_traces = {"num_traces": num_traces}
+        self.target.write(json.dumps(num_traces).encode("ascii"))
+        # Send modu, exp, and msg.
+        data = {"modu": modu, "exp": exp, "msg": msg}
+        self.target.write(json.dumps(data).encode("ascii"))
+
     def start_combi_ops_batch(
         self, num_iterations, fixed_data1, fixed_data2, print_flag, trigger
     ):
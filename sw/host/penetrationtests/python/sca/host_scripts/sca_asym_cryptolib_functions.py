@@ -248,6 +248,42 @@ def char_p256_ecdh(
     return response
 
 
+def char_p256_ecdh_fvsr(
+    target,
+    iterations,
+    private_key,
+    public_x,
+    public_y,
+    cfg,
+    trigger,
+    num_iterations,
+    reset=False,
+):
+    asymsca = OTAsymCrypto(target)
+    if reset:
+        target.reset_target()
+        # Clear the output from the reset
+        target.dump_all()
+    # Initialize our chip and catch its output
+    device_id, owner_page, boot_log, boot_measurements, version = (
+        asymsca.init()
+    )
+    # Set the internal prng
+    ot_prng = OTPRNG(target=target)
+    ot_prng.seed_prng([1, 0, 0, 0])
+    for _ in range(iterations):
+        asymsca.handle_p256_ecdh_fvsr(
+            private_key,
+            public_x,
+            public_y,
+            cfg,
+            trigger,
+            num_iterations
+        )
+        response = target.read_response()
+    return response
+
+
 def char_p256_sign(
     target,
     iterations,
@@ -281,6 +317,44 @@ def char_p256_sign(
     return response
 
 
+def char_p256_sign_fvsr(
+    target,
+    iterations,
+    scalar,
+    pubx,
+    puby,
+    message,
+    cfg,
+    trigger,
+    num_iterations,
+    reset=False,
+):
+    asymsca = OTAsymCrypto(target)
+    if reset:
+        target.reset_target()
+        # Clear the output from the reset
+        target.dump_all()
+    # Initialize our chip and catch its output
+    device_id, owner_page, boot_log, boot_measurements, version = (
+        asymsca.init()
+    )
+    # Set the internal prng
+    ot_prng = OTPRNG(target=target)
+    ot_prng.seed_prng([1, 0, 0, 0])
+    for _ in range(iterations):
+        asymsca.handle_p256_sign_fvsr(
+            scalar,
+            pubx,
+            puby,
+            message,
+            cfg,
+            trigger,
+            num_iterations
+        )
+        response = target.read_response()
+    return response
+
+
 def char_p384_base_mult_fvsr(
     target,
     iterations,
@@ -3,6 +3,7 @@
 # SPDX-License-Identifier: Apache-2.0
 
 from sw.host.penetrationtests.python.sca.communication.sca_otbn_commands import OTOTBN
+from sw.host.penetrationtests.python.sca.communication.sca_prng_commands import OTPRNG
 
 
 def char_combi_operations_batch(
@@ -28,3 +29,28 @@ def char_combi_operations_batch(
         )
         response = target.read_response()
     return response
+
+
+def char_rsa512_decrypt_fvsr_batch(
+    target,
+    iterations,
+    num_segments,
+    modu,
+    exp,
+    msg,
+    reset = False
+):
+    otbnsca = OTOTBN(target)
+    if reset:
+        target.reset_target()
+        # Clear the output from the reset
+        target.dump_all()
+    # Initialize our chip and catch its output
+    device_id, owner_page, boot_log, boot_measurements, version = otbnsca.init()
+    # Set the internal prng
+    ot_prng = OTPRNG(target=target)
+    ot_prng.seed_prng([1, 0, 0, 0])
+    for _ in range(iterations):
+        otbnsca.rsa512_decrypt_fvsr_batch(num_segments, modu, exp, msg)
+        response = target.read_response()
+    return response
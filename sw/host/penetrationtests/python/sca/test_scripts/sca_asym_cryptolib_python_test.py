@@ -205,6 +205,55 @@ class AsymCryptoScaTest(unittest.TestCase):
             actual_result_json, expected_result_json, ignored_keys_set
         )
 
+    def test_char_p256_ecdh_fvsr(self):
+        for num_segments in num_segments_list:
+            private_key = ECC.generate(curve="P-256")
+            private_key_array = [x for x in private_key.d.to_bytes(32, "little")]
+            key = ECC.generate(curve="P-256")
+            public_point = key.pointQ
+            public_x = [x for x in public_point.x.to_bytes(32, "little")]
+            public_y = [x for x in public_point.y.to_bytes(32, "little")]
+            cfg = 0
+            trigger = 0
+
+            actual_result = sca_asym_cryptolib_functions.char_p256_ecdh_fvsr(
+                target,
+                iterations,
+                private_key_array,
+                public_x,
+                public_y,
+                cfg,
+                trigger,
+                num_segments,
+            )
+            actual_result_json = json.loads(actual_result)
+
+            # Seed the synchronized randomness with the same seed as in the chip which is 1
+            random.seed(1)
+
+            # Generate the batch data and XOR the shared keys of the last batch
+            for _ in range(iterations):
+                shared_key = 0
+                sample_fixed = True
+                for __ in range(num_segments):
+                    if sample_fixed:
+                        batch_private_key = private_key_array
+                    else:
+                        batch_private_key = [random.randint(0, 255) for _ in range(32)]
+                    sample_fixed = random.randint(0, 255) & 0x1
+                    d = int.from_bytes(bytes(batch_private_key), "little")
+                    shared_key ^= int((public_point * d).x)
+
+            expected_result_json = {
+                "status": 0,
+                "shared_key": [x for x in shared_key.to_bytes(32, "little")],
+                "cfg": 0,
+            }
+
+            utils.compare_json_data(
+                actual_result_json, expected_result_json, ignored_keys_set
+            )
+
     def test_char_p256_sign(self):
         key = ECC.generate(curve="P-256")
         scalar = [x for x in key.d.to_bytes(32, "little")]
@@ -251,6 +300,69 @@ class AsymCryptoScaTest(unittest.TestCase):
         signature = r + s
         verifier.verify(h, bytes(signature))
 
+    def test_char_p256_sign_fvsr(self):
+        for num_segments in num_segments_list:
+            key = ECC.generate(curve="P-256")
+            scalar = [x for x in key.d.to_bytes(32, "little")]
+            pubx = [x for x in key.pointQ.x.to_bytes(32, "little")]
+            puby = [x for x in key.pointQ.y.to_bytes(32, "little")]
+            message = [random.randint(0, 255) for _ in range(16)]
+            message_digest = [x for x in SHA256.new(bytes(message)).digest()]
+            cfg = 0
+            trigger = 0
+
+            actual_result = sca_asym_cryptolib_functions.char_p256_sign_fvsr(
+                target,
+                iterations,
+                scalar,
+                pubx,
+                puby,
+                message_digest,
+                cfg,
+                trigger,
+                num_segments,
+            )
+            actual_result_json = json.loads(actual_result)
+
+            sign_ignored_keys_set = ignored_keys_set.copy()
+            sign_ignored_keys_set.add("r")
+            sign_ignored_keys_set.add("s")
+            sign_ignored_keys_set.add("pubx")
+            sign_ignored_keys_set.add("puby")
+
+            expected_result_json = {
+                "status": 0,
+                "cfg": 0,
+            }
+
+            utils.compare_json_data(
+                actual_result_json, expected_result_json, sign_ignored_keys_set
+            )
+
+            # Seed the synchronized randomness with the same seed as in the chip which is 1
+            random.seed(1)
+
+            # The returned signature is over the last message of the last batch
+            for _ in range(iterations):
+                sample_fixed = True
+                for __ in range(num_segments):
+                    if sample_fixed:
+                        batch_message = message_digest
+                    else:
+                        batch_message = [random.randint(0, 255) for _ in range(32)]
+                    sample_fixed = random.randint(0, 255) & 0x1
+
+            # Verify the signature on the raw digest, as random messages have
+            # no preimage to hand to DSS.
+            n = 0xFFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551
+            generator = ECC.construct(curve="P-256", d=1).pointQ
+            r = int.from_bytes(bytes(actual_result_json["r"]), "little")
+            s = int.from_bytes(bytes(actual_result_json["s"]), "little")
+            e = int.from_bytes(bytes(batch_message), "big")
+            w = pow(s, -1, n)
+            point = generator * (e * w % n) + key.pointQ * (r * w % n)
+            self.assertEqual(int(point.x) % n, r)
+
     def test_char_p384_ecdh(self):
         private_key = ECC.generate(curve="P-384")
         private_key_array = [x for x in private_key.d.to_bytes(48, "little")]
@@ -349,6 +349,47 @@ class OtbnScaTest(unittest.TestCase):
                 actual_result_json, expected_result_json, ignored_keys_set
             )
 
+    def test_char_rsa512_decrypt_fvsr_batch(self):
+        for num_segments in num_segments_list:
+            # An odd 512-bit modulus with the top bit set, and a fixed message
+            # below it.
+            modu = random.getrandbits(512) | (1 << 511) | 1
+            exp = random.getrandbits(512)
+            msg = random.getrandbits(504)
+            actual_result = sca_otbn_functions.char_rsa512_decrypt_fvsr_batch(
+                target,
+                iterations,
+                num_segments,
+                [x for x in modu.to_bytes(64, "little")],
+                [x for x in exp.to_bytes(64, "little")],
+                [x for x in msg.to_bytes(64, "little")],
+            )
+            actual_result_json = json.loads(actual_result)
+
+            # Seed the synchronized randomness with the same seed as in the chip which is 1
+            random.seed(1)
+
+            # Generate the batch data and XOR the results of the last batch
+            for _ in range(iterations):
+                result = 0
+                sample_fixed = True
+                for __ in range(num_segments):
+                    if sample_fixed:
+                        batch_msg = msg
+                    else:
+                        words = [random.getrandbits(32) for _ in range(16)]
+                        words[15] &= 0x00FFFFFF
+                        batch_msg = utils.array_to_int(words)
+                    sample_fixed = random.getrandbits(32) & 0x1
+                    result ^= pow(batch_msg, exp, modu)
+
+            expected_result_json = {
+                "out": [x for x in result.to_bytes(64, "little")],
+            }
+            utils.compare_json_data(
+                actual_result_json, expected_result_json, ignored_keys_set
+            )
+
 
 if __name__ == "__main__":
     r = Runfiles.Create()
@@ -23,9 +23,9 @@ use std::time::Duration;
 
 use cryptotest_commands::commands::CryptotestCommand;
 use cryptotest_commands::ecdsa_commands::{
-    CryptotestEcdsaCoordinate, CryptotestEcdsaCurve, CryptotestEcdsaHashAlg,
+    CryptotestEcdsaBatch, CryptotestEcdsaCoordinate, CryptotestEcdsaCurve, CryptotestEcdsaHashAlg,
     CryptotestEcdsaMessage, CryptotestEcdsaOperation, CryptotestEcdsaPrivateKey,
-    CryptotestEcdsaSignature, CryptotestEcdsaVerifyOutput,
+    CryptotestEcdsaSignature, CryptotestEcdsaVerifyBatchOutput, CryptotestEcdsaVerifyOutput,
 };
 
 use opentitanlib::app::TransportWrapper;
@@ -46,6 +46,12 @@ struct Opts {
 
     #[arg(long, num_args = 1..)]
     ecdsa_json: Vec<String>,
+
+    // Maximum number of verify vectors sent in one batch command. Consecutive
+    // verify vectors that share a curve, hash and public key are batched; a
+    // value of 1 sends every vector as its own command.
+    #[arg(long, default_value_t = ECDSA_CMD_MAX_BATCH_VECTORS)]
+    batch_size: usize,
 }
 
 fn scalar_zero() -> String {
@@ -76,6 +82,7 @@ const ECDSA_CMD_MAX_SIGNATURE_SCALAR_BYTES_P256: usize = 32;
 const ECDSA_CMD_MAX_COORDINATE_BYTES_P256: usize = 32;
 const ECDSA_CMD_MAX_SIGNATURE_SCALAR_BYTES_P384: usize = 48;
 const ECDSA_CMD_MAX_COORDINATE_BYTES_P384: usize = 48;
+const ECDSA_CMD_MAX_BATCH_VECTORS: usize = 256;
 
 // These values were generated randomly for testing purposes.
 // Each value must be less than the modulus for its respective curve.
@@ -178,42 +185,14 @@ fn p384_verify_signature(
     .is_ok()
 }
 
-fn run_ecdsa_testcase(
+// Returns the ujson hash algorithm, the OID (if the RustCrypto verifier supports it) and the
+// digest of the test case's message.
+fn hash_message(
     test_case: &EcdsaTestCase,
-    opts: &Opts,
-    spi_console: &SpiConsoleDevice,
-    failures: &mut Vec<String>,
-) -> Result<()> {
-    log::info!(
-        "vendor: {}, test case: {}",
-        test_case.vendor,
-        test_case.test_case_id
-    );
-    assert_eq!(test_case.algorithm.as_str(), "ecdsa");
-    let mut qx: Vec<u8> = BigInt::from_str_radix(&test_case.qx, 16)
-        .unwrap()
-        .to_bytes_le()
-        .1;
-    let mut qy: Vec<u8> = BigInt::from_str_radix(&test_case.qy, 16)
-        .unwrap()
-        .to_bytes_le()
-        .1;
-    let r: Vec<u8> = BigInt::from_str_radix(&test_case.r, 16)
-        .unwrap()
-        .to_bytes_le()
-        .1;
-    let s: Vec<u8> = BigInt::from_str_radix(&test_case.s, 16)
-        .unwrap()
-        .to_bytes_le()
-        .1;
-
-    // Get the hash function and hash the message to get the digest (unfortunately this code is
-    // challenging to deduplicate because the `Digest` trait is not object safe).
-    let (hash_alg, hash_oid, message_digest): (
-        CryptotestEcdsaHashAlg,
-        Option<ObjectIdentifier>,
-        Vec<u8>,
-    ) = match test_case.hash_alg.as_str() {
+) -> (CryptotestEcdsaHashAlg, Option<ObjectIdentifier>, Vec<u8>) {
+    // Unfortunately this code is challenging to deduplicate because the `Digest` trait is not
+    // object safe.
+    match test_case.hash_alg.as_str() {
         "sha-256" => {
             let mut hasher = Sha256::new();
             hasher.update(test_case.message.as_slice());
@@ -269,7 +248,65 @@ fn run_ecdsa_testcase(
             )
         }
         _ => panic!("Invalid ECDSA hash mode"),
-    };
+    }
+}
+
+fn ecdsa_message(message_digest: &[u8]) -> CryptotestEcdsaMessage {
+    // Size of `input` is determined at compile-time by type inference
+    let mut input = ArrayVec::new();
+    // Fill the buffer until we run out of bytes, truncating the rightmost bytes if we have too
+    // many
+    let mut message_digest_iter = message_digest.iter();
+    while !input.is_full() {
+        input.push(*message_digest_iter.next().unwrap_or(&0u8));
+    }
+    CryptotestEcdsaMessage {
+        input,
+        input_len: message_digest.len(),
+    }
+}
+
+fn hex_to_le_bytes(hex: &str) -> Vec<u8> {
+    BigInt::from_str_radix(hex, 16).unwrap().to_bytes_le().1
+}
+
+fn check_result(test_case: &EcdsaTestCase, success: bool, failures: &mut Vec<String>) {
+    if test_case.result != success {
+        log::info!(
+            "FAILED test #{}: expected = {}, actual = {}",
+            test_case.test_case_id,
+            test_case.result,
+            success
+        );
+        failures.push(format!(
+            "{} {} {} {} #{}",
+            test_case.vendor,
+            test_case.curve,
+            test_case.operation,
+            test_case.hash_alg,
+            test_case.test_case_id
+        ));
+    }
+}
+
+fn run_ecdsa_testcase(
+    test_case: &EcdsaTestCase,
+    opts: &Opts,
+    spi_console: &SpiConsoleDevice,
+    failures: &mut Vec<String>,
+) -> Result<()> {
+    log::info!(
+        "vendor: {}, test case: {}",
+        test_case.vendor,
+        test_case.test_case_id
+    );
+    assert_eq!(test_case.algorithm.as_str(), "ecdsa");
+    let mut qx = hex_to_le_bytes(&test_case.qx);
+    let mut qy = hex_to_le_bytes(&test_case.qy);
+    let r = hex_to_le_bytes(&test_case.r);
+    let s = hex_to_le_bytes(&test_case.s);
+
+    let (hash_alg, hash_oid, message_digest) = hash_message(test_case);
 
     // Determine the curve and check the lengths of the other arguments based on the curve choice.
     // Depending on our choice of curve, calculate the two components of the masked private key.
@@ -403,21 +440,7 @@ fn run_ecdsa_testcase(
     hash_alg.send(spi_console)?;
     curve.send(spi_console)?;
 
-    // Size of `input` is determined at compile-time by type inference
-    let mut input = ArrayVec::new();
-    // Fill the buffer until we run out of bytes, truncating the rightmost bytes if we have too
-    // many
-    let msg_len = message_digest.len();
-    let mut message_digest_iter = message_digest.iter();
-    while !input.is_full() {
-        input.push(*message_digest_iter.next().unwrap_or(&0u8));
-    }
-    // `unwrap()` operations are safe here because we checked the sizes above.
-    let msg = CryptotestEcdsaMessage {
-        input,
-        input_len: msg_len,
-    };
-    msg.send(spi_console)?;
+    ecdsa_message(&message_digest).send(spi_console)?;
 
     CryptotestEcdsaSignature {
         r: ArrayVec::try_from(r.as_slice()).unwrap(),
@@ -486,25 +509,102 @@ fn run_ecdsa_testcase(
                 }
             }
         }
-        CryptotestEcdsaOperation::IntValue(_) => {
+        CryptotestEcdsaOperation::VerifyBatch | CryptotestEcdsaOperation::IntValue(_) => {
             unreachable!("Should be caught above")
         }
     };
-    if test_case.result != success {
-        log::info!(
-            "FAILED test #{}: expected = {}, actual = {}",
+    check_result(test_case, success, failures);
+    Ok(())
+}
+
+// Returns true if `b` can be sent in the same verify batch as `a`.
+fn same_verify_key(a: &EcdsaTestCase, b: &EcdsaTestCase) -> bool {
+    a.curve == b.curve && a.hash_alg == b.hash_alg && a.qx == b.qx && a.qy == b.qy
+}
+
+// Verifies test cases that share a curve, hash and public key with a single `VerifyBatch`
+// command.
+fn run_ecdsa_verify_batch(
+    test_cases: &[&EcdsaTestCase],
+    opts: &Opts,
+    spi_console: &SpiConsoleDevice,
+    failures: &mut Vec<String>,
+) -> Result<()> {
+    let first = test_cases[0];
+    log::info!(
+        "vendor: {}, test cases: {}..={} (batch of {})",
+        first.vendor,
+        first.test_case_id,
+        test_cases[test_cases.len() - 1].test_case_id,
+        test_cases.len()
+    );
+    let (curve, max_coordinate_bytes, max_scalar_bytes) = match first.curve.as_str() {
+        "p256" => (
+            CryptotestEcdsaCurve::P256,
+            ECDSA_CMD_MAX_COORDINATE_BYTES_P256,
+            ECDSA_CMD_MAX_SIGNATURE_SCALAR_BYTES_P256,
+        ),
+        "p384" => (
+            CryptotestEcdsaCurve::P384,
+            ECDSA_CMD_MAX_COORDINATE_BYTES_P384,
+            ECDSA_CMD_MAX_SIGNATURE_SCALAR_BYTES_P384,
+        ),
+        _ => panic!("Invalid ECDSA curve name"),
+    };
+    let qx = hex_to_le_bytes(&first.qx);
+    let qy = hex_to_le_bytes(&first.qy);
+    assert!(
+        qx.len() <= max_coordinate_bytes && qy.len() <= max_coordinate_bytes,
+        "ECDSA public key was too long for curve {}",
+        first.curve,
+    );
+    let (hash_alg, _, _) = hash_message(first);
+
+    CryptotestCommand::Ecdsa.send(spi_console)?;
+    CryptotestEcdsaOperation::VerifyBatch.send(spi_console)?;
+    hash_alg.send(spi_console)?;
+    curve.send(spi_console)?;
+    CryptotestEcdsaCoordinate {
+        coordinate: ArrayVec::try_from(qx.as_slice()).unwrap(),
+        coordinate_len: qx.len(),
+    }
+    .send(spi_console)?;
+    CryptotestEcdsaCoordinate {
+        coordinate: ArrayVec::try_from(qy.as_slice()).unwrap(),
+        coordinate_len: qy.len(),
+    }
+    .send(spi_console)?;
+    CryptotestEcdsaBatch {
+        count: test_cases.len(),
+    }
+    .send(spi_console)?;
+
+    for test_case in test_cases {
+        assert_eq!(test_case.algorithm.as_str(), "ecdsa");
+        let r = hex_to_le_bytes(&test_case.r);
+        let s = hex_to_le_bytes(&test_case.s);
+        assert!(
+            r.len() <= max_scalar_bytes && s.len() <= max_scalar_bytes,
+            "ECDSA signature was too long for curve {} (test case #{})",
+            test_case.curve,
             test_case.test_case_id,
-            test_case.result,
-            success
         );
-        failures.push(format!(
-            "{} {} {} {} #{}",
-            test_case.vendor,
-            test_case.curve,
-            test_case.operation,
-            test_case.hash_alg,
-            test_case.test_case_id
-        ));
+        let (_, _, message_digest) = hash_message(test_case);
+        ecdsa_message(&message_digest).send(spi_console)?;
+        CryptotestEcdsaSignature {
+            r: ArrayVec::try_from(r.as_slice()).unwrap(),
+            r_len: r.len(),
+            s: ArrayVec::try_from(s.as_slice()).unwrap(),
+            s_len: s.len(),
+        }
+        .send(spi_console)?;
+    }
+
+    let output = CryptotestEcdsaVerifyBatchOutput::recv(spi_console, opts.timeout, false)?;
+    assert_eq!(output.count, test_cases.len());
+    for (i, test_case) in test_cases.iter().enumerate() {
+        let success = output.passed[i / 8] & (1 << (i % 8)) != 0;
+        check_result(test_case, success, failures);
     }
     Ok(())
 }
@@ -521,10 +621,27 @@ fn test_ecdsa(opts: &Opts, transport: &TransportWrapper) -> Result<()> {
         let raw_json = fs::read_to_string(file)?;
         let ecdsa_tests: Vec<EcdsaTestCase> = serde_json::from_str(&raw_json)?;
 
+        let batch_size = opts.batch_size.clamp(1, ECDSA_CMD_MAX_BATCH_VECTORS);
+        let mut batch: Vec<&EcdsaTestCase> = Vec::new();
         for ecdsa_test in &ecdsa_tests {
             test_counter += 1;
             log::info!("Test counter: {}", test_counter);
-            run_ecdsa_testcase(ecdsa_test, opts, &spi_console_device, &mut failures)?;
+            if batch_size == 1 || ecdsa_test.operation != "verify" {
+                run_ecdsa_testcase(ecdsa_test, opts, &spi_console_device, &mut failures)?;
+                continue;
+            }
+            if batch.len() == batch_size
+                || batch
+                    .first()
+                    .is_some_and(|first| !same_verify_key(first, ecdsa_test))
+            {
+                run_ecdsa_verify_batch(&batch, opts, &spi_console_device, &mut failures)?;
+                batch.clear();
+            }
+            batch.push(ecdsa_test);
+        }
+        if !batch.is_empty() {
+            run_ecdsa_verify_batch(&batch, opts, &spi_console_device, &mut failures)?;
         }
     }
     assert_eq!(
@@ -11,6 +11,7 @@
  *   2. MODE_ATTESTATION_KEYGEN: Derive a new attestation keypair (ECDSA-P256).
  *   3. MODE_ATTESTATION_ENDORSE: Sign with a saved attestation signing key.
  *   4. MODE_ATTESTATION_KEY_SAVE: Save an attestation signing key.
+ *   5. MODE_SIGVERIFY_BATCH: ECDSA-P256 verification of several signatures.
  *
  * Ibex will run `MODE_SEC_BOOT_MODEXP` as part of checking the code
  * signature of the next boot stage. This mode doesn't interact or interfere
@@ -46,7 +47,7 @@
 
 /**
  * Mode magic values, generated with
- * $ ./util/design/sparse-fsm-encode.py -d 6 -m 4 -n 11 --avoid-zero -s 3357382482
+ * $ ./util/design/sparse-fsm-encode.py -d 6 -m 5 -n 11 --avoid-zero -s 3357382482
  *
  * Call the same utility with the same arguments and a higher -m to generate
  * additional value(s) without changing the others or sacrificing mutual HD.
@@ -60,6 +61,12 @@
 .equ MODE_ATTESTATION_KEYGEN, 0x2bf
 .equ MODE_ATTESTATION_ENDORSE, 0x5e8
 .equ MODE_ATTESTATION_KEY_SAVE, 0x64d
+.equ MODE_SIGVERIFY_BATCH, 0x176
+
+/**
+ * Hardened boolean true; should match the value in `hardened_asm.h`.
+ */
+.equ HARDENED_BOOL_TRUE, 0x739
 
 .section .text.start
 start:
@@ -79,6 +86,9 @@ start:
   addi  x3, x0, MODE_ATTESTATION_KEY_SAVE
   beq   x2, x3, attestation_key_save
 
+  addi  x3, x0, MODE_SIGVERIFY_BATCH
+  beq   x2, x3, sigverify_batch
+
   /* Invalid mode; fail. */
 start_failed:
   unimp
@@ -114,6 +124,119 @@ sigverify:
 
   ecall
 
+/**
+ * Batched ECDSA-P256 signature verification.
+ *
+ * Verifies the entries `batch_next` to `batch_num - 1` of `batch` in a single
+ * run. Each entry holds a message digest, a signature and a public key in the
+ * same format as the inputs of `sigverify`. For every entry that passes the
+ * basic validity checks, the computed `x_r` overwrites the message digest of
+ * that entry; all other entries are left unchanged. As for `sigverify`, the
+ * final comparison of `x_r` against `r` has to be performed on the host side,
+ * which must treat a digest that was not overwritten as a failure.
+ *
+ * If an entry fails the basic validity checks, the program ends early with
+ * `ok` set to false and `batch_next` holding the index of that entry. The
+ * caller may then resume the batch with the next entry without reloading the
+ * program. Once all entries are processed, `ok` is set to true and
+ * `batch_next` is equal to `batch_num`.
+ *
+ * @param[in]  dmem[batch_num]: number of entries K, at most 3 (32 bits)
+ * @param[in]  dmem[batch_next]: index of the first entry to verify (32 bits)
+ * @param[in]  dmem[batch]: K entries of (msg, r, s, x, y), 160 bytes each
+ * @param[out] dmem[batch]: msg of each processed entry replaced by its x_r
+ * @param[out] dmem[batch_next]: index of the last processed entry, or K
+ * @param[out] dmem[ok]: success/failure of basic checks (32 bits)
+ */
+sigverify_batch:
+  /* Load the number of entries and the start index.
+       x24 <= K = dmem[batch_num]
+       x23 <= i = dmem[batch_next] */
+  la       x2, batch_num
+  lw       x24, 0(x2)
+  la       x2, batch_next
+  lw       x23, 0(x2)
+
+  /* Fail if K > 3 or i > K. */
+  andi     x3, x24, -4
+  bne      x3, x0, start_failed
+  sub      x3, x24, x23
+  andi     x3, x3, -4
+  bne      x3, x0, start_failed
+
+sigverify_batch_loop:
+  /* Stop once all entries are processed. */
+  beq      x23, x24, sigverify_batch_done
+
+  /* Record the index of the current entry.
+       dmem[batch_next] <= i */
+  la       x2, batch_next
+  sw       x23, 0(x2)
+
+  /* Load entry i.
+       x3 <= batch + 160*i
+       w0, w1, w2, w3, w4 <= msg, r, s, x, y */
+  slli     x3, x23, 7
+  slli     x2, x23, 5
+  add      x3, x3, x2
+  la       x2, batch
+  add      x3, x3, x2
+  li       x2, 0
+  bn.lid   x2++, 0(x3)
+  bn.lid   x2++, 32(x3)
+  bn.lid   x2++, 64(x3)
+  bn.lid   x2++, 96(x3)
+  bn.lid   x2, 128(x3)
+
+  /* Copy entry i to the single-signature buffers. */
+  li       x2, 0
+  la       x3, msg
+  bn.sid   x2++, 0(x3)
+  la       x3, r
+  bn.sid   x2++, 0(x3)
+  la       x3, s
+  bn.sid   x2++, 0(x3)
+  la       x3, x
+  bn.sid   x2++, 0(x3)
+  la       x3, y
+  bn.sid   x2, 0(x3)
+
+  /* Validate the public key (ends the program on failure). */
+  jal      x1, p256_check_public_key
+
+  /* Verify the signature (compute x_r; ends the program on failure). */
+  jal      x1, p256_verify
+
+  /* Store x_r of entry i in place of its message digest.
+       w0 <= x_r = dmem[x_r]
+       dmem[batch + 160*i] <= w0 */
+  li       x2, 0
+  la       x3, x_r
+  bn.lid   x2, 0(x3)
+  slli     x3, x23, 7
+  slli     x2, x23, 5
+  add      x3, x3, x2
+  la       x2, batch
+  add      x3, x3, x2
+  li       x2, 0
+  bn.sid   x2, 0(x3)
+
+  addi     x23, x23, 1
+  jal      x0, sigverify_batch_loop
+
+sigverify_batch_done:
+  /* Record that all entries are processed.
+       dmem[batch_next] <= K */
+  la       x2, batch_next
+  sw       x23, 0(x2)
+
+  /* Set `ok` to true. */
+  la       x2, ok
+  addi     x3, x0, HARDENED_BOOL_TRUE
+  sw       x3, 0(x2)
+
+  ecall
+
 /**
  * Generate an attestation keypair from a sideloaded seed.
  *
@@ -141,9 +264,7 @@ attestation_keygen:
   bn.mov    w2, w10
   bn.mov    w1, w21
   bn.mov    w3, w11
-  la        x21, p256_gx
-  la        x22, p256_gy
-  jal       x1, scalar_mult_int
+  jal       x1, base_mult_int
 
   /* Convert masked result back to affine coordinates.
      R = (x_a, y_a) = (w11, w12) */
@@ -299,6 +420,18 @@ mode:
 ok:
   .zero 4
 
+/* Number of entries in the signature verification batch. */
+.globl batch_num
+.balign 4
+batch_num:
+  .zero 4
+
+/* Index of the next entry of the signature verification batch. */
+.globl batch_next
+.balign 4
+batch_next:
+  .zero 4
+
 /* Input buffer for an ECDSA-P256 message digest. */
 .globl msg
 .balign 32
@@ -335,6 +468,12 @@ y:
 x_r:
   .zero 32
 
+/* Signature verification batch; up to 3 entries of (msg, r, s, x, y). */
+.globl batch
+.balign 32
+batch:
+  .zero 480
+
 /* DRBG output to XOR with key manager seed. */
 .globl attestation_additional_seed
 .balign 32
@@ -8,6 +8,14 @@
  *   https://datatracker.ietf.org/doc/html/rfc8032
  */
 
+/**
+ * Hardened boolean values.
+ *
+ * Should match the values in `hardened_asm.h`.
+ */
+.equ HARDENED_BOOL_TRUE, 0x739
+.equ HARDENED_BOOL_FALSE, 0x1d4
+
 /**
  * Add two points in extended twisted Edwards coordinates.
  *
@@ -156,3 +164,963 @@ ext_add:
   bn.mov   w13, w22
 
   ret
+
+/**
+ * Double a point in extended twisted Edwards coordinates.
+ *
+ * Returns (X3, Y3, Z3, T3) = 2 * (X1, Y1, Z1, T1)
+ *
+ * Overwrites the operand with the result.
+ *
+ * This implementation closely follows RFC 8032, section 5.1.4:
+ *   https://datatracker.ietf.org/doc/html/rfc8032#section-5.1.4
+ *
+ * The dedicated doubling formula does not depend on T1 or on the curve
+ * constant d, and needs only 4 squarings and 4 multiplications:
+ *
+ *   A = X1^2
+ *   B = Y1^2
+ *   C = 2*Z1^2
+ *   H = A+B
+ *   E = H-(X1+Y1)^2
+ *   G = A-B
+ *   F = C+G
+ *   X3 = E*F
+ *   Y3 = G*H
+ *   T3 = E*H
+ *   Z3 = F*G
+ *
+ * In the formula above, all arithmetic (+, *, -) is modulo p=2^255-19.
+ *
+ * This routine runs in constant time.
+ *
+ * Flags: Flags have no meaning beyond the scope of this subroutine.
+ *
+ * @param[in]  w19: constant, 19
+ * @param[in]  MOD: p, modulus = 2^255 - 19
+ * @param[in]  w30: constant, 38
+ * @param[in]  w31: all-zero
+ * @param[in,out] w10: input X1 (X1 < p), output X3
+ * @param[in,out] w11: input Y1 (Y1 < p), output Y3
+ * @param[in,out] w12: input Z1 (Z1 < p), output Z3
+ * @param[in,out] w13: input T1 (T1 < p), output T3
+ *
+ * clobbered registers: w10 to w13, w17, w18, w20 to w23, w24 to w27
+ * clobbered flag groups: FG0
+ */
+.globl ext_double
+ext_double:
+  /* w22 <= X1^2 = A */
+  bn.mov   w22, w10
+  jal      x1, fe_square
+  /* w24 <= w22 = A */
+  bn.mov   w24, w22
+
+  /* w22 <= Y1^2 = B */
+  bn.mov   w22, w11
+  jal      x1, fe_square
+  /* w25 <= w22 = B */
+  bn.mov   w25, w22
+
+  /* w22 <= Z1^2 */
+  bn.mov   w22, w12
+  jal      x1, fe_square
+  /* w26 <= w22 + w22 = 2*Z1^2 = C */
+  bn.addm  w26, w22, w22
+
+  /* w27 <= w24 + w25 = A + B = H */
+  bn.addm  w27, w24, w25
+
+  /* w22 <= (X1 + Y1)^2 */
+  bn.addm  w22, w10, w11
+  jal      x1, fe_square
+  /* w13 <= w27 - w22 = H - (X1 + Y1)^2 = E */
+  bn.subm  w13, w27, w22
+
+  /* w24 <= w24 - w25 = A - B = G */
+  bn.subm  w24, w24, w25
+
+  /* w26 <= w26 + w24 = C + G = F */
+  bn.addm  w26, w26, w24
+
+  /* w10 <= E * F = X3 */
+  bn.mov   w22, w13
+  bn.mov   w23, w26
+  jal      x1, fe_mul
+  bn.mov   w10, w22
+
+  /* w12 <= F * G = Z3 */
+  bn.mov   w22, w24
+  jal      x1, fe_mul
+  bn.mov   w12, w22
+
+  /* w11 <= G * H = Y3 */
+  bn.mov   w22, w24
+  bn.mov   w23, w27
+  jal      x1, fe_mul
+  bn.mov   w11, w22
+
+  /* w13 <= E * H = T3 */
+  bn.mov   w22, w13
+  jal      x1, fe_mul
+  bn.mov   w13, w22
+
+  ret
+
+/**
+ * Decode a point from its 32-byte encoding.
+ *
+ * Returns the point (X, Y, Z, T) = (x, y, 1, x*y) in extended coordinates if
+ * the encoding is valid.
+ *
+ * This implementation follows RFC 8032, section 5.1.3:
+ *   https://datatracker.ietf.org/doc/html/rfc8032#section-5.1.3
+ *
+ * The encoding holds the y-coordinate in the lower 255 bits and the least
+ * significant bit of the x-coordinate in the most significant bit. The
+ * candidate square root of x^2 = u/v with u = y^2 - 1 and v = d*y^2 + 1 is
+ *
+ *   x = u * v^3 * (u * v^7)^((p-5)/8)
+ *
+ * If v*x^2 = u, then x is a square root. If v*x^2 = -u, then x*sqrt(-1) is a
+ * square root. Otherwise, u/v has no square root and the encoding is invalid.
+ * The encoding is also rejected if y >= p, or if x = 0 and the sign bit is 1.
+ *
+ * This routine runs in variable time and must only be used with public inputs.
+ *
+ * Flags: Flags have no meaning beyond the scope of this subroutine.
+ *
+ * @param[in]  x16: dptr_enc, pointer to the encoded point in dmem
+ * @param[in]  w19: constant, 19
+ * @param[in]  MOD: p, modulus = 2^255 - 19
+ * @param[in]  w30: constant, 38
+ * @param[in]  w31: all-zero
+ * @param[in]  dmem[dptr_enc..dptr_enc+32]: encoded point
+ * @param[out] x5:  1 if the encoding is valid, otherwise 0
+ * @param[out] w10: X, x-coordinate (only if valid)
+ * @param[out] w11: Y, y-coordinate (only if valid)
+ * @param[out] w12: Z = 1 (only if valid)
+ * @param[out] w13: T = x*y (only if valid)
+ *
+ * clobbered registers: x2 to x5, w2 to w18, w20 to w23
+ * clobbered flag groups: FG0
+ */
+.globl ed25519_point_decode
+ed25519_point_decode:
+  /* Assume the encoding is invalid until all checks have passed. */
+  li       x5, 0
+
+  /* w2 <= dmem[dptr_enc] */
+  li       x2, 2
+  bn.lid   x2, 0(x16)
+
+  /* Extract the sign bit from the M flag.
+       x3 <= MSb(w2) = sign */
+  bn.cmp   w2, w31
+  csrrs    x3, FG0, x0
+  srli     x3, x3, 1
+  andi     x3, x3, 1
+
+  /* Clear the sign bit.
+       w2 <= w2 mod 2^255 = y */
+  bn.rshi  w2, w2, w31 >> 255
+  bn.rshi  w2, w31, w2 >> 1
+
+  /* Return early if y >= p. */
+  bn.wsrr  w4, MOD
+  bn.cmp   w2, w4
+  csrrs    x2, FG0, x0
+  andi     x2, x2, 1
+  beq      x2, x0, point_decode_done
+
+  /* w7 <= 1 */
+  bn.addi  w7, w31, 1
+
+  /* w4 <= y^2 - 1 = u */
+  bn.mov   w22, w2
+  jal      x1, fe_square
+  bn.subm  w4, w22, w7
+
+  /* w5 <= d * y^2 + 1 = v */
+  la       x2, ed25519_d
+  li       x4, 23
+  bn.lid   x4, 0(x2)
+  jal      x1, fe_mul
+  bn.addm  w5, w22, w7
+
+  /* w6 <= v^3 */
+  bn.mov   w22, w5
+  jal      x1, fe_square
+  bn.mov   w23, w5
+  jal      x1, fe_mul
+  bn.mov   w6, w22
+
+  /* w16 <= (v^3)^2 * v * u = u * v^7 */
+  jal      x1, fe_square
+  jal      x1, fe_mul
+  bn.mov   w23, w4
+  jal      x1, fe_mul
+  bn.mov   w16, w22
+
+  /* w22 <= (u * v^7)^((p-5)/8) */
+  jal      x1, fe_pow_p58
+
+  /* w8 <= w22 * v^3 * u = x, candidate square root */
+  bn.mov   w23, w6
+  jal      x1, fe_mul
+  bn.mov   w23, w4
+  jal      x1, fe_mul
+  bn.mov   w8, w22
+
+  /* w22 <= v * x^2 */
+  jal      x1, fe_square
+  bn.mov   w23, w5
+  jal      x1, fe_mul
+
+  /* Skip the correction if v * x^2 = u. */
+  bn.cmp   w22, w4
+  csrrs    x2, FG0, x0
+  andi     x2, x2, 8
+  bne      x2, x0, point_decode_sign
+
+  /* Return early if v * x^2 != -u; u/v has no square root in this case. */
+  bn.subm  w9, w31, w4
+  bn.cmp   w22, w9
+  csrrs    x2, FG0, x0
+  andi     x2, x2, 8
+  beq      x2, x0, point_decode_done
+
+  /* w8 <= x * sqrt(-1) */
+  bn.mov   w22, w8
+  la       x2, ed25519_sqrt_m1
+  li       x4, 23
+  bn.lid   x4, 0(x2)
+  jal      x1, fe_mul
+  bn.mov   w8, w22
+
+  point_decode_sign:
+  /* Read the Z (bit 3) and L (bit 2) flags for x. */
+  bn.cmp   w8, w31
+  csrrs    x2, FG0, x0
+
+  /* Return early if x = 0 and the sign bit is 1. */
+  andi     x4, x2, 8
+  beq      x4, x0, point_decode_parity
+  bne      x3, x0, point_decode_done
+
+  point_decode_parity:
+  /* Negate x if its least significant bit does not match the sign bit.
+       w8 <= (p - x) mod p if (x & 1) != sign else x */
+  srli     x2, x2, 2
+  andi     x2, x2, 1
+  beq      x2, x3, point_decode_xy
+  bn.subm  w8, w31, w8
+
+  point_decode_xy:
+  /* w13 <= x * y = T */
+  bn.mov   w22, w8
+  bn.mov   w23, w2
+  jal      x1, fe_mul
+  bn.mov   w13, w22
+
+  /* (w10, w11, w12) <= (x, y, 1) */
+  bn.mov   w10, w8
+  bn.mov   w11, w2
+  bn.addi  w12, w31, 1
+
+  /* All checks passed. */
+  li       x5, 1
+
+  point_decode_done:
+  ret
+
+/**
+ * Process one bit of a scalar for the sliding window in Ed25519 verification.
+ *
+ * If no window is pending and bit i of the scalar is set, a new window is
+ * started with bits i to i-3 of the scalar. Trailing zeros are stripped from
+ * the window, so its value v is odd and v*P is one of the precomputed odd
+ * multiples P, 3P, ..., 15P. Once the loop reaches the last bit of the window,
+ * v*P is added to the accumulator. Finally, the scalar is shifted left by one
+ * bit.
+ *
+ * This routine runs in variable time and must only be used with public inputs.
+ *
+ * Flags: Flags have no meaning beyond the scope of this subroutine.
+ *
+ * @param[in]  w0: scalar, left-aligned such that bit i is the MSb
+ * @param[in]  x13: v, value of the pending window
+ * @param[in]  x14: number of bits of the pending window not processed yet
+ *                  (0 if no window is pending)
+ * @param[in]  x16: dptr_table, pointer to the odd multiples (2*j+1)*P of P
+ *                  for j = 0..7 in dmem, 128 bytes per entry as (X, Y, Z, T)
+ * @param[in]  x18: dptr_window, pointer to a 256-bit scratch word in dmem
+ * @param[in]  w19: constant, 19
+ * @param[in]  MOD: p, modulus = 2^255 - 19
+ * @param[in]  w29: constant, (2*d) mod p, d = (-121665/121666) mod p
+ * @param[in]  w30: constant, 38
+ * @param[in]  w31: all-zero
+ * @param[in,out] w10 to w13: accumulator point (X, Y, Z, T)
+ * @param[out] w0: scalar << 1
+ * @param[out] x13: v, value of the pending window
+ * @param[out] x14: number of bits of the pending window not processed yet
+ *
+ * clobbered registers: x2, x3, x13, x14, w0, w3, w10 to w18, w20 to w27
+ * clobbered flag groups: FG0
+ */
+ed25519_window_step:
+  /* Skip the window search if a window is pending. */
+  bne      x14, x0, window_pending
+
+  /* If bit i of the scalar is not set, jump to 'window_done'. */
+  bn.add   w3, w0, w0
+  csrrs    x2, FG0, x0
+  andi     x2, x2, 1
+  beq      x2, x0, window_done
+
+  /* Start a new window of 4 bits.
+       x13 <= v = scalar[i:i-3]
+       x14 <= 4 */
+  bn.rshi  w3, w31, w0 >> 252
+  li       x2, 3
+  bn.sid   x2, 0(x18)
+  lw       x13, 0(x18)
+  li       x14, 4
+
+  /* Strip trailing zeros from the window. */
+  window_trim:
+  andi     x2, x13, 1
+  bne      x2, x0, window_pending
+  srli     x13, x13, 1
+  addi     x14, x14, -1
+  jal      x0, window_trim
+
+  window_pending:
+  /* If the window does not end at bit i, jump to 'window_done'. */
+  addi     x14, x14, -1
+  bne      x14, x0, window_done
+
+  /* Load the precomputed multiple v*P.
+       [w17:w14] <= dmem[dptr_table + 128*(v >> 1)] */
+  srli     x2, x13, 1
+  slli     x2, x2, 7
+  add      x3, x16, x2
+  li       x2, 14
+  bn.lid   x2++, 0(x3)
+  bn.lid   x2++, 32(x3)
+  bn.lid   x2++, 64(x3)
+  bn.lid   x2, 96(x3)
+
+  /* [w13:w10] <= [w13:w10] + v*P */
+  jal      x1, ext_add
+
+  window_done:
+  /* Shift the scalar left to decrease the index. */
+  bn.add   w0, w0, w0
+
+  ret
+
+/**
+ * Verify an Ed25519 signature.
+ *
+ * Checks the verification equation from RFC 8032, section 5.1.7:
+ *   https://datatracker.ietf.org/doc/html/rfc8032#section-5.1.7
+ *
+ * Given the public key A, the signature (R, S) and the precomputed hash
+ * k = SHA-512(dom2(F, C) || R || A || M), the cofactorless check accepts the
+ * signature if [S]B = R + [k]A, and the cofactored check accepts it if
+ * [8][S]B = [8]R + [8][k]A. The two only differ for adversarially chosen
+ * points with a small-order component; honestly generated signatures pass
+ * both checks.
+ *
+ * The routine computes [S]B + [k](-A) in a single double-and-add loop
+ * (Straus' trick) with a sliding window of width 4 for each scalar. The odd
+ * multiples of the base point B are a precomputed constant table; the odd
+ * multiples of -A are computed at runtime. Then -R is added, the result is
+ * optionally multiplied by 8 and compared with the neutral element.
+ *
+ * The signature is rejected if A or R cannot be decoded, or if S >= L.
+ *
+ * This routine runs in variable time and must only be used with public inputs.
+ *
+ * Flags: Flags have no meaning beyond the scope of this subroutine.
+ *
+ * @param[in]  x10: cofactored, 1 for the cofactored check, 0 for cofactorless
+ * @param[in]  dmem[ed25519_hash_k]: k, 512-bit hash value (little-endian)
+ * @param[in]  dmem[ed25519_public_key]: encoded public key A
+ * @param[in]  dmem[ed25519_sig_R]: encoded signature point R
+ * @param[in]  dmem[ed25519_sig_S]: signature scalar S
+ * @param[out] dmem[ed25519_verify_result]: HARDENED_BOOL_TRUE if the signature
+ *                                          is valid, else HARDENED_BOOL_FALSE
+ *
+ * clobbered registers: x2 to x5, x13, x14, x16, x18, x20 to x25,
+ *                      w0 to w31, MOD
+ * clobbered flag groups: FG0
+ */
+.globl ed25519_verify_var
+ed25519_verify_var:
+  /* Prepare all-zero register. */
+  bn.xor   w31, w31, w31
+
+  /* w19 <= 19 */
+  bn.addi  w19, w31, 19
+
+  /* w30 <= 38 */
+  bn.addi  w30, w31, 38
+
+  /* w28 <= 2^255 - 19 = p */
+  bn.not   w28, w31
+  bn.rshi  w28, w31, w28 >> 1
+  bn.subi  w28, w28, 18
+
+  /* MOD <= w28 = p */
+  bn.wsrw  MOD, w28
+
+  /* w29 <= (2*d) mod p */
+  la       x2, ed25519_d
+  li       x3, 29
+  bn.lid   x3, 0(x2)
+  bn.addm  w29, w29, w29
+
+  /* Decode the public key A.
+       [w13:w10] <= A */
+  la       x16, ed25519_public_key
+  jal      x1, ed25519_point_decode
+  beq      x5, x0, verify_fail
+
+  /* Negate A.
+       [w13:w10] <= -A = (-X, Y, Z, -T) */
+  bn.subm  w10, w31, w10
+  bn.subm  w13, w31, w13
+
+  /* Compute the odd multiples of -A.
+       dmem[ed25519_a_table + 128*j] <= (2*j + 1)*(-A) for j = 0..7 */
+  la       x3, ed25519_a_table
+  li       x2, 10
+  bn.sid   x2++, 0(x3)
+  bn.sid   x2++, 32(x3)
+  bn.sid   x2++, 64(x3)
+  bn.sid   x2, 96(x3)
+
+  /* [w17:w14] <= 2*(-A) */
+  jal      x1, ext_double
+  bn.mov   w14, w10
+  bn.mov   w15, w11
+  bn.mov   w16, w12
+  bn.mov   w17, w13
+
+  /* [w13:w10] <= -A */
+  li       x2, 10
+  bn.lid   x2++, 0(x3)
+  bn.lid   x2++, 32(x3)
+  bn.lid   x2++, 64(x3)
+  bn.lid   x2, 96(x3)
+
+  loopi    7, 7
+    /* [w13:w10] <= [w13:w10] + 2*(-A) */
+    jal      x1, ext_add
+
+    /* dmem[x3 + 128] <= [w13:w10] */
+    addi     x3, x3, 128
+    li       x2, 10
+    bn.sid   x2++, 0(x3)
+    bn.sid   x2++, 32(x3)
+    bn.sid   x2++, 64(x3)
+    bn.sid   x2, 96(x3)
+
+  /* Decode the signature point R.
+       [w13:w10] <= R */
+  la       x16, ed25519_sig_R
+  jal      x1, ed25519_point_decode
+  beq      x5, x0, verify_fail
+
+  /* dmem[ed25519_neg_r] <= -R = (-X, Y, Z, -T) */
+  bn.subm  w10, w31, w10
+  bn.subm  w13, w31, w13
+  la       x3, ed25519_neg_r
+  li       x2, 10
+  bn.sid   x2++, 0(x3)
+  bn.sid   x2++, 32(x3)
+  bn.sid   x2++, 64(x3)
+  bn.sid   x2, 96(x3)
+
+  /* Switch to the scalar field.
+       MOD <= L
+       [w15:w14] <= mu */
+  jal      x1, sc_init
+
+  /* w1 <= dmem[ed25519_sig_S] = S */
+  la       x3, ed25519_sig_S
+  li       x2, 1
+  bn.lid   x2, 0(x3)
+
+  /* Fail if S >= L. */
+  bn.wsrr  w2, MOD
+  bn.cmp   w1, w2
+  csrrs    x2, FG0, x0
+  andi     x2, x2, 1
+  beq      x2, x0, verify_fail
+
+  /* w0 <= S << 3, left-aligned 253-bit scalar */
+  bn.rshi  w0, w1, w31 >> 253
+
+  /* Reduce the 512-bit hash modulo L in two steps to respect the input bound
+     of `sc_reduce`.
+       w18 <= k_hi mod L
+       w18 <= ((k_hi mod L) * 2^256 + k_lo) mod L = k mod L */
+  la       x3, ed25519_hash_k
+  li       x2, 16
+  bn.lid   x2, 32(x3)
+  bn.mov   w17, w31
+  jal      x1, sc_reduce
+  bn.mov   w17, w18
+  li       x2, 16
+  bn.lid   x2, 0(x3)
+  jal      x1, sc_reduce
+
+  /* w1 <= k << 3, left-aligned 253-bit scalar */
+  bn.rshi  w1, w18, w31 >> 253
+
+  /* Switch back to the coordinate field.
+       MOD <= w28 = p */
+  bn.wsrw  MOD, w28
+
+  /* Initialize the accumulator with the neutral element.
+       [w13:w10] <= (0, 1, 1, 0) */
+  bn.mov   w10, w31
+  bn.addi  w11, w31, 1
+  bn.addi  w12, w31, 1
+  bn.mov   w13, w31
+
+  /* No window is pending for either scalar.
+       x20, x21 <= window state for S
+       x22, x23 <= window state for k */
+  li       x20, 0
+  li       x21, 0
+  li       x22, 0
+  li       x23, 0
+
+  /* Initialize pointers to the tables and the window scratch word.
+       x24 <= ed25519_b_table
+       x25 <= ed25519_a_table
+       x18 <= ed25519_window */
+  la       x24, ed25519_b_table
+  la       x25, ed25519_a_table
+  la       x18, ed25519_window
+
+  /* Main loop with decreasing index i (i=252 downto 0). */
+  loopi    253, 19
+    /* [w13:w10] <= 2 * [w13:w10] */
+    jal      x1, ext_double
+
+    /* Process bit i of S with the odd multiples of B. */
+    addi     x13, x20, 0
+    addi     x14, x21, 0
+    addi     x16, x24, 0
+    jal      x1, ed25519_window_step
+    addi     x20, x13, 0
+    addi     x21, x14, 0
+
+    /* Swap the scalars: w0 <= k, w1 <= S */
+    bn.mov   w2, w0
+    bn.mov   w0, w1
+    bn.mov   w1, w2
+
+    /* Process bit i of k with the odd multiples of -A. */
+    addi     x13, x22, 0
+    addi     x14, x23, 0
+    addi     x16, x25, 0
+    jal      x1, ed25519_window_step
+    addi     x22, x13, 0
+    addi     x23, x14, 0
+
+    /* Swap the scalars back: w0 <= S, w1 <= k */
+    bn.mov   w2, w0
+    bn.mov   w0, w1
+    bn.mov   w1, w2
+
+  /* [w13:w10] <= [S]B - [k]A - R */
+  la       x3, ed25519_neg_r
+  li       x2, 14
+  bn.lid   x2++, 0(x3)
+  bn.lid   x2++, 32(x3)
+  bn.lid   x2++, 64(x3)
+  bn.lid   x2, 96(x3)
+  jal      x1, ext_add
+
+  /* Skip the multiplication by the cofactor for the cofactorless check. */
+  beq      x10, x0, verify_check
+
+  /* [w13:w10] <= 8 * [w13:w10] */
+  loopi    3, 2
+    jal      x1, ext_double
+    nop
+
+  verify_check:
+  /* The result is the neutral element iff X = 0 and Y = Z. */
+  bn.cmp   w10, w31
+  csrrs    x2, FG0, x0
+  andi     x2, x2, 8
+  beq      x2, x0, verify_fail
+  bn.cmp   w11, w12
+  csrrs    x2, FG0, x0
+  andi     x2, x2, 8
+  beq      x2, x0, verify_fail
+
+  /* dmem[ed25519_verify_result] <= HARDENED_BOOL_TRUE */
+  la       x2, ed25519_verify_result
+  addi     x3, x0, HARDENED_BOOL_TRUE
+  sw       x3, 0(x2)
+  ret
+
+  verify_fail:
+  /* dmem[ed25519_verify_result] <= HARDENED_BOOL_FALSE */
+  la       x2, ed25519_verify_result
+  addi     x3, x0, HARDENED_BOOL_FALSE
+  sw       x3, 0(x2)
+  ret
+
+.data
+
+/* Curve constant d = (-121665/121666) mod p */
+.balign 32
+ed25519_d:
+  .word 0x135978a3
+  .word 0x75eb4dca
+  .word 0x4141d8ab
+  .word 0x00700a4d
+  .word 0x7779e898
+  .word 0x8cc74079
+  .word 0x2b6ffe73
+  .word 0x52036cee
+
+/* Square root of -1 modulo p, sqrt(-1) = 2^((p-1)/4) mod p */
+.balign 32
+ed25519_sqrt_m1:
+  .word 0x4a0ea0b0
+  .word 0xc4ee1b27
+  .word 0xad2fe478
+  .word 0x2f431806
+  .word 0x3dfbd7a7
+  .word 0x2b4d0099
+  .word 0x4fc1df0b
+  .word 0x2b832480
+
+/* Odd multiples (2*j+1)*B of the base point B for j = 0..7, each stored as
+   (X, Y, Z, T) = (x, y, 1, x*y). */
+.balign 32
+ed25519_b_table:
+/* 1*B */
+  .word 0x8f25d51a
+  .word 0xc9562d60
+  .word 0x9525a7b2
+  .word 0x692cc760
+  .word 0xfdd6dc5c
+  .word 0xc0a4e231
+  .word 0xcd6e53fe
+  .word 0x216936d3
+  .word 0x66666658
+  .word 0x66666666
+  .word 0x66666666
+  .word 0x66666666
+  .word 0x66666666
+  .word 0x66666666
+  .word 0x66666666
+  .word 0x66666666
+  .word 0x00000001
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0xa5b7dda3
+  .word 0x6dde8ab3
+  .word 0x775152f5
+  .word 0x20f09f80
+  .word 0x64abe37d
+  .word 0x66ea4e8e
+  .word 0xd78b7665
+  .word 0x67875f0f
+/* 3*B */
+  .word 0xd3f8e25c
+  .word 0xac62485f
+  .word 0x81624886
+  .word 0x63439819
+  .word 0x3edac83a
+  .word 0x1ff4ae74
+  .word 0x22928f49
+  .word 0x67ae9c4a
+  .word 0x78f5b4d4
+  .word 0x02c36848
+  .word 0x67240304
+  .word 0x9f16ec17
+  .word 0x60269ef7
+  .word 0xa126a18e
+  .word 0x77ee69ab
+  .word 0x1267b1d1
+  .word 0x00000001
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x78b3a41a
+  .word 0xcdf908fa
+  .word 0xfb16fc4a
+  .word 0x5c27358b
+  .word 0xadb91527
+  .word 0xebef3783
+  .word 0xb1dd9510
+  .word 0x2a4d025c
+/* 5*B */
+  .word 0x322ef233
+  .word 0x91409cc0
+  .word 0x3e1be1a5
+  .word 0x5c2819f9
+  .word 0xd12da5de
+  .word 0xfcef7cf7
+  .word 0xade3587b
+  .word 0x49fda73e
+  .word 0xd676c8ed
+  .word 0x10d21f83
+  .word 0x89430b5d
+  .word 0x31282eca
+  .word 0x89924666
+  .word 0xe02c6e14
+  .word 0x98feae6f
+  .word 0x5f4825b2
+  .word 0x00000001
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0xf3e801d0
+  .word 0x641950bc
+  .word 0x000926bf
+  .word 0xafb94e85
+  .word 0x8736c7f9
+  .word 0x3160ea50
+  .word 0x9c593d4c
+  .word 0x745c562c
+/* 7*B */
+  .word 0xf50e4107
+  .word 0x5855981a
+  .word 0xbbf1ce95
+  .word 0x83e809f3
+  .word 0x4b1d8107
+  .word 0xe9e3ee19
+  .word 0xfcf4bd4e
+  .word 0x14568685
+  .word 0x9f4062b8
+  .word 0x12c4c4b5
+  .word 0xf7abf23d
+  .word 0xf0882b46
+  .word 0xdd36ad41
+  .word 0x87ce6468
+  .word 0x2b47d52f
+  .word 0x31c563e3
+  .word 0x00000001
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x5587ed1b
+  .word 0x10bd4556
+  .word 0x1e9aa4e4
+  .word 0x5294632a
+  .word 0x89d5bab4
+  .word 0x9be82dc5
+  .word 0x1d165e1b
+  .word 0x119e77b1
+/* 9*B */
+  .word 0x5185715c
+  .word 0xd3e02306
+  .word 0x2e4e0294
+  .word 0x86d80e5c
+  .word 0x6f9422b8
+  .word 0x1bf336e0
+  .word 0xc8007165
+  .word 0x357cc970
+  .word 0x5522f1c0
+  .word 0xc74e4484
+  .word 0x236e4430
+  .word 0x1f789013
+  .word 0x56f2d2fd
+  .word 0xb2befce9
+  .word 0xc2dd0df4
+  .word 0x7f3d23c2
+  .word 0x00000001
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x88b2f465
+  .word 0x5c3b386f
+  .word 0xf770327e
+  .word 0x17b3d4a0
+  .word 0xf747cd74
+  .word 0xdb6676ad
+  .word 0xea87cbf9
+  .word 0x5c70fc48
+/* 11*B */
+  .word 0x207cf3cb
+  .word 0xff2fd2c1
+  .word 0xc593d552
+  .word 0xd381a5b2
+  .word 0xd6712438
+  .word 0xb6cf078d
+  .word 0x154be417
+  .word 0x14e528b1
+  .word 0x6a033713
+  .word 0x308f2dc3
+  .word 0x3c9c58d4
+  .word 0x1258591c
+  .word 0x40ff0fce
+  .word 0x5a6f7ce3
+  .word 0x3f21ab97
+  .word 0x2d908231
+  .word 0x00000001
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0xdb5beed4
+  .word 0xeb85cf2e
+  .word 0xe18fc837
+  .word 0x590001dd
+  .word 0xf216adbf
+  .word 0x39caa6be
+  .word 0x800f28a2
+  .word 0x5ae6a565
+/* 13*B */
+  .word 0xb7c05fed
+  .word 0x3780e073
+  .word 0x8d22b7b8
+  .word 0x8843e3e8
+  .word 0x282d304f
+  .word 0xdb33adf0
+  .word 0xd5f366cc
+  .word 0x107427e0
+  .word 0xea401f80
+  .word 0x87efe1ae
+  .word 0x289a2723
+  .word 0x3740cfb2
+  .word 0xd2da89b8
+  .word 0x78466022
+  .word 0xed538b74
+  .word 0x12dbb00d
+  .word 0x00000001
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0xe8de2f53
+  .word 0x522cdccd
+  .word 0xeb2e8efc
+  .word 0x5b14aa51
+  .word 0xcd562338
+  .word 0xc5c0dd61
+  .word 0x17be6460
+  .word 0x412806b9
+/* 15*B */
+  .word 0x66a18dc1
+  .word 0x90617f3e
+  .word 0x770189cb
+  .word 0xd9631374
+  .word 0x5d20419e
+  .word 0xdc5ac6f9
+  .word 0xec2ec435
+  .word 0x4f162dea
+  .word 0xad2e5cdf
+  .word 0x946d4cc4
+  .word 0xa19a9aa1
+  .word 0xace5af18
+  .word 0x64d29331
+  .word 0x5162f701
+  .word 0x04ff22f5
+  .word 0x12cbfb2d
+  .word 0x00000001
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x5c92bf29
+  .word 0x140d7f33
+  .word 0xe40ae5f5
+  .word 0xfa63b68f
+  .word 0x41760de2
+  .word 0xab24fd22
+  .word 0x36b77491
+  .word 0x5e33f00e
+
+.section .bss
+
+/* Hash k = SHA-512(dom2(F, C) || R || A || M), little-endian (512 bits). */
+.balign 32
+.weak ed25519_hash_k
+ed25519_hash_k:
+  .zero 64
+
+/* Encoded public key A. */
+.balign 32
+.weak ed25519_public_key
+ed25519_public_key:
+  .zero 32
+
+/* Encoded signature point R. */
+.balign 32
+.weak ed25519_sig_R
+ed25519_sig_R:
+  .zero 32
+
+/* Signature scalar S. */
+.balign 32
+.weak ed25519_sig_S
+ed25519_sig_S:
+  .zero 32
+
+/* Verification result. Should be HARDENED_BOOL_TRUE or HARDENED_BOOL_FALSE. */
+.balign 4
+.weak ed25519_verify_result
+ed25519_verify_result:
+  .zero 4
+
+/* Negated signature point -R in extended coordinates. */
+.balign 32
+ed25519_neg_r:
+  .zero 128
+
+/* Scratch word for extracting window values. */
+.balign 32
+ed25519_window:
+  .zero 32
+
+.section .scratchpad
+
+/* Odd multiples (2*j+1)*(-A) of the negated public key for j = 0..7, in
+   extended coordinates. */
+.balign 32
+ed25519_a_table:
+  .zero 1024
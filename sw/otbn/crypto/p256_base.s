@@ -23,6 +23,7 @@
 .globl mod_mul_256x256
 .globl mod_mul_320x128
 .globl scalar_mult_int
+.globl base_mult_int
 .globl proj_add
 .globl proj_to_affine
 
@@ -1513,6 +1514,274 @@ scalar_mult_int:
   jal       x0, trigger_fault_if_fg0_not_z
 
 
+/**
+ * Fetch an entry of the fixed-base comb table and randomize its z-coordinate
+ *
+ * returns P = (x, y, z) = (x_a*z, y_a*z, z)
+ *         with (x_a, y_a) = T[idx] being an entry of the comb table
+ *              z being a randomized z-coordinate
+ *
+ * All 16 entries of the comb table are fetched from dmem and the one matching
+ * the index is kept, so neither the memory access pattern nor the timing
+ * depends on the index. Entry 0 is the point at infinity; for this entry the
+ * z-coordinate is cleared, which results in the valid projective
+ * representation (0, z, 0).
+ * This routine runs in constant time.
+ *
+ * @param[in]  w26: idx, table index (0 <= idx < 16)
+ * @param[in]  w28: r256, constant, 2^256 mod p = 2^256 - p
+ * @param[in]  w29: r448, constant, 2^448 mod p
+ * @param[in]  w31: all-zero
+ * @param[in]  MOD: p, modulus of P-256 underlying finite field
+ * @param[out] w11: x, projective x-coordinate
+ * @param[out] w12: y, projective y-coordinate
+ * @param[out] w13: z, random projective z-coordinate (zero for idx = 0)
+ *
+ * Flags: Flags have no meaning beyond the scope of this subroutine.
+ *
+ * clobbered registers: x2, x3, w11 to w25, w30
+ * clobbered flag groups: FG0
+ */
+fetch_comb_randomize:
+  /* init table pointer and entry counter
+       x3 <= p256_comb_table
+       w30 <= j = 0 */
+  la        x3, p256_comb_table
+  bn.xor    w30, w30, w30
+
+  /* init selected entry with random numbers from URND */
+  bn.wsrr   w11, URND
+  bn.wsrr   w12, URND
+
+  /* Scan the whole table, two entries per iteration. The selected entry
+     alternates between (w11, w12) and (w13, w14) so that the destination of
+     each select is distinct from both of its sources and was randomized
+     beforehand. */
+  loopi     8, 20
+
+    /* fetch entry j
+         w16, w17 <= T[j] = dmem[x3], dmem[x3+32] */
+    li        x2, 16
+    bn.lid    x2++, 0(x3)
+    bn.lid    x2, 32(x3)
+    addi      x3, x3, 64
+
+    /* (w13, w14) <= (idx == j) ? T[j] : (w11, w12) */
+    bn.cmp    w26, w30
+    bn.wsrr   w13, URND
+    bn.wsrr   w14, URND
+    bn.sel    w13, w16, w11, Z
+    bn.sel    w14, w17, w12, Z
+    bn.addi   w30, w30, 1
+
+    /* fetch entry j+1
+         w16, w17 <= T[j+1] = dmem[x3], dmem[x3+32] */
+    li        x2, 16
+    bn.lid    x2++, 0(x3)
+    bn.lid    x2, 32(x3)
+    addi      x3, x3, 64
+
+    /* (w11, w12) <= (idx == j+1) ? T[j+1] : (w13, w14) */
+    bn.cmp    w26, w30
+    bn.wsrr   w11, URND
+    bn.wsrr   w12, URND
+    bn.sel    w11, w16, w13, Z
+    bn.sel    w12, w17, w14, Z
+    bn.addi   w30, w30, 1
+
+  /* w17 <= f = (idx == 0) ? 0 : 2^256 - 1 */
+  bn.not    w16, w31
+  bn.cmp    w26, w31
+  bn.wsrr   w17, URND
+  bn.sel    w17, w31, w16, Z
+
+  /* get random number from URND and reduce it
+     w18 = z <= URND mod p */
+  bn.wsrr   w18, URND
+  bn.addm   w18, w18, w31
+
+  /* scale x-coordinate
+     w11 = x <= w11*w18 = x_a*z  mod p */
+  bn.mov    w24, w11
+  bn.mov    w25, w18
+  jal       x1, mul_modp
+  bn.mov    w11, w19
+
+  /* scale y-coordinate
+     w12 = y <= w12*w18 = y_a*z  mod p */
+  bn.mov    w24, w12
+  bn.mov    w25, w18
+  jal       x1, mul_modp
+  bn.mov    w12, w19
+
+  /* w13 <= z & f */
+  bn.and    w13, w18, w17
+
+  ret
+
+
+/**
+ * P-256 scalar multiplication with base point G using a fixed-base comb
+ *
+ * returns R = k*G
+ *         with R, G being valid P-256 curve points,
+ *              G being the curves base point,
+ *              k being a scalar given in two shares
+ *
+ * This routine computes multiples of the base point G with the comb method of
+ * Lim and Lee [1] using 4 teeth. Each 321-bit share is split into 4 teeth of
+ * 81 bits each, and the comb table holds the 16 points
+ *   T[i] = i[0]*G + i[1]*2^81*G + i[2]*2^162*G + i[3]*2^243*G.
+ * Compared to `scalar_mult_int`, this reduces the number of point doublings
+ * from 321 to 81.
+ *
+ * The routine receives the scalar in two shares k0, k1 such that
+ *   k = (k0 + k1) mod n
+ * The shares are never combined. Instead, each column adds one table entry
+ * per share, computing (k0 + k1) * G as follows:
+ *  Q = (0, 1, 0) # origin
+ *  for i in 80..0:
+ *    Q = 2 * Q
+ *    Q = Q + T[k0[243+i] k0[162+i] k0[81+i] k0[i]]
+ *    Q = Q + T[k1[243+i] k1[162+i] k1[81+i] k1[i]]
+ *
+ * Table entries are fetched with a full scan of the table and their
+ * z-coordinates are randomized, see `fetch_comb_randomize`.
+ *
+ * [1] https://doi.org/10.1007/3-540-48658-5_11
+ *
+ * @param[in]  w0: lower 256 bits of k0, first share of scalar
+ * @param[in]  w1: upper 65 bits of k0, first share of scalar
+ * @param[in]  w2: lower 256 bits of k1, second share of scalar
+ * @param[in]  w3: upper 65 bits of k1, second share of scalar
+ * @param[in]  w31: all-zero
+ * @param[out]  w8: x, x-coordinate of curve point (projective)
+ * @param[out]  w9: y, y-coordinate of curve point (projective)
+ * @param[out]  w10: z, z-coordinate of curve point (projective)
+ *
+ * Flags: Flags have no meaning beyond the scope of this subroutine.
+ *
+ * clobbered registers: x2, x3, w0 to w30
+ * clobbered flag groups: FG0
+ */
+base_mult_int:
+  /* Set up for coordinate arithmetic.
+       MOD <= p
+       w28 <= r256
+       w29 <= r448 */
+  jal       x1, setup_modp
+
+  /* load domain parameter b from dmem
+     w27 <= b = dmem[p256_b] */
+  li        x2, 27
+  la        x3, p256_b
+  bn.lid    x2, 0(x3)
+
+  /* Split the first share of k into 4 teeth and left-align each of them in a
+     word. The bits below each tooth are padded with randomness.
+       w4 <= k0[80:0] << 175
+       w5 <= k0[161:81] << 175
+       w6 <= k0[242:162] << 175
+       w7 <= k0[323:243] << 175 */
+  bn.wsrr   w20, URND
+  bn.rshi   w7, w1, w0 >> 68
+  bn.rshi   w6, w0, w20 >> 243
+  bn.rshi   w5, w0, w20 >> 162
+  bn.rshi   w4, w0, w20 >> 81
+
+  /* Overwrite the first share of k with randomness before the registers are
+     reused for the second share. */
+  bn.wsrr   w0, URND
+  bn.wsrr   w1, URND
+
+  /* init comb with point in infinity
+     Q = (w8, w9, w10) <= (0, 1, 0) */
+  bn.mov    w8, w31
+  bn.addi   w9, w31, 1
+  bn.mov    w10, w31
+
+  /* Split the second share of k into 4 teeth.
+
+     N.B. This has been intentionally separated from accesses to k0 above to
+     avoid potential transient side channel leakage from accessing k0 and k1
+     in sequential instructions.
+
+       w0 <= k1[80:0] << 175
+       w1 <= k1[161:81] << 175
+       w2 <= k1[242:162] << 175
+       w3 <= k1[323:243] << 175 */
+  bn.wsrr   w20, URND
+  bn.rshi   w3, w3, w2 >> 68
+  bn.rshi   w1, w2, w20 >> 162
+  bn.rshi   w0, w2, w20 >> 81
+  bn.rshi   w2, w2, w20 >> 243
+
+  /* comb loop with decreasing column index */
+  loopi     81, 31
+
+    /* double point Q
+       Q = (w8, w9, w10) <= 2*(w8, w9, w10) = 2*Q */
+    jal       x1, proj_double
+
+    /* Gather the current column of the teeth of k0 into a table index and
+       shift the teeth left by 1 bit.
+         w26 <= idx0 = MSb(w7) | MSb(w6) | MSb(w5) | MSb(w4) */
+    bn.wsrr   w26, URND
+    bn.rshi   w26, w31, w7 >> 255
+    bn.rshi   w26, w26, w6 >> 255
+    bn.rshi   w26, w26, w5 >> 255
+    bn.rshi   w26, w26, w4 >> 255
+    bn.wsrr   w30, URND
+    bn.rshi   w7, w7, w30 >> 255
+    bn.rshi   w6, w6, w30 >> 255
+    bn.rshi   w5, w5, w30 >> 255
+    bn.rshi   w4, w4, w30 >> 255
+
+    /* fetch and randomize T[idx0]
+       P = (w11, w12, w13) <= T[idx0] */
+    jal       x1, fetch_comb_randomize
+
+    /* add points
+       Q = (w11, w12, w13) <= (w11, w12, w13) + (w8, w9, w10) = Q + T[idx0] */
+    jal       x1, proj_add
+    bn.mov    w8, w11
+    bn.mov    w9, w12
+    bn.mov    w10, w13
+
+    /* Same for k1.
+         w26 <= idx1 = MSb(w3) | MSb(w2) | MSb(w1) | MSb(w0) */
+    bn.wsrr   w26, URND
+    bn.rshi   w26, w31, w3 >> 255
+    bn.rshi   w26, w26, w2 >> 255
+    bn.rshi   w26, w26, w1 >> 255
+    bn.rshi   w26, w26, w0 >> 255
+    bn.wsrr   w30, URND
+    bn.rshi   w3, w3, w30 >> 255
+    bn.rshi   w2, w2, w30 >> 255
+    bn.rshi   w1, w1, w30 >> 255
+    bn.rshi   w0, w0, w30 >> 255
+
+    /* P = (w11, w12, w13) <= T[idx1] */
+    jal       x1, fetch_comb_randomize
+
+    /* Q = (w8, w9, w10) <= Q + T[idx1] */
+    jal       x1, proj_add
+    bn.mov    w8, w11
+    bn.mov    w9, w12
+    bn.mov    w10, w13
+
+  /* Wipe the last table index. */
+  bn.wsrr   w26, URND
+
+  /* Check if the z-coordinate of Q is 0. If so, fail; this represents the
+     point at infinity and means the scalar was zero mod n, which likely
+     indicates a fault attack. Tail-call.
+
+     FG0.Z <= if (w10 == 0) then 1 else 0 */
+  bn.cmp    w10, w31
+  jal       x0, trigger_fault_if_fg0_not_z
+
+
 /**
  * P-256 scalar multiplication with base point G
  *
@@ -1572,11 +1841,9 @@ p256_base_mult:
   /* Hide the secret key before running the scalar multiplication. */
   jal       x1, p256_masked_scalar_reblind
 
-  /* call internal scalar multiplication routine
-     R = (x_p, y_p, z_p) = (w8, w9, w10) <= d*P = (w0 + w1)*P */
-  la        x21, p256_gx
-  la        x22, p256_gy
-  jal       x1, scalar_mult_int
+  /* call internal base point multiplication routine
+     R = (x_p, y_p, z_p) = (w8, w9, w10) <= d*G = ([w0,w1] + [w2,w3])*G */
+  jal       x1, base_mult_int
 
   /* Convert masked result back to affine coordinates.
      R = (x_a, y_a) = (w11, w12) */
@@ -2269,6 +2536,289 @@ p256_gy:
   .word 0xfe1a7f9b
   .word 0x4fe342e2
 
+/* Fixed-base comb table for P-256 basepoint G.
+
+   Entry i (0 <= i < 16) holds the affine coordinates (x, y) of
+     T[i] = sum_{j=0..3} i[j] * 2^(81*j) * G.
+   T[0] is the point at infinity and is stored as the placeholder (0, 1); the
+   comb routine zeroes its projective z-coordinate. Each entry occupies 64
+   bytes: x-coordinate at offset 0, y-coordinate at offset 32. */
+.globl p256_comb_table
+.balign 32
+p256_comb_table:
+  /* T[0] */
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000001
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  .word 0x00000000
+  /* T[1] */
+  .word 0xd898c296
+  .word 0xf4a13945
+  .word 0x2deb33a0
+  .word 0x77037d81
+  .word 0x63a440f2
+  .word 0xf8bce6e5
+  .word 0xe12c4247
+  .word 0x6b17d1f2
+  .word 0x37bf51f5
+  .word 0xcbb64068
+  .word 0x6b315ece
+  .word 0x2bce3357
+  .word 0x7c0f9e16
+  .word 0x8ee7eb4a
+  .word 0xfe1a7f9b
+  .word 0x4fe342e2
+  /* T[2] */
+  .word 0xe5e84da4
+  .word 0x61e0f0ef
+  .word 0x6ed90cad
+  .word 0x3b09f077
+  .word 0x496e6894
+  .word 0x10cfa381
+  .word 0xb5909a0b
+  .word 0x8efa0f79
+  .word 0x596969d3
+  .word 0xfde19f42
+  .word 0x97816035
+  .word 0x79957c48
+  .word 0x5daafd14
+  .word 0x9fa46f1c
+  .word 0x934cd613
+  .word 0x242418e7
+  /* T[3] */
+  .word 0xa1ae6278
+  .word 0x91f5de0c
+  .word 0x420f0ad1
+  .word 0xa41c0bfd
+  .word 0x74a77421
+  .word 0x95e0a398
+  .word 0x5094be60
+  .word 0x026c5285
+  .word 0x4e964cf3
+  .word 0x0104009f
+  .word 0xd896a3d0
+  .word 0xf6f85ba1
+  .word 0x3bb6731a
+  .word 0x7ec1cbab
+  .word 0xeb351f87
+  .word 0x7466b2c6
+  /* T[4] */
+  .word 0xb96214fb
+  .word 0xcc319d54
+  .word 0x8febc765
+  .word 0x71dc987a
+  .word 0xcdf1c589
+  .word 0xcda9e496
+  .word 0x4fbfdb25
+  .word 0xc6122fc4
+  .word 0xb7adfff7
+  .word 0x3702bd8f
+  .word 0x1e271f8a
+  .word 0x08a6e48c
+  .word 0x8877f91f
+  .word 0x9031c986
+  .word 0x8343ac41
+  .word 0xea205bec
+  /* T[5] */
+  .word 0x521c658f
+  .word 0x85a1f507
+  .word 0x5e61d78c
+  .word 0x2d83a04b
+  .word 0x20c4eccd
+  .word 0x3a6a52b2
+  .word 0x323b6f75
+  .word 0x0a7d7b5d
+  .word 0xae86eaa8
+  .word 0x327bbe7e
+  .word 0xe34f5e02
+  .word 0x827676fa
+  .word 0x72575f79
+  .word 0xfc988f76
+  .word 0x6b4bb8a1
+  .word 0xce9465f3
+  /* T[6] */
+  .word 0x2230f077
+  .word 0x0484ce3b
+  .word 0x41fc496e
+  .word 0x64e90190
+  .word 0xd73930b9
+  .word 0x963cd675
+  .word 0x9e20e634
+  .word 0x1c26a487
+  .word 0x740e1930
+  .word 0xe013d267
+  .word 0x1cf919a7
+  .word 0x04e38ea7
+  .word 0x1a14c432
+  .word 0xbc701e46
+  .word 0xea35402a
+  .word 0x168f9177
+  /* T[7] */
+  .word 0xb16255fe
+  .word 0x48171ff8
+  .word 0x6d37246b
+  .word 0x3aee8a85
+  .word 0x2693825f
+  .word 0xdc35a6e3
+  .word 0x7b97d883
+  .word 0x777cc731
+  .word 0x56040155
+  .word 0x56059ce1
+  .word 0x45d09a7f
+  .word 0xa6bd6df9
+  .word 0x59f8c5bd
+  .word 0x1865d18d
+  .word 0x96ca6b3f
+  .word 0x675a5215
+  /* T[8] */
+  .word 0x128aa5cd
+  .word 0x93925b40
+  .word 0xed9768e7
+  .word 0xceceaf38
+  .word 0xdd6c93fc
+  .word 0x20feb9fb
+  .word 0x5a92f1b3
+  .word 0xf5e3efcb
+  .word 0xceaa0fb4
+  .word 0xab2799c7
+  .word 0xb110cec9
+  .word 0x84e0a6f4
+  .word 0xeb07bd2b
+  .word 0x4e51e2df
+  .word 0x9bf3de05
+  .word 0x76cfa289
+  /* T[9] */
+  .word 0x1212d9e1
+  .word 0x919f116e
+  .word 0xeed8bf32
+  .word 0x2e85afd3
+  .word 0x0cc3f697
+  .word 0x5ce8d5da
+  .word 0x570ab1bf
+  .word 0x7ef2dc6e
+  .word 0x237f212c
+  .word 0xb9f133f5
+  .word 0x4ed65fd1
+  .word 0xcbf8928e
+  .word 0x3efa2391
+  .word 0x3997679c
+  .word 0xd5c06d90
+  .word 0x1e6c79c8
+  /* T[10] */
+  .word 0x976629d9
+  .word 0x26a948f6
+  .word 0xef152856
+  .word 0xeff8a854
+  .word 0x32862270
+  .word 0x1a07ed4e
+  .word 0x1f0e7a21
+  .word 0xed699b85
+  .word 0xfb20fbc4
+  .word 0x879875b3
+  .word 0x664efca0
+  .word 0xa8a3a14e
+  .word 0x040778b7
+  .word 0xde73e3af
+  .word 0xde9f25c8
+  .word 0x2f1e9f06
+  /* T[11] */
+  .word 0x96531782
+  .word 0xd997cc85
+  .word 0x64b8c49d
+  .word 0xbf677bf0
+  .word 0xa94deeb1
+  .word 0x987459ac
+  .word 0x288d3474
+  .word 0xa07cd0d4
+  .word 0x1dbc8c4b
+  .word 0x373b54ea
+  .word 0x19673710
+  .word 0x64d0ef77
+  .word 0x77e1260a
+  .word 0x5a294a45
+  .word 0x7effe243
+  .word 0xcc98ddf0
+  /* T[12] */
+  .word 0x9399b23a
+  .word 0x98a75c08
+  .word 0x7e7179ec
+  .word 0xae477c97
+  .word 0x13bfaf8b
+  .word 0x4f4ad93e
+  .word 0xaf1f8ad2
+  .word 0xe07da554
+  .word 0xa9c39f2c
+  .word 0xb2381d30
+  .word 0x5773291c
+  .word 0x713b257e
+  .word 0x0393fa9f
+  .word 0x349982e8
+  .word 0xa1b42171
+  .word 0xa7de9ac9
+  /* T[13] */
+  .word 0x7424842d
+  .word 0x6b6986c8
+  .word 0xc69a7f8a
+  .word 0x831f9c5b
+  .word 0xf8cdf9a9
+  .word 0x6745ded8
+  .word 0x8761b189
+  .word 0xaf5c0c97
+  .word 0x856d9d56
+  .word 0x04be87bf
+  .word 0x34bf4c3f
+  .word 0x5d20e408
+  .word 0x2d23bb21
+  .word 0x22d40d4d
+  .word 0x1db2f627
+  .word 0x5e63c348
+  /* T[14] */
+  .word 0x5126542d
+  .word 0xf4b7433a
+  .word 0xf8caf921
+  .word 0x78d28151
+  .word 0xd3c84d3f
+  .word 0xa65dfdb2
+  .word 0x50200d9c
+  .word 0x4e749a3a
+  .word 0x8033440a
+  .word 0xb7bd80b6
+  .word 0x44887e1c
+  .word 0xd4127c14
+  .word 0x740006cb
+  .word 0xfb595458
+  .word 0x01bd932a
+  .word 0xf06ceded
+  /* T[15] */
+  .word 0x1929c1f5
+  .word 0x288b3fef
+  .word 0x8eed290c
+  .word 0x3a02c96c
+  .word 0x9424eb1a
+  .word 0x182511c6
+  .word 0x9fd6473c
+  .word 0x0ce435ce
+  .word 0x532b8747
+  .word 0x6dc2ce3c
+  .word 0x2302437e
+  .word 0xa24eb8b7
+  .word 0x78a65bc4
+  .word 0xfba1b6ad
+  .word 0x1bf18a76
+  .word 0xdab54c04
+
 .section .bss
 
 /* random scalar k (in two 320b shares) */
@@ -97,11 +97,8 @@ p256_sign:
   bn.lid    x2, 0(x3)
 
   /* scalar multiplication with base point (projective)
-     (x_1, y_1, z_1) = (w8, w9, w10) <= k*G
-         = ([w0,w1] + [w2,w3])*(dmem[p256_gx], dmem[p256_gy]) */
-  la        x21, p256_gx
-  la        x22, p256_gy
-  jal       x1, scalar_mult_int
+     (x_1, y_1, z_1) = (w8, w9, w10) <= k*G = ([w0,w1] + [w2,w3])*G */
+  jal       x1, base_mult_int
 
   /* Convert masked result back to affine coordinates.
      R = (x_a, y_a) = (w11, w12) */
@@ -52,7 +52,7 @@
  *
  * Flags: Flags have no meaning beyond the scope of this subroutine.
  *
- * clobbered registers: x2, x3, x11, x12, x13, x14, x17 to x24, w0 to w25
+ * clobbered registers: x2, x3, x11 to x14, x17 to x22, w0 to w25
  * clobbered flag groups: FG0
  */
 p256_verify:
@@ -136,133 +136,136 @@ p256_verify:
   jal       x1, setup_modp
 
   /* load public key Q from dmem and use in projective form (set z to 1)
-     Q = (w11, w12, w13) = (dmem[x], dmem[y], 1) */
-  li        x2, 11
+     Q = (w8, w9, w10) = (dmem[x], dmem[y], 1) */
+  li        x2, 8
   la        x21, x
   bn.lid    x2++, 0(x21)
   la        x22, y
   bn.lid    x2, 0(x22)
-  bn.addi   w13, w31, 1
-
-  /* load base point G and use in projective form (set z to 1)
-     G = (w8, w9, w10) = (x_g, y_g, 1) */
-  li        x13, 8
-  la        x23, p256_gx
-  bn.lid    x13, 0(x23)
-  li        x14, 9
-  la        x24, p256_gy
-  bn.lid    x14, 0(x24)
   bn.addi   w10, w31, 1
 
-  /* The rest of the routine implements a variable time double-and-add
-     algorithm. For the signature verification we need to compute the point
-     C = (x1, y1) = u_1*G + u_2*Q. This can be done in a single
-     double-and-add routine by using Shamir's Trick. */
-
-  /* G+Q = (w3,w4,w5) = (w11,w12,w13) = (w8,w9,w10) (+) (w11,w12,w13) */
-  jal       x1, proj_add
-  bn.mov    w3, w11
-  bn.mov    w4, w12
-  bn.mov    w5, w13
-
-  /* w2 = u_2 & u_0 = w0 & w1*/
-  bn.and    w2, w0, w1
+  /* The rest of the routine computes C = (x1, y1) = u1*G + u2*Q in a single
+     variable time double-and-add loop (Shamir's trick). For u2*Q, a sliding
+     window of width 3 over the odd multiples Q, 3Q, 5Q and 7Q is used. For
+     u1*G, the fixed-base comb table of G is used, which contributes in the
+     last 81 iterations of the loop only. */
 
-  /* init double and add algorithm with (0, 1, 0) */
-  bn.mov    w11, w31
-  bn.addi   w12, w31, 1
-  bn.mov    w13, w31
+  /* Precompute the odd multiples 3Q, 5Q and 7Q in projective form. Q itself
+     is taken from the affine public key.
+       dmem[verify_q_table + 96*(j-1)] <= (2*j + 1)*Q for j = 1..3 */
 
-  /* initialize counter to 0 and set x11=1. */
-  li        x12, 0
-  li        x11, 1
+  /* 2Q = (w8, w9, w10) <= 2*(w8, w9, w10) */
+  jal       x1, proj_double
 
-  /* main loop with dicreasing index i (i=255 downto 0) */
-  loopi     256, 38
+  /* (w11, w12, w13) <= Q = (dmem[x], dmem[y], 1) */
+  li        x2, 11
+  bn.lid    x2++, 0(x21)
+  bn.lid    x2, 0(x22)
+  bn.addi   w13, w31, 1
 
-    /* always double: C = (w11,w12,w13) <= 2 (*) C = 2 (*) (w11,w12,w13) */
-    bn.mov    w8, w11
-    bn.mov    w9, w12
-    bn.mov    w10, w13
+  la        x3, verify_q_table
+  loopi     3, 6
+    /* (w11, w12, w13) <= 2Q (+) (2*j - 1)*Q = (2*j + 1)*Q */
     jal       x1, proj_add
 
-    /* if either  u_1[i] == 0 or u_2[i] == 0 jump to 'no_both' */
-    bn.add    w2, w2, w2
-    csrrs     x2, FG0, x0
-    andi      x2, x2, 1
-    beq       x2, x0, no_both
-
-    /* hardening: this block should only be reachable if x2=1, so this should
-       have no effect */
-    and       x11, x11, x2
-
-    /* both bits at current index (u1[i] and u2[i]) are set:
-       do C <= C + (P + Q) and jump to end */
-    bn.mov    w8, w3
-    bn.mov    w9, w4
-    bn.mov    w10, w5
-    jal       x1, proj_add
-    jal       x0, no_q
-    unimp
-    unimp
-
-    /* either u1[i] or u2[i] is set, but not both */
-    no_both:
-    /* hardening: this block should only be reachable if x2=0, so this should
-       have no effect */
-    srl       x11, x11, x2
-
-    /* if u2[i] is not set jump to 'no_g' */
-    bn.add    w6, w0, w0
-    csrrs     x2, FG0, x0
-    andi      x2, x2, 1
-    beq       x2, x0, no_g
-
-    /* hardening: this block should only be reachable if x2=1, so this should
-       have no effect */
-    and       x11, x11, x2
-
-    /* u2[i] is set: do C <= C + Q */
-    bn.lid    x13, 0(x21)
-    bn.lid    x14, 0(x22)
-    bn.addi   w10, w31, 1
-    jal       x1, proj_add
+    /* dmem[x3] <= (w11, w12, w13) */
+    li        x2, 11
+    bn.sid    x2++, 0(x3)
+    bn.sid    x2++, 32(x3)
+    bn.sid    x2, 64(x3)
+    addi      x3, x3, 96
+
+  /* Split u1 into the 4 teeth of the comb and left-align each of them.
+       w1 <= u1[80:0] << 175
+       w2 <= u1[161:81] << 175
+       w3 <= u1[242:162] << 175
+       w4 <= u1[255:243] << 175 */
+  bn.rshi   w4, w31, w1 >> 68
+  bn.rshi   w3, w1, w31 >> 243
+  bn.rshi   w2, w1, w31 >> 162
+  bn.rshi   w1, w1, w31 >> 81
+
+  /* init double and add algorithm with C = (w8, w9, w10) <= (0, 1, 0) */
+  bn.mov    w8, w31
+  bn.addi   w9, w31, 1
+  bn.mov    w10, w31
+
+  /* init pointers to the window scratch word and the comb table
+       x18 <= verify_window
+       x17 <= p256_comb_table */
+  la        x18, verify_window
+  la        x17, p256_comb_table
+
+  /* No window of u2 is pending: x14 <= 0. */
+  li        x14, 0
 
-    no_g:
-    /* if u1[i] is not set jump to 'no_q' */
-    bn.add    w6, w1, w1
-    csrrs     x2, FG0, x0
-    andi      x2, x2, 1
-    beq       x2, x0, no_q
+  /* initialize counter to 0 and set x11=1. */
+  li        x12, 0
+  li        x11, 1
 
-    /* hardening: this block should only be reachable if x2=1, so this should
-       have no effect */
-    and       x11, x11, x2
+  /* first part of main loop with decreasing index i (i=255 downto 81) */
+  loopi     175, 3
+    /* always double: C = (w8, w9, w10) <= 2 (*) C */
+    jal       x1, proj_double
 
-    /* load base point x-coordinate
-      w8 <= g_x = dmem [p256_gx]; w9 <= g_y = dmem[p256_gy] */
-    bn.lid    x13, 0(x23)
-    bn.lid    x14, 0(x24)
+    /* process bit i of u2 */
+    jal       x1, verify_q_window_step
 
-    /* u1[i] is set: do C <= C + G */
-    bn.addi   w10, w31, 1
-    jal       x1, proj_add
+    /* increment counter */
+    add      x12, x12, x11
 
-    no_q:
-    /* left shift w0 and w1 to decrease index */
-    bn.add    w0, w0, w0
+  /* second part of main loop with decreasing index i (i=80 downto 0) */
+  loopi     81, 25
+    /* always double: C = (w8, w9, w10) <= 2 (*) C */
+    jal       x1, proj_double
+
+    /* process bit i of u2 */
+    jal       x1, verify_q_window_step
+
+    /* Gather the bits i, 81+i, 162+i and 243+i of u1 into the comb index and
+       shift the teeth left by 1 bit.
+         x19 <= idx = MSb(w4) | MSb(w3) | MSb(w2) | MSb(w1) */
+    bn.rshi   w5, w31, w4 >> 255
+    bn.rshi   w5, w5, w3 >> 255
+    bn.rshi   w5, w5, w2 >> 255
+    bn.rshi   w5, w5, w1 >> 255
+    bn.add    w4, w4, w4
+    bn.add    w3, w3, w3
+    bn.add    w2, w2, w2
     bn.add    w1, w1, w1
+    li        x2, 5
+    bn.sid    x2, 0(x18)
+    lw        x19, 0(x18)
+
+    /* no addition if idx == 0 */
+    beq       x19, x0, no_comb
+
+    /* load comb table entry T[idx] and use in projective form (set z to 1)
+       (w11, w12, w13) <= (dmem[x17 + 64*idx], dmem[x17 + 64*idx + 32], 1) */
+    slli      x3, x19, 6
+    add       x3, x3, x17
+    li        x2, 11
+    bn.lid    x2++, 0(x3)
+    bn.lid    x2, 32(x3)
+    bn.addi   w13, w31, 1
+
+    /* C = (w8, w9, w10) <= C (+) T[idx] */
+    jal       x1, proj_add
+    bn.mov    w8, w11
+    bn.mov    w9, w12
+    bn.mov    w10, w13
 
+    no_comb:
     /* increment counter */
     add      x12, x12, x11
 
   /* compute inverse of z-coordinate: w1 = z_c^-1  mod p */
-  bn.mov    w0, w13
+  bn.mov    w0, w10
   jal       x1, mod_inv_var
 
   /* convert x-coordinate of C back to affine: x1 = x_c * z_c^-1  mod p */
   bn.mov    w24, w1
-  bn.mov    w25, w11
+  bn.mov    w25, w8
   jal       x1, mul_modp
 
   /* final reduction: w24 = x1 <= x1 mod n */
@@ -285,6 +288,121 @@ p256_verify:
   ret
 
 
+/**
+ * Process one bit of u2 for the sliding window in ECDSA verification
+ *
+ * If no window is pending and bit i of u2 is set, a new window is started with
+ * bits i to i-2 of u2. Trailing zeros are stripped from the window, so its
+ * value v is odd and v*Q is one of the precomputed multiples. Once the loop
+ * reaches the last bit of the window, v*Q is added to C. Finally, u2 is
+ * shifted left by one bit.
+ *
+ * This routine runs in variable time.
+ *
+ * @param[in]  w0: u2, left-aligned such that bit i is the MSb
+ * @param[in]  x13: v, value of the pending window
+ * @param[in]  x14: number of bits of the pending window not processed yet
+ *                  (0 if no window is pending)
+ * @param[in]  x18: dptr_window, pointer to a 256-bit scratch word in dmem
+ * @param[in]  x21: dptr_x, pointer to affine x-coordinate of Q in dmem
+ * @param[in]  x22: dptr_y, pointer to affine y-coordinate of Q in dmem
+ * @param[in]  dmem[verify_q_table]: odd multiples 3Q, 5Q, 7Q (projective)
+ * @param[in]  w8: x_c, x-coordinate of C
+ * @param[in]  w9: y_c, y-coordinate of C
+ * @param[in]  w10: z_c, z-coordinate of C
+ * @param[in]  w27: b, curve domain parameter
+ * @param[in]  w28: r256, constant, 2^256 mod p = 2^256 - p
+ * @param[in]  w29: r448, constant, 2^448 mod p
+ * @param[in]  w31: all-zero
+ * @param[in]  MOD: p, modulus of P-256 underlying finite field
+ * @param[out] w0: u2 << 1
+ * @param[out] x13: v, value of the pending window
+ * @param[out] x14: number of bits of the pending window not processed yet
+ * @param[out] w8: x_c, x-coordinate of updated C
+ * @param[out] w9: y_c, y-coordinate of updated C
+ * @param[out] w10: z_c, z-coordinate of updated C
+ *
+ * Flags: Flags have no meaning beyond the scope of this subroutine.
+ *
+ * clobbered registers: x2, x3, x11, x13, x14, w0, w5, w11 to w25
+ * clobbered flag groups: FG0
+ */
+verify_q_window_step:
+  /* skip the window search if a window is pending */
+  bne       x14, x0, q_window_pending
+
+  /* if u2[i] is not set jump to 'q_window_done' */
+  bn.add    w5, w0, w0
+  csrrs     x2, FG0, x0
+  andi      x2, x2, 1
+  beq       x2, x0, q_window_done
+
+  /* hardening: this block should only be reachable if x2=1, so this should
+     have no effect */
+  and       x11, x11, x2
+
+  /* start a new window of 3 bits
+       x13 <= v = u2[i:i-2]
+       x14 <= 3 */
+  bn.rshi   w5, w31, w0 >> 253
+  li        x2, 5
+  bn.sid    x2, 0(x18)
+  lw        x13, 0(x18)
+  li        x14, 3
+
+  /* strip trailing zeros from the window */
+  q_window_trim:
+  andi      x2, x13, 1
+  bne       x2, x0, q_window_pending
+  srli      x13, x13, 1
+  addi      x14, x14, -1
+  jal       x0, q_window_trim
+
+  q_window_pending:
+  /* if the window does not end at bit i jump to 'q_window_done' */
+  addi      x14, x14, -1
+  bne       x14, x0, q_window_done
+
+  /* if v != 1 jump to 'q_window_table' */
+  srli      x2, x13, 1
+  bne       x2, x0, q_window_table
+
+  /* load Q and use in projective form (set z to 1)
+       (w11, w12, w13) <= (dmem[x], dmem[y], 1) */
+  li        x2, 11
+  bn.lid    x2++, 0(x21)
+  bn.lid    x2, 0(x22)
+  bn.addi   w13, w31, 1
+  jal       x0, q_window_add
+
+  q_window_table:
+  /* load the precomputed multiple v*Q
+       (w11, w12, w13) <= dmem[verify_q_table + 96*((v >> 1) - 1)] */
+  addi      x2, x2, -1
+  slli      x3, x2, 6
+  slli      x2, x2, 5
+  add       x3, x3, x2
+  la        x2, verify_q_table
+  add       x3, x3, x2
+  li        x2, 11
+  bn.lid    x2++, 0(x3)
+  bn.lid    x2++, 32(x3)
+  bn.lid    x2, 64(x3)
+
+  q_window_add:
+  /* C = (w8, w9, w10) <= C (+) v*Q */
+  jal       x1, proj_add
+  bn.mov    w8, w11
+  bn.mov    w9, w12
+  bn.mov    w10, w13
+
+  q_window_done:
+  /* left shift u2 to decrease index */
+  bn.add    w0, w0, w0
+
+  ret
+
+
 /**
  * Variable time modular multiplicative inverse computation
  *
@@ -472,3 +590,15 @@ y:
 .weak x_r
 x_r:
   .zero 32
+
+.section .scratchpad
+
+/* Odd multiples 3Q, 5Q and 7Q of the public key (projective). */
+.balign 32
+verify_q_table:
+  .zero 288
+
+/* Scratch word for moving window bits to a GPR. */
+.balign 32
+verify_window:
+  .zero 32
@@ -0,0 +1,719 @@
+/* Copyright lowRISC contributors (OpenTitan project). */
+/* Licensed under the Apache License, Version 2.0, see LICENSE for details. */
+/* SPDX-License-Identifier: Apache-2.0 */
+
+/**
+ * RSA private-key operations with the Chinese Remainder Theorem (CRT).
+ *
+ * A CRT private key consists of the primes p and q and the values
+ *   dp = d mod (p - 1)
+ *   dq = d mod (q - 1)
+ *   qinv = q^-1 mod p.
+ *
+ * The exponents dp and dq are passed in two Boolean shares each. The primes
+ * must each have exactly half the bit length of the modulus, i.e. the MSB of
+ * their highest limb must be set; this holds for keys from `rsa_crt_keygen`
+ * and for all keys that are generated as in FIPS 186-5, Appendix A.1.3.
+ *
+ * These routines operate on the pre-defined memory locations set in
+ * `run_rsa_mem.s`.
+ */
+
+.text
+.globl rsa_crt_modexp
+.globl rsa_crt_verify
+.globl rsa_crt_derive
+.globl rsa_crt_keygen
+
+/**
+ * RSA private-key operation with the CRT.
+ *
+ * Returns s = m^d mod n, computed with Garner's recombination as
+ *   sp = (m mod p)^dp mod p
+ *   sq = (m mod q)^dq mod q
+ *   h = qinv * (sp - sq) mod p
+ *   s = sq + h * q.
+ *
+ * Both exponentiations are done by `modexp` on half-size operands. Since
+ * `modexp` has a cost cubic in the number of limbs, this is roughly four times
+ * faster than a single exponentiation modulo n.
+ *
+ * The result is not checked here; callers should check it with
+ * `rsa_crt_verify` before releasing it. A fault in either exponentiation would
+ * otherwise reveal one of the primes as gcd(s^e - m, n), see Boneh, DeMillo
+ * and Lipton, "On the Importance of Checking Cryptographic Protocols for
+ * Faults".
+ *
+ * This routine overwrites `mode` in DMEM; callers need to restore it.
+ *
+ * Flags: Flags have no meaning beyond the scope of this subroutine.
+ *
+ * @param[in]  x29: message blinding flag (enable if non-zero)
+ * @param[in]  x30: N, number of limbs in the modulus
+ * @param[in]  w31: all-zero
+ * @param[in]  dmem[inout..inout+(N*32)]: m, base for exponentiation
+ * @param[in]  dmem[rsa_p..rsa_p+(N/2*32)]: p, first prime
+ * @param[in]  dmem[rsa_q..rsa_q+(N/2*32)]: q, second prime
+ * @param[in]  dmem[rsa_d0..rsa_d0+(N/2*32)]: first share of dp
+ * @param[in]  dmem[rsa_d1..rsa_d1+(N/2*32)]: second share of dp
+ * @param[in]  dmem[rsa_g..rsa_g+(N/2*32)]: first share of dq
+ * @param[in]  dmem[rsa_h..rsa_h+(N/2*32)]: second share of dq
+ * @param[in]  dmem[rsa_qinv..rsa_qinv+(N/2*32)]: qinv, q^-1 mod p
+ * @param[out] dmem[rsa_n..rsa_n+(N*32)]: n = p * q, public modulus
+ * @param[out] dmem[rsa_d1..rsa_d1+(N*32)]: s = m^d mod n, result
+ * @param[out] dmem[inout..inout+(N*32)]: m (unchanged)
+ *
+ * clobbered registers: x2 to x27, x31
+ *                      w0, w2, w3, w4 to w[4+N/2-1], w20 to w30
+ * clobbered flag groups: FG0, FG1
+ */
+rsa_crt_modexp:
+  /* Switch to the limb count of the primes.
+       x30 <= N/2 */
+  srli     x30, x30, 1
+
+  /* Move the inputs that `modexp` would overwrite out of the way.
+       dmem[buf4..buf4+(N/2*32)] <= m mod 2^(N/2*256)
+       dmem[rsa_n+256..rsa_n+256+(N/2*32)] <= qinv */
+  la       x3, inout
+  la       x4, buf4
+  jal      x1, copy_limbs
+  la       x3, rsa_qinv
+  la       x4, rsa_n
+  addi     x4, x4, 256
+  jal      x1, copy_limbs
+
+  /* dmem[r0..r0+(N/2*32)] <= sp = (m mod p)^dp mod p */
+  la       x3, rsa_p
+  jal      x1, crt_modexp_prime
+
+  /* Keep sp in the upper half of RR, which `modexp` does not use for N/2
+     limbs.
+       dmem[RR+256..RR+256+(N/2*32)] <= sp */
+  la       x3, r0
+  la       x4, RR
+  addi     x4, x4, 256
+  jal      x1, copy_limbs
+
+  /* Move the shares of dq to where `modexp` expects the exponent.
+       dmem[rsa_d0..rsa_d0+(N/2*32)] <= dmem[rsa_g..rsa_g+(N/2*32)]
+       dmem[rsa_d1..rsa_d1+(N/2*32)] <= dmem[rsa_h..rsa_h+(N/2*32)] */
+  la       x3, rsa_g
+  la       x4, rsa_d0
+  jal      x1, copy_limbs
+  la       x3, rsa_h
+  la       x4, rsa_d1
+  jal      x1, copy_limbs
+
+  /* dmem[r0..r0+(N/2*32)] <= sq = (m mod q)^dq mod q */
+  la       x3, rsa_q
+  jal      x1, crt_modexp_prime
+
+  /* Compute the Montgomery constants for p again.
+       dmem[rsa_n..rsa_n+(N/2*32)] <= p
+       dmem[RR..RR+(N/2*32)] <= R^2 mod p
+       w1 <= m0' */
+  la       x3, rsa_p
+  la       x4, rsa_n
+  jal      x1, copy_limbs
+  la       x16, rsa_n
+  la       x17, RR
+  jal      x1, modload
+
+  /* Constant wide register pointers for montmul. */
+  li       x9, 3
+  li       x10, 4
+  li       x11, 2
+  addi     x31, x30, -1
+
+  /* Reduce sq modulo p. Since p and q have the same bit length, sq < 2p.
+       dmem[r2..r2+(N/2*32)] <= sq mod p */
+  bn.mov   w22, w31
+  la       x12, r0
+  la       x14, r2
+  la       x16, rsa_n
+  jal      x1, cond_sub_modulus
+
+  /* dmem[r2..r2+(N/2*32)] <= (sp - sq) mod p */
+  la       x12, RR
+  addi     x12, x12, 256
+  la       x13, r2
+  la       x14, r2
+  jal      x1, modsub
+
+  /* [w[4+N/2-1]:w4] <= montmul(qinv, sp - sq) = qinv * (sp - sq) * R^-1 mod p
+     dmem[r2..r2+(N/2*32)] <= [w[4+N/2-1]:w4] */
+  la       x19, rsa_n
+  addi     x19, x19, 256
+  la       x20, r2
+  jal      x1, montmul
+  li       x2, 4
+  la       x3, r2
+  loop     x30, 2
+    bn.sid   x2, 0(x3++)
+    addi     x2, x2, 1
+
+  /* [w[4+N/2-1]:w4] <= montmul(dmem[r2], R^2) = qinv * (sp - sq) mod p
+     dmem[r1..r1+(N/2*32)] <= [w[4+N/2-1]:w4] */
+  la       x19, r2
+  la       x20, RR
+  jal      x1, montmul
+  li       x2, 4
+  la       x3, r1
+  loop     x30, 2
+    bn.sid   x2, 0(x3++)
+    addi     x2, x2, 1
+
+  /* The Montgomery product is less than R < 2p, so one conditional
+     subtraction reduces it fully.
+       dmem[r1..r1+(N/2*32)] <= h = qinv * (sp - sq) mod p */
+  bn.mov   w22, w31
+  la       x12, r1
+  la       x14, r1
+  jal      x1, cond_sub_modulus
+
+  /* dmem[rsa_n..rsa_n+(N*32)] <= n = p * q */
+  la       x10, rsa_p
+  la       x11, rsa_q
+  la       x12, rsa_n
+  addi     x31, x30, 0
+  jal      x1, bignum_mul
+
+  /* dmem[rsa_d0..rsa_d0+(N*32)] <= h * q */
+  la       x10, r1
+  la       x11, rsa_q
+  la       x12, rsa_d0
+  addi     x31, x30, 0
+  jal      x1, bignum_mul
+
+  /* Add sq to h * q. Since h < p and sq < q, the sum is less than n.
+       dmem[rsa_d1..rsa_d1+(N*32)] <= s = h * q + sq */
+  li       x2, 20
+  li       x3, 21
+  la       x4, rsa_d0
+  la       x5, r0
+  la       x6, rsa_d1
+  bn.add   w31, w31, w31
+  loop     x30, 4
+    bn.lid   x2, 0(x4++)
+    bn.lid   x3, 0(x5++)
+    bn.addc  w20, w20, w21
+    bn.sid   x2, 0(x6++)
+  loop     x30, 3
+    bn.lid   x2, 0(x4++)
+    bn.addc  w20, w20, w31
+    bn.sid   x2, 0(x6++)
+
+  /* Restore the lower half of m.
+       dmem[inout..inout+(N/2*32)] <= dmem[buf4..buf4+(N/2*32)] */
+  la       x3, buf4
+  la       x4, inout
+  jal      x1, copy_limbs
+
+  /* Restore the limb count.
+       x30 <= N */
+  slli     x30, x30, 1
+
+  ret
+
+/**
+ * Check the result of `rsa_crt_modexp` with the public exponent.
+ *
+ * Computes s^65537 mod n and compares it with m. If they match, this routine
+ * copies s to the output buffer and returns. Otherwise, it triggers an
+ * ILLEGAL_INSN error, so that no faulty result is ever released.
+ *
+ * Flags: Flags have no meaning beyond the scope of this subroutine.
+ *
+ * @param[in]  x30: N, number of limbs in the modulus
+ * @param[in]  w31: all-zero
+ * @param[in]  dmem[rsa_n..rsa_n+(N*32)]: n, public modulus
+ * @param[in]  dmem[rsa_d1..rsa_d1+(N*32)]: s, result of `rsa_crt_modexp`
+ * @param[in]  dmem[inout..inout+(N*32)]: m, base for exponentiation
+ * @param[out] dmem[inout..inout+(N*32)]: s
+ *
+ * clobbered registers: x2 to x13, x16 to x31
+ *                      w0 to w3, w4 to w[4+N-1], w20 to w30
+ * clobbered flag groups: FG0, FG1
+ */
+rsa_crt_verify:
+  /* `modexp_65537` overwrites its input, so work on a copy of s.
+       dmem[rsa_d0..rsa_d0+(N*32)] <= s */
+  la       x3, rsa_d1
+  la       x4, rsa_d0
+  jal      x1, copy_limbs
+
+  /* Compute the Montgomery constants for n. */
+  la       x16, rsa_n
+  la       x17, RR
+  jal      x1, modload
+
+  /* dmem[r2..r2+(N*32)] <= s^65537 mod n */
+  la       x2, r2
+  la       x14, rsa_d0
+  la       x16, rsa_n
+  la       x17, RR
+  jal      x1, modexp_65537
+
+  /* Accumulate the differences of s^65537 mod n and m.
+       w22 <= OR_i (dmem[r2][i] XOR dmem[inout][i]) */
+  li       x2, 20
+  li       x3, 21
+  la       x4, r2
+  la       x5, inout
+  bn.mov   w22, w31
+  loop     x30, 4
+    bn.lid   x2, 0(x4++)
+    bn.lid   x3, 0(x5++)
+    bn.xor   w20, w20, w21
+    bn.or    w22, w22, w20
+
+  /* Fail if FG0.Z is false. */
+  bn.cmp   w22, w31
+  csrrs    x2, FG0, x0
+  andi     x2, x2, 8
+  bne      x2, x0, _rsa_crt_verify_ok
+  unimp
+  unimp
+  unimp
+
+  _rsa_crt_verify_ok:
+
+  /* dmem[inout..inout+(N*32)] <= s */
+  la       x3, rsa_d1
+  la       x4, inout
+  jal      x1, copy_limbs
+
+  ret
+
+/**
+ * Derive a CRT private key from the primes.
+ *
+ * Computes
+ *   dp = 65537^-1 mod (p - 1)
+ *   dq = 65537^-1 mod (q - 1)
+ *   qinv = q^-1 mod p = q^(p-2) mod p
+ *   n = p * q
+ * and splits dp and dq into two Boolean shares each. The primes must be
+ * distinct and gcd(p - 1, 65537) = gcd(q - 1, 65537) = 1.
+ *
+ * This routine overwrites `mode` in DMEM; callers need to restore it.
+ *
+ * Flags: Flags have no meaning beyond the scope of this subroutine.
+ *
+ * @param[in]  x30: N, number of limbs in the modulus
+ * @param[in]  w31: all-zero
+ * @param[in]  dmem[rsa_p..rsa_p+(N/2*32)]: p, first prime
+ * @param[in]  dmem[rsa_q..rsa_q+(N/2*32)]: q, second prime
+ * @param[out] dmem[rsa_n..rsa_n+(N*32)]: n, public modulus
+ * @param[out] dmem[rsa_d0..rsa_d0+(N/2*32)]: first share of dp
+ * @param[out] dmem[rsa_d1..rsa_d1+(N/2*32)]: second share of dp
+ * @param[out] dmem[rsa_g..rsa_g+(N/2*32)]: first share of dq
+ * @param[out] dmem[rsa_h..rsa_h+(N/2*32)]: second share of dq
+ * @param[out] dmem[rsa_qinv..rsa_qinv+(N/2*32)]: qinv
+ *
+ * clobbered registers: x2 to x27, x29, x31
+ *                      w0, w2, w3, w4 to w[4+N/2-1], w20 to w30
+ * clobbered flag groups: FG0, FG1
+ */
+rsa_crt_derive:
+  /* Switch to the limb count of the primes.
+       x30 <= N/2 */
+  srli     x30, x30, 1
+
+  /* Compute the Montgomery constants for p.
+       dmem[rsa_n..rsa_n+(N/2*32)] <= p */
+  la       x3, rsa_p
+  la       x4, rsa_n
+  jal      x1, copy_limbs
+  la       x16, rsa_n
+  la       x17, RR
+  jal      x1, modload
+
+  /* Split the exponent p - 2 into two shares for `modexp`.
+       dmem[rsa_d0..rsa_d0+(N/2*32)] <= (p - 2) ^ rand
+       dmem[rsa_d1..rsa_d1+(N/2*32)] <= rand */
+  li       x2, 20
+  li       x3, 22
+  la       x4, rsa_p
+  la       x5, rsa_d0
+  la       x6, rsa_d1
+  bn.addi  w21, w31, 2
+  bn.add   w31, w31, w31
+  loop     x30, 8
+    bn.lid   x2, 0(x4++)
+    bn.subb  w20, w20, w21
+    bn.mov   w21, w31
+    bn.wsrr  w22, URND
+    bn.xor   w20, w20, w22
+    bn.sid   x2, 0(x5++)
+    bn.xor   w31, w31, w31 # dummy instruction
+    bn.sid   x3, 0(x6++)
+
+  /* Compute qinv by Fermat's little theorem, without message blinding.
+       dmem[r0..r0+(N/2*32)] <= q
+       dmem[r0..r0+(N/2*32)] <= q^(p-2) mod p */
+  la       x3, rsa_q
+  la       x4, r0
+  jal      x1, copy_limbs
+  li       x29, 0
+  jal      x1, modexp
+
+  /* dmem[rsa_qinv..rsa_qinv+(N/2*32)] <= qinv */
+  la       x3, r0
+  la       x4, rsa_qinv
+  jal      x1, copy_limbs
+
+  /* dmem[rsa_d0..rsa_d0+(N/2*32)] <= dp = 65537^-1 mod (p - 1) */
+  la       x3, rsa_p
+  la       x4, rsa_d0
+  jal      x1, modinv_f4_prime
+
+  /* dmem[rsa_g..rsa_g+(N/2*32)] <= dq = 65537^-1 mod (q - 1) */
+  la       x3, rsa_q
+  la       x4, rsa_g
+  jal      x1, modinv_f4_prime
+
+  /* Boolean-mask dp and dq. */
+  la       x12, rsa_d0
+  la       x13, rsa_d1
+  jal      x1, mask_limbs
+  la       x12, rsa_g
+  la       x13, rsa_h
+  jal      x1, mask_limbs
+
+  /* dmem[rsa_n..rsa_n+(N*32)] <= n = p * q */
+  la       x10, rsa_p
+  la       x11, rsa_q
+  la       x12, rsa_n
+  addi     x31, x30, 0
+  jal      x1, bignum_mul
+
+  /* Restore the limb count.
+       x30 <= N */
+  slli     x30, x30, 1
+
+  ret
+
+/**
+ * Generate a CRT private key.
+ *
+ * Generates the primes p and q as `rsa_keygen` does and derives the rest of
+ * the key with `rsa_crt_derive`.
+ *
+ * This routine overwrites `mode` in DMEM; callers need to restore it.
+ *
+ * @param[in]  x30: N, number of limbs in the modulus
+ * @param[in]  w31: all-zero
+ * @param[out] dmem[rsa_p..rsa_p+(N/2*32)]: p, first prime
+ * @param[out] dmem[rsa_q..rsa_q+(N/2*32)]: q, second prime
+ * @param[out] dmem[...]: n, dp, dq and qinv as for `rsa_crt_derive`
+ *
+ * clobbered registers: x2 to x27, x29, x31
+ *                      w0, w2, w3, w4 to w[4+N/2-1], w20 to w30
+ * clobbered flag groups: FG0, FG1
+ */
+rsa_crt_keygen:
+  /* dmem[rsa_p] <= p
+     dmem[rsa_q] <= q */
+  srli     x30, x30, 1
+  jal      x1, gen_p
+  jal      x1, gen_q
+  slli     x30, x30, 1
+
+  jal      x1, rsa_crt_derive
+
+  ret
+
+/**
+ * Exponentiation modulo one of the primes for `rsa_crt_modexp`.
+ *
+ * Returns dmem[r0] = (m mod P)^d mod P, where d is given in Boolean shares in
+ * dmem[rsa_d0] and dmem[rsa_d1].
+ *
+ * @param[in]  x3: dptr_P, dmem pointer to the prime P
+ * @param[in]  x29: message blinding flag (enable if non-zero)
+ * @param[in]  x30: N/2, number of limbs of P
+ * @param[in]  w31: all-zero
+ * @param[in]  dmem[buf4..buf4+(N/2*32)]: lower half of m
+ * @param[in]  dmem[r0+(N/2*32)..r0+(N*32)]: upper half of m
+ * @param[out] dmem[rsa_n..rsa_n+(N/2*32)]: P
+ * @param[out] dmem[r0..r0+(N/2*32)]: result
+ *
+ * clobbered registers: x2 to x22, x31
+ *                      w0, w2, w3, w4 to w[4+N/2-1], w20 to w30
+ * clobbered flag groups: FG0, FG1
+ */
+crt_modexp_prime:
+  /* Compute the Montgomery constants for P.
+       dmem[rsa_n..rsa_n+(N/2*32)] <= P */
+  la       x4, rsa_n
+  jal      x1, copy_limbs
+  la       x16, rsa_n
+  la       x17, RR
+  jal      x1, modload
+
+  /* Constant wide register pointers for montmul. */
+  li       x9, 3
+  li       x10, 4
+  li       x11, 2
+  addi     x31, x30, -1
+
+  /* Reduce the upper half of m, which is < R. The Montgomery product is again
+     < R, and R < 2P since P has exactly 256*N/2 bits.
+       [w[4+N/2-1]:w4] <= montmul(m_hi, R^2) = m_hi * R mod P
+       dmem[r2..r2+(N/2*32)] <= m_hi * R mod P */
+  la       x16, rsa_n
+  la       x19, r0
+  slli     x2, x30, 5
+  add      x19, x19, x2
+  la       x20, RR
+  jal      x1, montmul
+  li       x2, 4
+  la       x3, r2
+  loop     x30, 2
+    bn.sid   x2, 0(x3++)
+    addi     x2, x2, 1
+  bn.mov   w22, w31
+  la       x12, r2
+  la       x14, r2
+  jal      x1, cond_sub_modulus
+
+  /* dmem[r0..r0+(N/2*32)] <= m_lo mod P */
+  la       x12, buf4
+  la       x14, r0
+  jal      x1, cond_sub_modulus
+
+  /* dmem[r0..r0+(N/2*32)] <= (m_hi * R + m_lo) mod P = m mod P */
+  la       x12, r0
+  la       x13, r2
+  la       x14, r0
+  jal      x1, modadd
+
+  /* dmem[r0..r0+(N/2*32)] <= (m mod P)^d mod P */
+  jal      x1, modexp
+
+  ret
+
+/**
+ * Constant-time modular addition.
+ *
+ * Returns C = (A + B) mod M for A, B < M.
+ *
+ * Flags: Flags have no meaning beyond the scope of this subroutine.
+ *
+ * @param[in]  x12: dptr_a, dmem pointer to first limb of A
+ * @param[in]  x13: dptr_b, dmem pointer to first limb of B
+ * @param[in]  x14: dptr_c, dmem pointer to first limb of C (may equal x12/x13)
+ * @param[in]  x16: dptr_M, dmem pointer to first limb of modulus M
+ * @param[in]  x30: N, number of limbs
+ * @param[in]  w31: all-zero
+ *
+ * clobbered registers: x2 to x6, x12, w20 to w22
+ * clobbered flag groups: FG0, FG1
+ */
+modadd:
+  /* dmem[dptr_c..dptr_c+(N*32)] <= (A + B) mod 2^(256*N)
+     w22 <= (A + B) >> (256*N) */
+  li       x2, 20
+  li       x3, 21
+  addi     x4, x12, 0
+  addi     x5, x13, 0
+  addi     x6, x14, 0
+  bn.add   w31, w31, w31
+  loop     x30, 4
+    bn.lid   x2, 0(x4++)
+    bn.lid   x3, 0(x5++)
+    bn.addc  w20, w20, w21
+    bn.sid   x2, 0(x6++)
+  bn.addc  w22, w31, w31
+
+  /* Subtract M if the sum is at least M (tail-call). */
+  addi     x12, x14, 0
+  jal      x0, cond_sub_modulus
+
+/**
+ * Constant-time modular subtraction.
+ *
+ * Returns C = (A - B) mod M for A, B < M.
+ *
+ * Flags: Flags have no meaning beyond the scope of this subroutine.
+ *
+ * @param[in]  x12: dptr_a, dmem pointer to first limb of A
+ * @param[in]  x13: dptr_b, dmem pointer to first limb of B
+ * @param[in]  x14: dptr_c, dmem pointer to first limb of C (may equal x12/x13)
+ * @param[in]  x16: dptr_M, dmem pointer to first limb of modulus M
+ * @param[in]  x30: N, number of limbs
+ * @param[in]  w31: all-zero
+ *
+ * clobbered registers: x2 to x6, w20 to w22
+ * clobbered flag groups: FG0
+ */
+modsub:
+  /* dmem[dptr_c..dptr_c+(N*32)] <= (A - B) mod 2^(256*N)
+     FG0.C <= A < B */
+  li       x2, 20
+  li       x3, 21
+  addi     x4, x12, 0
+  addi     x5, x13, 0
+  addi     x6, x14, 0
+  bn.add   w31, w31, w31
+  loop     x30, 4
+    bn.lid   x2, 0(x4++)
+    bn.lid   x3, 0(x5++)
+    bn.subb  w20, w20, w21
+    bn.sid   x2, 0(x6++)
+
+  /* w22 <= (A < B) ? 2^256 - 1 : 0 */
+  bn.subb  w22, w31, w31
+
+  /* dmem[dptr_c..dptr_c+(N*32)] <= C + (M & w22) */
+  addi     x4, x14, 0
+  addi     x5, x16, 0
+  addi     x6, x14, 0
+  bn.add   w31, w31, w31
+  loop     x30, 5
+    bn.lid   x2, 0(x4++)
+    bn.lid   x3, 0(x5++)
+    bn.and   w21, w21, w22
+    bn.addc  w20, w20, w21
+    bn.sid   x2, 0(x6++)
+
+  ret
+
+/**
+ * Constant-time conditional subtraction of the modulus.
+ *
+ * Returns C = A - M if A >= M, and C = A otherwise. A has N+1 limbs, where
+ * the highest one is passed in a register so that this routine can also
+ * reduce the carry of an addition. For C to be fully reduced, A must be less
+ * than 2*M.
+ *
+ * Flags: Flags have no meaning beyond the scope of this subroutine.
+ *
+ * @param[in]  x12: dptr_a, dmem pointer to first limb of A (lower N limbs)
+ * @param[in]  x14: dptr_c, dmem pointer to first limb of C (may equal x12)
+ * @param[in]  x16: dptr_M, dmem pointer to first limb of modulus M
+ * @param[in]  x30: N, number of limbs
+ * @param[in]  w22: highest limb of A
+ * @param[in]  w31: all-zero
+ *
+ * clobbered registers: x2 to x6, w20, w21
+ * clobbered flag groups: FG0, FG1
+ */
+cond_sub_modulus:
+  /* FG1.C <= A < M */
+  li       x2, 20
+  li       x3, 21
+  addi     x4, x12, 0
+  addi     x5, x16, 0
+  bn.add   w31, w31, w31, FG1
+  loop     x30, 3
+    bn.lid   x2, 0(x4++)
+    bn.lid   x3, 0(x5++)
+    bn.cmpb  w20, w21, FG1
+  bn.cmpb  w22, w31, FG1
+
+  /* dmem[dptr_c..dptr_c+(N*32)] <= FG1.C ? A : A - M */
+  addi     x4, x12, 0
+  addi     x5, x16, 0
+  addi     x6, x14, 0
+  bn.add   w31, w31, w31
+  loop     x30, 5
+    bn.lid   x2, 0(x4++)
+    bn.lid   x3, 0(x5++)
+    bn.subb  w21, w20, w21
+    bn.sel   w20, w20, w21, FG1.C
+    bn.sid   x2, 0(x6++)
+
+  ret
+
+/**
+ * Boolean-mask a bignum in place.
+ *
+ * @param[in]  x12: dptr_a, dmem pointer to A, overwritten with A ^ rand
+ * @param[in]  x13: dptr_b, dmem pointer to a buffer for rand
+ * @param[in]  x30: N, number of limbs
+ *
+ * clobbered registers: x2, x3, x12, x13, w20, w21
+ */
+mask_limbs:
+  li       x2, 20
+  li       x3, 21
+  loop     x30, 6
+    bn.lid   x2, 0(x12)
+    bn.wsrr  w21, URND
+    bn.xor   w20, w20, w21
+    bn.sid   x2, 0(x12++)
+    bn.xor   w31, w31, w31 # dummy instruction
+    bn.sid   x3, 0(x13++)
+
+  ret
+
+/**
+ * Compute the inverse of 65537 modulo P - 1 for a prime P.
+ *
+ * `modinv_f4` drops the carry of A + C, so it requires a modulus of less than
+ * 256*n-1 bits for n limbs. P - 1 has the full bit length here, so this runs
+ * `modinv_f4` with one more, zero limb.
+ *
+ * @param[in]  x3: dptr_P, dmem pointer to the prime P
+ * @param[in]  x4: dptr_d, dmem pointer to the result buffer
+ * @param[in]  x30: N, number of limbs of P
+ * @param[in]  w31: all-zero
+ * @param[out] dmem[dptr_d..dptr_d+(N*32)]: 65537^-1 mod (P - 1)
+ *
+ * clobbered registers: x2 to x5, x12 to x15, x20, x21, x31
+ *                      w0, w20 to w28
+ * clobbered flag groups: FG0, FG1
+ */
+modinv_f4_prime:
+  /* Keep the result pointer for later. */
+  addi     x5, x4, 0
+
+  /* dmem[RR..RR+((N+1)*32)] <= P - 1
+     P is odd, so subtracting one only clears the LSB. */
+  la       x4, RR
+  jal      x1, copy_limbs
+  li       x2, 31
+  bn.sid   x2, 0(x4)
+  li       x2, 20
+  la       x4, RR
+  bn.lid   x2, 0(x4)
+  bn.subi  w20, w20, 1
+  bn.sid   x2, 0(x4)
+
+  /* dmem[r0..r0+((N+1)*32)] <= 65537^-1 mod (P - 1) */
+  addi     x30, x30, 1
+  la       x12, RR
+  la       x13, r0
+  la       x14, work_buf
+  la       x15, rsa_n
+  li       x20, 20
+  li       x21, 21
+  jal      x1, modinv_f4
+  addi     x30, x30, -1
+
+  /* The inverse is less than P - 1, so its highest limb is zero.
+       dmem[dptr_d..dptr_d+(N*32)] <= dmem[r0..r0+(N*32)] */
+  la       x3, r0
+  addi     x4, x5, 0
+  jal      x1, copy_limbs
+
+  ret
+
+/**
+ * Copy a bignum.
+ *
+ * @param[in]  x3: dptr_a, dmem pointer to the source
+ * @param[in]  x4: dptr_c, dmem pointer to the destination
+ * @param[in]  x30: N, number of limbs
+ *
+ * clobbered registers: x3, x4, w0
+ */
+copy_limbs:
+  loop     x30, 2
+    bn.lid   x0, 0(x3++)
+    bn.sid   x0, 0(x4++)
+
+  ret
@@ -0,0 +1,118 @@
+/* Copyright lowRISC contributors (OpenTitan project). */
+/* Licensed under the Apache License, Version 2.0, see LICENSE for details. */
+/* SPDX-License-Identifier: Apache-2.0 */
+
+/**
+ * Entrypoint for Ed25519 operations.
+ *
+ * This binary has the following modes of operation:
+ * 1. MODE_VERIFY: verify an Ed25519 signature (cofactorless check)
+ * 2. MODE_VERIFY_COFACTORED: verify an Ed25519 signature (cofactored check)
+ */
+
+/**
+ * Mode magic values, generated with
+ * $ ./util/design/sparse-fsm-encode.py -d 6 -m 2 -n 11 \
+ *     --avoid-zero -s 2205231843
+ *
+ * Call the same utility with the same arguments and a higher -m to generate
+ * additional value(s) without changing the others or sacrificing mutual HD.
+ *
+ * TODO(#17727): in some places the OTBN assembler support for .equ directives
+ * is lacking, so they cannot be used in bignum instructions or pseudo-ops such
+ * as `li`. If support is added, we could use 32-bit values here instead of
+ * 11-bit.
+ */
+.equ MODE_VERIFY, 0x3d4
+.equ MODE_VERIFY_COFACTORED, 0x15b
+
+/**
+ * Make the mode constants visible to Ibex.
+ */
+.globl MODE_VERIFY
+.globl MODE_VERIFY_COFACTORED
+
+.section .text.start
+.globl start
+start:
+  /* Read the mode and tail-call the requested operation. */
+  la    x2, mode
+  lw    x2, 0(x2)
+
+  addi  x3, x0, MODE_VERIFY
+  beq   x2, x3, verify
+
+  addi  x3, x0, MODE_VERIFY_COFACTORED
+  beq   x2, x3, verify_cofactored
+
+  /* Invalid mode; fail. */
+  unimp
+  unimp
+  unimp
+
+/**
+ * Verify an Ed25519 signature with the cofactorless check [S]B = R + [k]A.
+ *
+ * @param[in]  dmem[ed25519_hash_k]: precomputed hash k (512 bits)
+ * @param[in]  dmem[ed25519_public_key]: encoded public key A
+ * @param[in]  dmem[ed25519_sig_R]: encoded signature point R
+ * @param[in]  dmem[ed25519_sig_S]: signature scalar S
+ * @param[out] dmem[ed25519_verify_result]: verification result
+ */
+verify:
+  li    x10, 0
+  jal   x1, ed25519_verify_var
+  ecall
+
+/**
+ * Verify an Ed25519 signature with the cofactored check
+ * [8][S]B = [8]R + [8][k]A.
+ *
+ * @param[in]  dmem[ed25519_hash_k]: precomputed hash k (512 bits)
+ * @param[in]  dmem[ed25519_public_key]: encoded public key A
+ * @param[in]  dmem[ed25519_sig_R]: encoded signature point R
+ * @param[in]  dmem[ed25519_sig_S]: signature scalar S
+ * @param[out] dmem[ed25519_verify_result]: verification result
+ */
+verify_cofactored:
+  li    x10, 1
+  jal   x1, ed25519_verify_var
+  ecall
+
+.bss
+
+/* Operation mode. */
+.globl mode
+.balign 4
+mode:
+  .zero 4
+
+/* Verification result (HARDENED_BOOL_TRUE or HARDENED_BOOL_FALSE). */
+.globl ed25519_verify_result
+.balign 4
+ed25519_verify_result:
+  .zero 4
+
+/* Precomputed hash k = SHA-512(dom2(F, C) || R || A || M). */
+.globl ed25519_hash_k
+.balign 32
+ed25519_hash_k:
+  .zero 64
+
+/* Encoded public key A. */
+.globl ed25519_public_key
+.balign 32
+ed25519_public_key:
+  .zero 32
+
+/* Encoded signature point R. */
+.globl ed25519_sig_R
+.balign 32
+ed25519_sig_R:
+  .zero 32
+
+/* Signature scalar S. */
+.globl ed25519_sig_S
+.balign 32
+ed25519_sig_S:
+  .zero 32
@@ -9,7 +9,7 @@
 
 /**
  * Mode magic values generated with
- * $ ./util/design/sparse-fsm-encode.py -d 4 -m 14 -n 11 \
+ * $ ./util/design/sparse-fsm-encode.py -d 4 -m 26 -n 11 \
  *    -s 347912204 --avoid-zero
  *
  * Call the same utility with the same arguments and a higher -m to generate
@@ -30,6 +30,24 @@
 .equ MODE_RSA_3072_KEYGEN, 0x4e0
 .equ MODE_RSA_4096_KEYGEN, 0x3ca
 
+# CRT key generation modes
+
+# Testing only! These key lengths are not supported by the cryptolib.
+.equ MODE_RSA_1024_KEYGEN_CRT, 0x47b
+# Supported key lengths.
+.equ MODE_RSA_2048_KEYGEN_CRT, 0x0a3
+.equ MODE_RSA_3072_KEYGEN_CRT, 0x159
+.equ MODE_RSA_4096_KEYGEN_CRT, 0x684
+
+# CRT key derivation (from p and q) modes
+
+# Testing only! These key lengths are not supported by the cryptolib.
+.equ MODE_RSA_1024_DERIVE_CRT, 0x734
+# Supported key lengths.
+.equ MODE_RSA_2048_DERIVE_CRT, 0x5fd
+.equ MODE_RSA_3072_DERIVE_CRT, 0x6ba
+.equ MODE_RSA_4096_DERIVE_CRT, 0x312
+
 # Encryption/Signature modes
 
 # Testing only! These key lengths are not supported by the cryptolib.
@@ -45,6 +63,15 @@
 .equ MODE_RSA_4096_MODEXP,    0x361
 .equ MODE_RSA_4096_MODEXP_F4, 0x3d4
 
+# CRT decryption/signature modes
+
+# Testing only! These key lengths are not supported by the cryptolib.
+.equ MODE_RSA_1024_MODEXP_CRT, 0x4d6
+# Supported key lengths.
+.equ MODE_RSA_2048_MODEXP_CRT, 0x7e7
+.equ MODE_RSA_3072_MODEXP_CRT, 0x643
+.equ MODE_RSA_4096_MODEXP_CRT, 0x426
+
 /**
  * Make the mode constants visible to Ibex.
  */
@@ -52,6 +79,14 @@
 .globl MODE_RSA_2048_KEYGEN
 .globl MODE_RSA_3072_KEYGEN
 .globl MODE_RSA_4096_KEYGEN
+.globl MODE_RSA_1024_KEYGEN_CRT
+.globl MODE_RSA_2048_KEYGEN_CRT
+.globl MODE_RSA_3072_KEYGEN_CRT
+.globl MODE_RSA_4096_KEYGEN_CRT
+.globl MODE_RSA_1024_DERIVE_CRT
+.globl MODE_RSA_2048_DERIVE_CRT
+.globl MODE_RSA_3072_DERIVE_CRT
+.globl MODE_RSA_4096_DERIVE_CRT
 .globl MODE_RSA_512_MODEXP
 .globl MODE_RSA_512_MODEXP_F4
 .globl MODE_RSA_1024_MODEXP
@@ -62,6 +97,10 @@
 .globl MODE_RSA_3072_MODEXP_F4
 .globl MODE_RSA_4096_MODEXP
 .globl MODE_RSA_4096_MODEXP_F4
+.globl MODE_RSA_1024_MODEXP_CRT
+.globl MODE_RSA_2048_MODEXP_CRT
+.globl MODE_RSA_3072_MODEXP_CRT
+.globl MODE_RSA_4096_MODEXP_CRT
 
 .section .text.start
 start:
@@ -84,6 +123,30 @@ start:
   add     x3, x0, MODE_RSA_4096_KEYGEN
   beq     x2, x3, rsa_4096_keygen
 
+  addi    x3, x0, MODE_RSA_1024_KEYGEN_CRT
+  beq     x2, x3, rsa_1024_keygen_crt
+
+  addi    x3, x0, MODE_RSA_2048_KEYGEN_CRT
+  beq     x2, x3, rsa_2048_keygen_crt
+
+  addi    x3, x0, MODE_RSA_3072_KEYGEN_CRT
+  beq     x2, x3, rsa_3072_keygen_crt
+
+  addi    x3, x0, MODE_RSA_4096_KEYGEN_CRT
+  beq     x2, x3, rsa_4096_keygen_crt
+
+  addi    x3, x0, MODE_RSA_1024_DERIVE_CRT
+  beq     x2, x3, rsa_1024_derive_crt
+
+  addi    x3, x0, MODE_RSA_2048_DERIVE_CRT
+  beq     x2, x3, rsa_2048_derive_crt
+
+  addi    x3, x0, MODE_RSA_3072_DERIVE_CRT
+  beq     x2, x3, rsa_3072_derive_crt
+
+  addi    x3, x0, MODE_RSA_4096_DERIVE_CRT
+  beq     x2, x3, rsa_4096_derive_crt
+
   addi    x3, x0, MODE_RSA_512_MODEXP
   beq     x2, x3, rsa_512_modexp
 
@@ -114,6 +177,18 @@ start:
   addi    x3, x0, MODE_RSA_4096_MODEXP_F4
   beq     x2, x3, rsa_4096_modexp_f4
 
+  addi    x3, x0, MODE_RSA_1024_MODEXP_CRT
+  beq     x2, x3, rsa_1024_modexp_crt
+
+  addi    x3, x0, MODE_RSA_2048_MODEXP_CRT
+  beq     x2, x3, rsa_2048_modexp_crt
+
+  addi    x3, x0, MODE_RSA_3072_MODEXP_CRT
+  beq     x2, x3, rsa_3072_modexp_crt
+
+  addi    x3, x0, MODE_RSA_4096_MODEXP_CRT
+  beq     x2, x3, rsa_4096_modexp_crt
+
   /* Unsupported mode; fail. */
   unimp
   unimp
@@ -232,6 +307,102 @@ rsa_4096_modexp_f4:
   /* Tail-call modexp_f4. */
   jal     x0, do_modexp_f4
 
+rsa_1024_keygen_crt:
+  /* Set the number of limbs for the modulus (1024 / 256 = 4). */
+  li      x30, 4
+
+  /* Tail-call CRT keygen. */
+  jal     x0, do_keygen_crt
+
+rsa_2048_keygen_crt:
+  /* Set the number of limbs for the modulus (2048 / 256 = 8). */
+  li      x30, 8
+
+  /* Tail-call CRT keygen. */
+  jal     x0, do_keygen_crt
+
+rsa_3072_keygen_crt:
+  /* Set the number of limbs for the modulus (3072 / 256 = 12). */
+  li      x30, 12
+
+  /* Tail-call CRT keygen. */
+  jal     x0, do_keygen_crt
+
+rsa_4096_keygen_crt:
+  /* Set the number of limbs for the modulus (4096 / 256 = 16). */
+  li      x30, 16
+
+  /* Tail-call CRT keygen. */
+  jal     x0, do_keygen_crt
+
+rsa_1024_derive_crt:
+  /* Set the number of limbs for the modulus (1024 / 256 = 4). */
+  li      x30, 4
+
+  /* Tail-call CRT key derivation. */
+  jal     x0, do_derive_crt
+
+rsa_2048_derive_crt:
+  /* Set the number of limbs for the modulus (2048 / 256 = 8). */
+  li      x30, 8
+
+  /* Tail-call CRT key derivation. */
+  jal     x0, do_derive_crt
+
+rsa_3072_derive_crt:
+  /* Set the number of limbs for the modulus (3072 / 256 = 12). */
+  li      x30, 12
+
+  /* Tail-call CRT key derivation. */
+  jal     x0, do_derive_crt
+
+rsa_4096_derive_crt:
+  /* Set the number of limbs for the modulus (4096 / 256 = 16). */
+  li      x30, 16
+
+  /* Tail-call CRT key derivation. */
+  jal     x0, do_derive_crt
+
+rsa_1024_modexp_crt:
+  /* Enable message blinding. */
+  li x29, 1
+
+  /* Set the number of limbs for the modulus (1024 / 256 = 4). */
+  li      x30, 4
+
+  /* Tail-call CRT modexp. */
+  jal     x0, do_modexp_crt
+
+rsa_2048_modexp_crt:
+  /* Enable message blinding. */
+  li x29, 1
+
+  /* Set the number of limbs for the modulus (2048 / 256 = 8). */
+  li      x30, 8
+
+  /* Tail-call CRT modexp. */
+  jal     x0, do_modexp_crt
+
+rsa_3072_modexp_crt:
+  /* Enable message blinding. */
+  li x29, 1
+
+  /* Set the number of limbs for the modulus (3072 / 256 = 12). */
+  li      x30, 12
+
+  /* Tail-call CRT modexp. */
+  jal     x0, do_modexp_crt
+
+rsa_4096_modexp_crt:
+  /* Enable message blinding. */
+  li x29, 1
+
+  /* Set the number of limbs for the modulus (4096 / 256 = 16). */
+  li      x30, 16
+
+  /* Tail-call CRT modexp. */
+  jal     x0, do_modexp_crt
+
 /**
  * Invoke the RSA key generation algorithm.
  *
@@ -323,3 +494,95 @@ do_modexp_f4:
     bn.sid x0, 0(x4++)
 
   ecall
+
+/**
+ * Generate a CRT private key.
+ *
+ * Calls `ecall` when done; should be tail-called by mode-specific routines
+ * after the number of limbs is set.
+ *
+ * @param[in]         x30: number of limbs for modulus
+ * @param[out]    dmem[n]: n, modulus
+ * @param[out]    dmem[p]: p, first prime
+ * @param[out]    dmem[q]: q, second prime
+ * @param[out]   dmem[d0]: first share of dp = d mod (p - 1)
+ * @param[out]   dmem[d1]: second share of dp
+ * @param[out]    dmem[g]: first share of dq = d mod (q - 1)
+ * @param[out]    dmem[h]: second share of dq
+ * @param[out] dmem[qinv]: qinv, q^-1 mod p
+ */
+do_keygen_crt:
+  # Save mode indicator in register.
+  la x16, mode
+  lw x28, 0(x16)
+
+  jal x1, rsa_crt_keygen
+
+  # Restore mode indicator in DMEM.
+  la x16, mode
+  sw x28, 0(x16)
+
+  ecall
+
+/**
+ * Derive a CRT private key from the primes.
+ *
+ * Calls `ecall` when done; should be tail-called by mode-specific routines
+ * after the number of limbs is set.
+ *
+ * @param[in]         x30: number of limbs for modulus
+ * @param[in]     dmem[p]: p, first prime
+ * @param[in]     dmem[q]: q, second prime
+ * @param[out]    dmem[n]: n, modulus
+ * @param[out]   dmem[d0]: first share of dp = d mod (p - 1)
+ * @param[out]   dmem[d1]: second share of dp
+ * @param[out]    dmem[g]: first share of dq = d mod (q - 1)
+ * @param[out]    dmem[h]: second share of dq
+ * @param[out] dmem[qinv]: qinv, q^-1 mod p
+ */
+do_derive_crt:
+  # Save mode indicator in register.
+  la x16, mode
+  lw x28, 0(x16)
+
+  jal x1, rsa_crt_derive
+
+  # Restore mode indicator in DMEM.
+  la x16, mode
+  sw x28, 0(x16)
+
+  ecall
+
+/**
+ * Run a private-key operation with the CRT and check the result.
+ *
+ * Calls `ecall` when done; should be tail-called by mode-specific routines
+ * after the number of limbs is set. Triggers an error instead if the result
+ * is wrong, e.g. because of a fault.
+ *
+ * @param[in]          x29: message blinding flag (enable if non-zero)
+ * @param[in]          x30: number of limbs for modulus
+ * @param[in]      dmem[p]: p, first prime
+ * @param[in]      dmem[q]: q, second prime
+ * @param[in]     dmem[d0]: first share of dp = d mod (p - 1)
+ * @param[in]     dmem[d1]: second share of dp
+ * @param[in]      dmem[g]: first share of dq = d mod (q - 1)
+ * @param[in]      dmem[h]: second share of dq
+ * @param[in]   dmem[qinv]: qinv, q^-1 mod p
+ * @param[in]  dmem[inout]: a, base for exponentiation
+ * @param[out] dmem[inout]: result, a^d mod (p * q)
+ */
+do_modexp_crt:
+  # Save mode indicator in register.
+  la x16, mode
+  lw x28, 0(x16)
+
+  jal x1, rsa_crt_modexp
+
+  # Restore mode indicator in DMEM.
+  la x16, mode
+  sw x28, 0(x16)
+
+  jal x1, rsa_crt_verify
+
+  ecall
@@ -8,14 +8,27 @@
 
 .bss
 
-/* RSA modulus (n), up to 4096 bits. */
-.globl rsa_n
+# RSA modulus (n), up to 4096 bits.
+# Keygen: Candidate prime and its small-prime sieve residues (sieve_residues).
+.globl rsa_n, sieve_residues
 .balign 32
+/*----------------+----------------+----------*
+ |                |                |          |
+ |      256B      |   candidate    |          |
+ |                |                |          |
+ +----------------+----------------+  rsa_n   |
+ |                |                |          |
+ |      256B      | sieve_residues |          |
+ |                |                |          |
+ *----------------+----------------+----------*/
 rsa_n:
-.zero 512
+.zero 256
+sieve_residues:
+.zero 256
 
 # Enc/Sign: First private exponent share (d) up to 4096 bits.
 # Keygen: Temp storage for rsa_p and second exponent share for primality tests.
+# CRT: First share of dp (rsa_d0) and prime p (rsa_p).
 .globl rsa_d0, rsa_p
 .balign 32
 /*----------------+----------+----------*
@@ -34,6 +47,7 @@ rsa_p:
 
 # Enc/Sign: Second private exponent share (d) for signing, up to 4096 bits.
 # Keygen: Temp storage for rsa_q and second exponent share for primality tests.
+# CRT: Second share of dp (rsa_d1) and prime q (rsa_q).
 .globl rsa_d1, rsa_q
 .balign 32
 /*----------------+----------+----------*
@@ -58,6 +72,7 @@ r0:
 inout:
 .zero 512
 
+# CRT: first share of dq (rsa_g).
 .globl r1, mode, rsa_g
 .balign 32
 /*----------------+----------+----------*
@@ -75,11 +90,12 @@ mode:
 rsa_g:
 .zero 256
 
-.globl r2, rsa_h
+# CRT: qinv (rsa_qinv) and second share of dq (rsa_h).
+.globl r2, rsa_qinv, rsa_h
 .balign 32
 /*----------------+----------+----------*
- |                |          |          |
- |      256B      |    r2    |          |
+ |                |    r2    |          |
+ |      256B      |  (qinv)  |          |
  |                |          |          |
  +----------------+----------+    r2    |
  |                |          |          |
@@ -87,6 +103,7 @@ rsa_g:
  |                |          |          |
  *----------------+----------+----------*/
 r2:
+rsa_qinv:
 .zero 256
 rsa_h:
 .zero 256
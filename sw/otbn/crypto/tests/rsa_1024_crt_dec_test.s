@@ -0,0 +1,43 @@
+/* Copyright lowRISC contributors (OpenTitan project). */
+/* Licensed under the Apache License, Version 2.0, see LICENSE for details. */
+/* SPDX-License-Identifier: Apache-2.0 */
+
+
+.section .text.start
+
+/**
+ * Standalone RSA 1024 CRT decrypt
+ *
+ * Decrypts the message in the .data segment with the CRT form of the private
+ * key (p, q, dp, dq, qinv) and checks the result against the public key before
+ * releasing it.
+ *
+ * Copies the decrypted message to wide registers for comparison (starting at
+ * w0). See the .hjson file for expected values.
+ */
+ main:
+  /* Init all-zero register. */
+  bn.xor  w31, w31, w31
+
+  /* Enable message blinding. */
+  li x29, 1
+
+  /* Load number of limbs. */
+  li    x30, 4
+
+  /* Run the two half-size exponentiations and recombine.
+       dmem[rsa_d1] <= dmem[inout]^d mod (dmem[rsa_p] * dmem[rsa_q]) */
+  jal      x1, rsa_crt_modexp
+
+  /* Check the result against the public exponent.
+       dmem[inout] <= dmem[rsa_d1] */
+  jal      x1, rsa_crt_verify
+
+  /* copy all limbs of result to wide reg file */
+  la       x21, inout
+  li       x8, 0
+  loop     x30, 2
+    bn.lid   x8, 0(x21++)
+    addi     x8, x8, 1
+
+  ecall
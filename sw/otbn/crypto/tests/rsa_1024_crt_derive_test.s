@@ -0,0 +1,69 @@
+/* Copyright lowRISC contributors (OpenTitan project). */
+/* Licensed under the Apache License, Version 2.0, see LICENSE for details. */
+/* SPDX-License-Identifier: Apache-2.0 */
+
+
+.section .text.start
+
+/**
+ * Standalone test for deriving an RSA 1024 CRT private key from p and q.
+ *
+ * Unmasks the derived exponents and copies the key to wide registers for
+ * comparison: dp in w0..w1, dq in w2..w3, qinv in w4..w5 and n in w6..w9. See
+ * the .hjson file for expected values.
+ */
+ main:
+  /* Init all-zero register. */
+  bn.xor  w31, w31, w31
+
+  /* Load number of limbs. */
+  li    x30, 4
+
+  /* Derive the private key. */
+  jal      x1, rsa_crt_derive
+
+  /* Unmask dp and copy it to w0..w1. */
+  li       x2, 20
+  li       x3, 21
+  li       x8, 0
+  la       x4, rsa_d0
+  la       x5, rsa_d1
+  jal      x1, unmask_half
+
+  /* Unmask dq and copy it to w2..w3. */
+  la       x4, rsa_g
+  la       x5, rsa_h
+  jal      x1, unmask_half
+
+  /* Copy qinv to w4..w5. */
+  la       x21, rsa_qinv
+  loopi    2, 2
+    bn.lid   x8, 0(x21++)
+    addi     x8, x8, 1
+
+  /* Copy n to w6..w9. */
+  la       x21, rsa_n
+  loop     x30, 2
+    bn.lid   x8, 0(x21++)
+    addi     x8, x8, 1
+
+  ecall
+
+/**
+ * Unmask two limbs and copy them to the wide register file.
+ *
+ * @param[in]  x4: pointer to the first share in dmem
+ * @param[in]  x5: pointer to the second share in dmem
+ * @param[in]  x8: index of the first destination register
+ * @param[out] x8: x8 + 2
+ *
+ * clobbered registers: x4, x5, x8, w20, w21
+ */
+unmask_half:
+  loopi    2, 5
+    bn.lid   x2, 0(x4++)
+    bn.lid   x3, 0(x5++)
+    bn.xor   w20, w20, w21
+    bn.movr  x8, x2
+    addi     x8, x8, 1
+  ret
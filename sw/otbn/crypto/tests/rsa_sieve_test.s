@@ -0,0 +1,140 @@
+/* Copyright lowRISC contributors (OpenTitan project). */
+/* Licensed under the Apache License, Version 2.0, see LICENSE for details. */
+/* SPDX-License-Identifier: Apache-2.0 */
+
+/**
+ * Standalone test for the small-prime sieve used in RSA key generation.
+ *
+ * Computes the sieve residues of a candidate p that is divisible by 251 and
+ * scans two windows from it: the first survivor is p + 8, the next one
+ * p + 8 + 8*3. Then scans a window without any survivor starting at a second
+ * candidate q, which must end at q + 8*32. Checks that the incrementally
+ * updated residues match freshly computed ones and that scanning detects an
+ * overflow.
+ */
+
+.section .text.start
+
+main:
+  /* Init all-zero register. */
+  bn.xor    w31, w31, w31
+
+  /* Number of limbs (n).
+       x30 <= n */
+  li        x30, 4
+
+  /* Compute the residues of the candidate p.
+       dmem[sieve_residues] <= residues of p */
+  jal       x1, sieve_init
+
+  /* x5 <= 1 if p has no small odd factor, otherwise 0 */
+  jal       x1, sieve_check
+  addi      x5, x2, 0
+
+  /* dmem[rsa_n] <= p + 8
+     x6 <= 1 if the scan overflowed, otherwise 0 */
+  jal       x1, sieve_scan
+  addi      x6, x2, 0
+
+  /* x7 <= 1 if p + 8 has no small odd factor, otherwise 0 */
+  jal       x1, sieve_check
+  addi      x7, x2, 0
+
+  /* dmem[rsa_n] <= p + 8 + 8*3
+     x8 <= 1 if the scan overflowed, otherwise 0 */
+  jal       x1, sieve_scan
+  addi      x8, x2, 0
+
+  /* x9 <= 1 if p + 8 + 8*3 has no small odd factor, otherwise 0 */
+  jal       x1, sieve_check
+  addi      x9, x2, 0
+
+  /* w0 <= differences between the incremental and fresh residues */
+  bn.mov    w0, w31
+  jal       x1, compare_residues
+
+  /* dmem[rsa_q] <= dmem[rsa_n] = p + 8 + 8*3 */
+  la        x3, rsa_n
+  la        x4, rsa_q
+  jal       x1, copy_limbs
+
+  /* dmem[rsa_n] <= dmem[rsa_p] = q */
+  la        x3, rsa_p
+  la        x4, rsa_n
+  jal       x1, copy_limbs
+
+  /* dmem[rsa_n] <= q + 8*32
+     x10 <= 1 if the scan overflowed, otherwise 0 */
+  jal       x1, sieve_init
+  jal       x1, sieve_scan
+  addi      x10, x2, 0
+
+  /* x11 <= 1 if q + 8*32 has no small odd factor, otherwise 0 */
+  jal       x1, sieve_check
+  addi      x11, x2, 0
+
+  /* w0 <= w0 | differences between the incremental and fresh residues */
+  jal       x1, compare_residues
+
+  /* dmem[rsa_p] <= dmem[rsa_n] = q + 8*32 */
+  la        x3, rsa_n
+  la        x4, rsa_p
+  jal       x1, copy_limbs
+
+  /* Scan from the largest candidate 2^1024 - 1.
+       x12 <= 1 if the candidate overflowed, otherwise 0 */
+  bn.not    w20, w31
+  li        x20, 20
+  la        x3, rsa_n
+  loop      x30, 1
+    bn.sid    x20, 0(x3++)
+  jal       x1, sieve_scan
+  addi      x12, x2, 0
+
+  ecall
+
+/**
+ * Compare the sieve residues with freshly computed ones.
+ *
+ * @param[in]  dmem[rsa_n]: candidate prime
+ * @param[in]  dmem[sieve_residues]: incrementally updated residues
+ * @param[in]  w0: accumulated differences
+ * @param[out] w0: w0 | OR of the differences between both sets of residues
+ */
+compare_residues:
+  /* dmem[r0] <= dmem[sieve_residues] */
+  li        x20, 20
+  la        x3, sieve_residues
+  la        x4, r0
+  loopi     8, 2
+    bn.lid    x20, 0(x3++)
+    bn.sid    x20, 0(x4++)
+
+  /* dmem[sieve_residues] <= residues of dmem[rsa_n] */
+  jal       x1, sieve_init
+
+  li        x20, 20
+  li        x21, 21
+  la        x3, sieve_residues
+  la        x4, r0
+  loopi     8, 4
+    bn.lid    x20, 0(x3++)
+    bn.lid    x21, 0(x4++)
+    bn.xor    w20, w20, w21
+    bn.or     w0, w0, w20
+
+  ret
+
+/**
+ * Copy an n-limb number.
+ *
+ * @param[in]  x3: source address
+ * @param[in]  x4: destination address
+ * @param[in]  x30: n, number of limbs
+ */
+copy_limbs:
+  li        x20, 20
+  loop      x30, 2
+    bn.lid    x20, 0(x3++)
+    bn.sid    x20, 0(x4++)
+  ret
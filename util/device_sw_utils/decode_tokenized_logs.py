@@ -0,0 +1,300 @@
+#!/usr/bin/env python3
+# Copyright lowRISC contributors (OpenTitan project).
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+"""Decoder for tokenized device logs.
+
+Device software built with `--define ot_log_tokenized=true` does not format
+its LOG lines. Each line is sent to the console as a binary frame instead
+(see `base_log_internal_tokenized()` in sw/device/lib/runtime/log.c):
+
+    0xa5           frame magic (not an ASCII character)
+    nargs          number of arguments, one byte
+    addr           address of the log_fields_t record, u32 little-endian
+    args[nargs]    raw arguments, u32 little-endian each
+
+The record address points into the `.logs.fields` section of the ELF file, as
+in DV logging. This script reads the records and the strings they refer to
+from the ELF file, and turns a console capture back into the text the
+untokenized build would have printed. Bytes outside of frames, e.g. from
+`base_printf()`, are passed through unchanged.
+
+String arguments (%s, %!s and the %!x family) can only be rebuilt when they
+point at data stored in the ELF file; other pointers are printed as
+`<0x...>`.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+from elftools.elf import elffile
+
+LOGS_FIELDS_SECTION = '.logs.fields'
+LOGS_FIELDS_SIZE = 20
+FRAME_MAGIC = 0xa5
+FRAME_HEADER_SIZE = 6
+
+SEVERITIES = ['I', 'W', 'E', 'F']
+
+STATUS_CODES = [
+    'Ok', 'Cancelled', 'Unknown', 'InvalidArgument', 'DeadlineExceeded',
+    'NotFound', 'AlreadyExists', 'PermissionDenied', 'ResourceExhausted',
+    'FailedPrecondition', 'Aborted', 'OutOfRange', 'Unimplemented',
+    'Internal', 'Unavailable', 'DataLoss', 'Unauthenticated'
+] + ['Undefined{}'.format(i) for i in range(17, 32)] + ['ErrorError']
+
+# Matches one format specifier, as supported by sw/device/lib/runtime/print.c.
+SPEC_RE = re.compile(r'%(!?)(0?)(\d*)([%csdiuoxXpbhHyYrC])')
+
+
+class LogRecord:
+    '''A log_fields_t record from the ELF file.'''
+
+    def __init__(self, severity, file_name, line, nargs, fmt):
+        self.severity = severity
+        self.file_name = file_name
+        self.line = line
+        self.nargs = nargs
+        self.format = fmt
+
+
+class ElfImage:
+    '''The loaded sections of an ELF file and its log records.'''
+
+    def __init__(self, elf_file):
+        self.segments = []
+        self.records = {}
+        with open(elf_file, 'rb') as f:
+            elf = elffile.ELFFile(f)
+            for section in elf.iter_sections():
+                if section.header['sh_type'] != 'SHT_PROGBITS':
+                    continue
+                if section.name == LOGS_FIELDS_SECTION:
+                    continue
+                if section.name.startswith('.debug'):
+                    continue
+                self.segments.append(
+                    (int(section.header['sh_addr']), section.data()))
+
+            section = elf.get_section_by_name(LOGS_FIELDS_SECTION)
+            if section is None:
+                raise ValueError('{} section not found in {}'.format(
+                    LOGS_FIELDS_SECTION, elf_file))
+            self._read_records(section.data())
+
+    def _read_records(self, data):
+        # The section starts with the `_dv_log_offset` of the image, which is
+        # added to the record addresses sent by the device.
+        header_size = 4
+        logs_offset, = struct.unpack('<I', data[0:header_size])
+        for start in range(header_size,
+                           len(data) - LOGS_FIELDS_SIZE + 1,
+                           LOGS_FIELDS_SIZE):
+            severity, file_addr, line, nargs, format_addr = struct.unpack(
+                '<IIIII', data[start:start + LOGS_FIELDS_SIZE])
+            file_name = self.read_string(file_addr) or '?'
+            fmt = self.read_string(format_addr) or ''
+            self.records[logs_offset + start] = LogRecord(
+                severity, os.path.basename(file_name), line, nargs, fmt)
+
+    def read_bytes(self, addr, length):
+        '''Returns `length` bytes at `addr`, or None if not in the image.'''
+        for base, data in self.segments:
+            if base <= addr and addr + length <= base + len(data):
+                return data[addr - base:addr - base + length]
+        return None
+
+    def read_string(self, addr):
+        '''Returns the NUL-terminated string at `addr`, or None.'''
+        for base, data in self.segments:
+            if base <= addr < base + len(data):
+                end = data.find(b'\0', addr - base)
+                if end == -1:
+                    return None
+                return data[addr - base:end].decode('utf-8', errors='replace')
+        return None
+
+
+def format_int(value, base, width, pad, upper=False):
+    digits = {2: 'b', 8: 'o', 10: 'd', 16: 'X' if upper else 'x'}[base]
+    return format(value, digits).rjust(width, pad)
+
+
+def format_status(value, as_json):
+    if value & 0x80000000:
+        code = value & 0x1f
+        if code == 0:
+            code = len(STATUS_CODES) - 1
+    else:
+        code = 0
+    name = STATUS_CODES[code]
+    if as_json:
+        name = '"{}"'.format(name)
+    if code == 0:
+        arg = value - (1 << 32) if value & 0x80000000 else value
+        body = '{}:{}'.format(name, arg)
+    else:
+        arg = (value >> 5) & 0x7ff
+        module_id = (value >> 16) & 0x7fff
+        mod = ''.join(
+            chr(ord('@') + ((module_id >> shift) & 0x1f))
+            for shift in (0, 5, 10))
+        mod = mod.replace('\\', '\\\\')
+        body = '{}:["{}",{}]'.format(name, mod, arg)
+    return '{' + body + '}' if as_json else body
+
+
+def format_message(image, fmt, args):
+    '''Formats `args` according to `fmt`, mirroring base_vfprintf().'''
+    args = list(args)
+    out = []
+    pos = 0
+
+    def next_arg():
+        return args.pop(0) if args else 0
+
+    for m in SPEC_RE.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        nonstd, zero, width, spec = m.groups()
+        width = int(width) if width else 0
+        pad = '0' if zero else ' '
+
+        if spec == '%':
+            out.append('%')
+        elif spec == 'c':
+            out.append(chr(next_arg() & 0xff))
+        elif spec == 's':
+            length = next_arg() if nonstd else None
+            addr = next_arg()
+            if nonstd:
+                data = image.read_bytes(addr, length)
+                text = (data.decode('utf-8', errors='replace')
+                        if data is not None else None)
+            else:
+                text = image.read_string(addr)
+            out.append(text if text is not None else '<0x{:08x}>'.format(addr))
+        elif spec in 'di':
+            value = next_arg()
+            if value & 0x80000000:
+                out.append('-')
+                value = (1 << 32) - value
+            out.append(format_int(value, 10, width, pad))
+        elif spec == 'u':
+            out.append(format_int(next_arg(), 10, width, pad))
+        elif spec == 'o':
+            out.append(format_int(next_arg(), 8, width, pad))
+        elif spec == 'p':
+            out.append('0x{:08x}'.format(next_arg()))
+        elif spec in 'xXyY' and nonstd:
+            length = next_arg()
+            addr = next_arg()
+            data = image.read_bytes(addr, length)
+            if data is None:
+                out.append('<0x{:08x}>'.format(addr))
+                continue
+            if spec in 'xX':
+                data = data[::-1]
+            text = data.hex()
+            if spec in 'XY':
+                text = text.upper()
+            out.append(text.rjust(width, pad))
+        elif spec in 'xh':
+            out.append(format_int(next_arg(), 16, width, pad))
+        elif spec in 'XH':
+            out.append(format_int(next_arg(), 16, width, pad, upper=True))
+        elif spec == 'b':
+            if nonstd:
+                out.append('true' if next_arg() else 'false')
+            else:
+                out.append(format_int(next_arg(), 2, width, pad))
+        elif spec == 'r':
+            out.append(format_status(next_arg(), bool(nonstd)))
+        elif spec == 'C':
+            value = next_arg()
+            for ch in struct.pack('<I', value):
+                out.append(chr(ch) if 32 <= ch < 127 else '\\x{:02x}'.format(ch))
+        else:
+            out.append('%<unknown spec>')
+    out.append(fmt[pos:])
+    return ''.join(out)
+
+
+class Decoder:
+    '''Incrementally decodes a console byte stream.'''
+
+    def __init__(self, image):
+        self.image = image
+        self.buf = bytearray()
+        self.counter = 0
+
+    def feed(self, data):
+        '''Consumes `data` and returns the decoded text available so far.'''
+        self.buf += data
+        out = []
+        while self.buf:
+            idx = self.buf.find(FRAME_MAGIC)
+            if idx == -1:
+                out.append(self.buf.decode('utf-8', errors='replace'))
+                self.buf.clear()
+                break
+            if idx > 0:
+                out.append(self.buf[:idx].decode('utf-8', errors='replace'))
+                del self.buf[:idx]
+            if len(self.buf) < FRAME_HEADER_SIZE:
+                break
+            nargs = self.buf[1]
+            addr, = struct.unpack('<I', self.buf[2:FRAME_HEADER_SIZE])
+            record = self.image.records.get(addr)
+            if record is None or record.nargs != nargs:
+                # Not a frame after all; pass the byte through.
+                out.append(chr(self.buf[0]))
+                del self.buf[:1]
+                continue
+            frame_size = FRAME_HEADER_SIZE + 4 * nargs
+            if len(self.buf) < frame_size:
+                break
+            args = struct.unpack('<{}I'.format(nargs),
+                                 self.buf[FRAME_HEADER_SIZE:frame_size])
+            del self.buf[:frame_size]
+            out.append(self.format_record(record, args))
+        return ''.join(out)
+
+    def format_record(self, record, args):
+        severity = (SEVERITIES[record.severity]
+                    if record.severity < len(SEVERITIES) else '?')
+        prefix = '{}{:05d} {}:{}] '.format(severity, self.counter & 0xffff,
+                                           record.file_name, record.line)
+        self.counter += 1
+        return prefix + format_message(self.image, record.format,
+                                       args) + '\r\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--elf-file', '-e', required=True, help='Elf file')
+    parser.add_argument('input',
+                        nargs='?',
+                        default='-',
+                        help='Console capture to decode (default: stdin).')
+    args = parser.parse_args()
+
+    image = ElfImage(args.elf_file)
+    decoder = Decoder(image)
+    infile = (sys.stdin.buffer
+              if args.input == '-' else open(args.input, 'rb'))
+    with infile:
+        while True:
+            data = infile.read1(4096) if hasattr(infile,
+                                                 'read1') else infile.read(4096)
+            if not data:
+                break
+            sys.stdout.write(decoder.feed(data))
+            sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,140 @@
+# Copyright lowRISC contributors (OpenTitan project).
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+
+import struct
+import unittest
+
+import decode_tokenized_logs as dtl
+
+# Layout of the fake image: a .rodata-like segment with the strings and a
+# `.logs.fields` section whose records are found at `LOGS_OFFSET + offset`.
+RODATA_BASE = 0x20000000
+LOGS_OFFSET = 0x80000000
+
+
+class FakeImage(dtl.ElfImage):
+    '''An ElfImage built from Python data instead of an ELF file.'''
+
+    def __init__(self, strings, records):
+        self.segments = []
+        self.records = {}
+        self.string_addrs = {}
+        rodata = bytearray()
+        for s in strings:
+            self.string_addrs[s] = RODATA_BASE + len(rodata)
+            rodata += s.encode() + b'\0'
+        self.segments.append((RODATA_BASE, bytes(rodata)))
+
+        fields = bytearray(struct.pack('<I', LOGS_OFFSET))
+        self.record_addrs = []
+        for severity, file_name, line, nargs, fmt in records:
+            self.record_addrs.append(LOGS_OFFSET + len(fields))
+            fields += struct.pack('<IIIII', severity,
+                                  self.string_addrs[file_name], line, nargs,
+                                  self.string_addrs[fmt])
+        self._read_records(bytes(fields))
+
+
+def frame(addr, *args):
+    return (bytes([dtl.FRAME_MAGIC, len(args)]) +
+            struct.pack('<I', addr) +
+            struct.pack('<{}I'.format(len(args)), *args))
+
+
+class TestDecoder(unittest.TestCase):
+
+    def setUp(self):
+        self.image = FakeImage(
+            strings=[
+                'sw/device/tests/foo.c', 'Hello', 'x=%d y=%08x',
+                'name=%s', 'status=%r', 'PASS!'
+            ],
+            records=[
+                (0, 'sw/device/tests/foo.c', 10, 0, 'Hello'),
+                (2, 'sw/device/tests/foo.c', 20, 2, 'x=%d y=%08x'),
+                (1, 'sw/device/tests/foo.c', 30, 1, 'name=%s'),
+                (0, 'sw/device/tests/foo.c', 40, 1, 'status=%r'),
+            ])
+        self.hello, self.ints, self.name, self.status = self.image.record_addrs
+
+    def test_read_records(self):
+        record = self.image.records[self.ints]
+        self.assertEqual(record.severity, 2)
+        self.assertEqual(record.file_name, 'foo.c')
+        self.assertEqual(record.line, 20)
+        self.assertEqual(record.nargs, 2)
+        self.assertEqual(record.format, 'x=%d y=%08x')
+
+    def test_plain_text_passes_through(self):
+        decoder = dtl.Decoder(self.image)
+        self.assertEqual(decoder.feed(b'I00000 status.c:41] PASS!\r\n'),
+                         'I00000 status.c:41] PASS!\r\n')
+
+    def test_frames(self):
+        decoder = dtl.Decoder(self.image)
+        out = decoder.feed(
+            frame(self.hello) + frame(self.ints, 0xfffffffe, 0xbeef) +
+            frame(self.name, self.image.string_addrs['PASS!']) +
+            frame(self.name, 0x1234))
+        self.assertEqual(
+            out, 'I00000 foo.c:10] Hello\r\n'
+            'E00001 foo.c:20] x=-2 y=0000beef\r\n'
+            'W00002 foo.c:30] name=PASS!\r\n'
+            'W00003 foo.c:30] name=<0x00001234>\r\n')
+
+    def test_frames_mixed_with_text(self):
+        decoder = dtl.Decoder(self.image)
+        out = decoder.feed(b'boot\r\n' + frame(self.hello) + b'PASS!\r\n')
+        self.assertEqual(out, 'boot\r\nI00000 foo.c:10] Hello\r\nPASS!\r\n')
+
+    def test_split_frame(self):
+        decoder = dtl.Decoder(self.image)
+        data = frame(self.ints, 7, 0x10)
+        out = ''
+        for i in range(len(data)):
+            out += decoder.feed(data[i:i + 1])
+        self.assertEqual(out, 'E00000 foo.c:20] x=7 y=00000010\r\n')
+
+    def test_unknown_record_is_not_a_frame(self):
+        decoder = dtl.Decoder(self.image)
+        out = decoder.feed(frame(self.hello + 4) + b'ok')
+        self.assertTrue(out.endswith('ok'))
+        self.assertNotIn('Hello', out)
+        # A frame with the wrong argument count is not decoded either.
+        decoder = dtl.Decoder(self.image)
+        out = decoder.feed(frame(self.hello, 1))
+        self.assertNotIn('Hello', out)
+
+    def test_status(self):
+        decoder = dtl.Decoder(self.image)
+        # INVALID_ARGUMENT from module "ABC" with argument 12.
+        module_id = 1 | (2 << 5) | (3 << 10)
+        err = 0x80000000 | (module_id << 16) | (12 << 5) | 3
+        out = decoder.feed(frame(self.status, 5) + frame(self.status, err))
+        self.assertEqual(
+            out, 'I00000 foo.c:40] status=Ok:5\r\n'
+            'I00001 foo.c:40] status=InvalidArgument:["ABC",12]\r\n')
+
+
+class TestFormatMessage(unittest.TestCase):
+
+    def setUp(self):
+        self.image = FakeImage(strings=['abcd'], records=[])
+
+    def test_integers(self):
+        self.assertEqual(
+            dtl.format_message(self.image, '%u %5d %x %X %o %b %%',
+                               [42, 3, 0xab, 0xab, 8, 5]),
+            '42     3 ab AB 10 101 %')
+
+    def test_nonstd(self):
+        addr = self.image.string_addrs['abcd']
+        self.assertEqual(
+            dtl.format_message(self.image, '%!s|%!x|%!y|%!b|%C',
+                               [2, addr, 2, addr, 2, addr, 1, 0x6b4f]),
+            'ab|6261|6162|true|Ok\\x00\\x00')
+
+
+if __name__ == '__main__':
+    unittest.main()